@@ -65,6 +65,7 @@
 #include <neon/render/model/InstanceData.h>
 #include <neon/render/model/BasicInstanceData.h>
 #include <neon/render/model/ConcurrentInstanceData.h>
+#include <neon/render/model/MappedInstanceData.h>
 #include <neon/render/model/StorageBufferInstanceData.h>
 #include <neon/render/model/Mesh.h>
 #include <neon/render/model/MeshShaderDrawable.h>
@@ -91,6 +92,8 @@
 #include <neon/render/GraphicComponent.h>
 #include <neon/render/Render.h>
 #include <neon/render/RenderPassStrategy.h>
+#include <neon/render/DrawList.h>
+#include <neon/render/RenderQueue.h>
 
 #include <neon/structure/collection/AssetCollection.h>
 #include <neon/structure/collection/ComponentCollection.h>
@@ -260,6 +260,19 @@ namespace neon::assimp_loader
             return result;
         }
 
+        BoundingSphere computeBoundingSphere(const aiScene* scene)
+        {
+            std::vector<rush::Vec3f> positions;
+            for (size_t i = 0; i < scene->mNumMeshes; ++i) {
+                auto* mesh = scene->mMeshes[i];
+                for (size_t v = 0; v < mesh->mNumVertices; ++v) {
+                    auto p = mesh->mVertices[v];
+                    positions.emplace_back(p.x, p.y, p.z);
+                }
+            }
+            return BoundingSphere::fromPoints(positions);
+        }
+
         void loadMeshes(const aiScene* scene, std::vector<std::shared_ptr<Drawable>>& meshes,
                         const std::vector<Mat>& materials, const LoaderInfo& info,
                         const std::unique_ptr<LocalModel>& localModel)
@@ -332,6 +345,10 @@ namespace neon::assimp_loader
             modelInfo.instanceSizes.push_back(iData.size);
         }
 
+        if (info.frustumCulling) {
+            modelInfo.cullingBounds = computeBoundingSphere(scene);
+        }
+
         std::vector<Mat> materials;
 
         loadTextures(scene, textures, loadedTextures, info);
@@ -220,6 +220,15 @@ namespace neon::assimp_loader {
 
         bool loadGPUModel = true;
 
+        /**
+         * Whether the instances of the model should be culled
+         * against the camera's frustum before rendering.
+         * <p>
+         * If true, the bounding sphere of the model is computed
+         * from the vertices of the scene.
+         */
+        bool frustumCulling = false;
+
         std::function<std::vector<InstanceData*>(
             Application*, const ModelCreateInfo& info, Model* model)> instanceDataProvider
                 = [](Application* app, const ModelCreateInfo& info, Model*) {
@@ -5,6 +5,8 @@
 #include "DirectoryFileSystem.h"
 
 #include <fstream>
+#include <functional>
+#include <thread>
 #include <utility>
 
 namespace neon
@@ -37,4 +39,38 @@ namespace neon
         auto result = _root / path;
         return std::filesystem::exists(result) && !is_directory(result);
     }
+
+    bool DirectoryFileSystem::writeFile(std::filesystem::path path, const void* data, size_t size)
+    {
+        auto result = _root / path;
+
+        std::error_code error;
+        std::filesystem::create_directories(result.parent_path(), error);
+        if (error) {
+            return false;
+        }
+
+        // Write into a temporary file first: readers never see partially written files.
+        auto temporary = result;
+        temporary += "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            if (!file) {
+                return false;
+            }
+            file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+            if (!file) {
+                file.close();
+                std::filesystem::remove(temporary, error);
+                return false;
+            }
+        }
+
+        std::filesystem::rename(temporary, result, error);
+        if (error) {
+            std::filesystem::remove(temporary, error);
+            return false;
+        }
+        return true;
+    }
 } // namespace neon
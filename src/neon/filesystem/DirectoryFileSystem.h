@@ -21,6 +21,8 @@ namespace neon
         [[nodiscard]] std::optional<File> readFile(std::filesystem::path path) const override;
 
         [[nodiscard]] bool exists(std::filesystem::path path) const override;
+
+        bool writeFile(std::filesystem::path path, const void* data, size_t size) override;
     };
 } // namespace neon
 
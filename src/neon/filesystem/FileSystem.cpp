@@ -3,3 +3,11 @@
 //
 
 #include "FileSystem.h"
+
+namespace neon
+{
+    bool FileSystem::writeFile(std::filesystem::path /*path*/, const void* /*data*/, size_t /*size*/)
+    {
+        return false;
+    }
+} // namespace neon
@@ -19,6 +19,20 @@ namespace neon
         [[nodiscard]] virtual std::optional<File> readFile(std::filesystem::path path) const = 0;
 
         [[nodiscard]] virtual bool exists(std::filesystem::path path) const = 0;
+
+        /**
+         * Writes the given data into the file at the given path.
+         * If the file already exists, it is replaced.
+         * <p>
+         * Read-only file systems don't override this method:
+         * the default implementation returns false.
+         *
+         * @param path the path of the file.
+         * @param data the data to write.
+         * @param size the size of the data in bytes.
+         * @return whether the file was written.
+         */
+        virtual bool writeFile(std::filesystem::path path, const void* data, size_t size);
     };
 } // namespace neon
 
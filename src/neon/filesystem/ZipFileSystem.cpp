@@ -4,14 +4,18 @@
 
 #include "ZipFileSystem.h"
 
+#include <cstring>
+
 #include <neon/logging/Logger.h>
 
 namespace neon
 {
-    ZipFileSystem::ZipFileSystem(const std::filesystem::path& file)
+    ZipFileSystem::ZipFileSystem(const std::filesystem::path& file, bool writable) :
+        _writable(writable)
     {
         _zip = std::make_unique<libzippp::ZipArchive>(file.string());
-        if (!_zip->open()) {
+        if (!_zip->open(writable ? libzippp::ZipArchive::Write : libzippp::ZipArchive::ReadOnly)) {
+            _writable = false;
             return;
         }
     }
@@ -24,8 +28,27 @@ namespace neon
         _zip->close();
     }
 
+    bool ZipFileSystem::flush()
+    {
+        std::lock_guard lock(_mutex);
+        if (!_writable || _written.empty()) {
+            return true;
+        }
+
+        // Closing the archive writes it. It must be opened again to keep using it.
+        bool stored = _zip->close() == LIBZIPPP_OK;
+        _written.clear();
+
+        if (!_zip->open(libzippp::ZipArchive::Write)) {
+            neon::error() << "Couldn't reopen zip file " << _zip->getPath() << ".";
+            _writable = false;
+        }
+        return stored;
+    }
+
     std::optional<File> ZipFileSystem::readFile(std::filesystem::path path) const
     {
+        std::lock_guard lock(_mutex);
         auto file = _zip->getEntry(path.lexically_normal().string());
         if (file.isNull() || !file.isFile()) {
             return {};
@@ -36,7 +59,25 @@ namespace neon
 
     bool ZipFileSystem::exists(std::filesystem::path path) const
     {
+        std::lock_guard lock(_mutex);
         auto file = _zip->getEntry(path.lexically_normal().string());
         return !file.isNull() && file.isFile();
     }
+
+    bool ZipFileSystem::writeFile(std::filesystem::path path, const void* data, size_t size)
+    {
+        if (!_writable) {
+            return false;
+        }
+
+        auto copy = std::make_unique<std::byte[]>(size);
+        memcpy(copy.get(), data, size);
+
+        std::lock_guard lock(_mutex);
+        if (!_zip->addData(path.lexically_normal().string(), copy.get(), size)) {
+            return false;
+        }
+        _written.push_back(std::move(copy));
+        return true;
+    }
 } // namespace neon
@@ -5,6 +5,10 @@
 #ifndef ZIPFILESYSTEM_H
 #define ZIPFILESYSTEM_H
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <neon/filesystem/FileSystem.h>
 
 #include <libzippp.h>
@@ -14,15 +18,40 @@ namespace neon
     class ZipFileSystem : public FileSystem
     {
         std::unique_ptr<libzippp::ZipArchive> _zip;
+        bool _writable;
+
+        // The archive reads the written data when it is closed.
+        std::vector<std::unique_ptr<std::byte[]>> _written;
+        mutable std::mutex _mutex;
 
       public:
-        explicit ZipFileSystem(const std::filesystem::path& file);
+        /**
+         * Opens the given zip file.
+         *
+         * @param file the path of the zip file.
+         * @param writable whether files can be written into the zip.
+         * If true, the zip is created if it doesn't exist.
+         * Written files are stored when flush() is called or when this file system is destroyed.
+         */
+        explicit ZipFileSystem(const std::filesystem::path& file, bool writable = false);
 
         ~ZipFileSystem() override;
 
+        /**
+         * Stores the written files into the zip file.
+         * <p>
+         * The archive keeps a copy of every written file in memory until it is stored.
+         * Call this method after writing many files to release that memory.
+         *
+         * @return whether the files were stored. Read-only file systems always return true.
+         */
+        bool flush();
+
         [[nodiscard]] std::optional<File> readFile(std::filesystem::path path) const override;
 
         [[nodiscard]] bool exists(std::filesystem::path path) const override;
+
+        bool writeFile(std::filesystem::path path, const void* data, size_t size) override;
     };
 } // namespace neon
 
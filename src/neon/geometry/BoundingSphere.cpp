@@ -0,0 +1,61 @@
+#include "BoundingSphere.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace neon
+{
+    namespace
+    {
+        float distance(const rush::Vec3f& a, const rush::Vec3f& b)
+        {
+            float x = a[0] - b[0];
+            float y = a[1] - b[1];
+            float z = a[2] - b[2];
+            return std::sqrt(x * x + y * y + z * z);
+        }
+    } // namespace
+
+    BoundingSphere BoundingSphere::fromPoints(const std::vector<rush::Vec3f>& points)
+    {
+        if (points.empty()) {
+            return {rush::Vec3f(0.0f, 0.0f, 0.0f), 0.0f};
+        }
+
+        float min[3] = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                        std::numeric_limits<float>::max()};
+        float max[3] = {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(),
+                        std::numeric_limits<float>::lowest()};
+
+        for (auto& point : points) {
+            for (size_t i = 0; i < 3; ++i) {
+                min[i] = std::min(min[i], point[i]);
+                max[i] = std::max(max[i], point[i]);
+            }
+        }
+
+        rush::Vec3f center((min[0] + max[0]) / 2.0f, (min[1] + max[1]) / 2.0f, (min[2] + max[2]) / 2.0f);
+
+        float radius = 0.0f;
+        for (auto& point : points) {
+            radius = std::max(radius, distance(center, point));
+        }
+
+        return {center, radius};
+    }
+
+    BoundingSphere BoundingSphere::merge(const BoundingSphere& other) const
+    {
+        float min[3];
+        float max[3];
+        for (size_t i = 0; i < 3; ++i) {
+            min[i] = std::min(center[i] - radius, other.center[i] - other.radius);
+            max[i] = std::max(center[i] + radius, other.center[i] + other.radius);
+        }
+
+        rush::Vec3f result((min[0] + max[0]) / 2.0f, (min[1] + max[1]) / 2.0f, (min[2] + max[2]) / 2.0f);
+        float resultRadius = std::max(distance(result, center) + radius, distance(result, other.center) + other.radius);
+        return {result, resultRadius};
+    }
+} // namespace neon
@@ -0,0 +1,38 @@
+#ifndef NEON_BOUNDINGSPHERE_H
+#define NEON_BOUNDINGSPHERE_H
+
+#include <vector>
+
+#include <rush/rush.h>
+
+namespace neon
+{
+    /**
+     * A sphere containing a set of points.
+     * Used as the bounding volume of models when culling their instances.
+     */
+    struct BoundingSphere
+    {
+        rush::Vec3f center;
+        float radius;
+
+        /**
+         * Creates a sphere containing all the given points.
+         * <p>
+         * The center of the sphere is the center of the points' axis-aligned box.
+         * The result is not the minimal sphere, but it is always conservative.
+         *
+         * @param points the points.
+         * @return the sphere. An empty list results in a sphere of radius 0 at the origin.
+         */
+        static BoundingSphere fromPoints(const std::vector<rush::Vec3f>& points);
+
+        /**
+         * Creates the smallest sphere centered in the center of both spheres' box
+         * that contains both spheres.
+         */
+        [[nodiscard]] BoundingSphere merge(const BoundingSphere& other) const;
+    };
+} // namespace neon
+
+#endif // NEON_BOUNDINGSPHERE_H
@@ -160,19 +160,21 @@ namespace neon
         rush::Vec3f r2 = vp.row(2);
         rush::Vec3f r3 = vp.row(3);
 
+        // The distance terms are taken from the fourth column of each row.
+        // Vulkan's depth goes from 0 to 1: the near plane is r2 alone.
         return {
             // Left Plane: r3 + r0
-            rush::Plane<float>(r3 + r0, vp(3, 3) + vp(3, 0)).normalized(),
+            rush::Plane<float>(r3 + r0, vp(3, 3) + vp(0, 3)).normalized(),
             // Right Plane: r3 - r0
-            rush::Plane<float>(r3 - r0, vp(3, 3) - vp(3, 0)).normalized(),
+            rush::Plane<float>(r3 - r0, vp(3, 3) - vp(0, 3)).normalized(),
             // Bottom Plane: r3 + r1
-            rush::Plane<float>(r3 + r1, vp(3, 3) + vp(3, 1)).normalized(),
+            rush::Plane<float>(r3 + r1, vp(3, 3) + vp(1, 3)).normalized(),
             // Top Plane: r3 - r1
-            rush::Plane<float>(r3 - r1, vp(3, 3) - vp(3, 1)).normalized(),
-            // Near Plane: r3 + r2
-            rush::Plane<float>(r3 + r2, vp(3, 3) + vp(3, 2)).normalized(),
+            rush::Plane<float>(r3 - r1, vp(3, 3) - vp(1, 3)).normalized(),
+            // Near Plane: r2
+            rush::Plane<float>(r2, vp(2, 3)).normalized(),
             // Far Plane: r3 - r2
-            rush::Plane<float>(r3 - r2, vp(3, 3) - vp(3, 2)).normalized(),
+            rush::Plane<float>(r3 - r2, vp(3, 3) - vp(2, 3)).normalized(),
         };
     }
 } // namespace neon
@@ -62,6 +62,13 @@ namespace neon
 
         const rush::Mat4f& getViewProjection();
 
+        /**
+         * Returns the planes of this camera's frustum in world space, in the order
+         * left, right, bottom, top, near and far.
+         * <p>
+         * The normals point inside the frustum: a point p is inside a plane
+         * when dot(normal, p) + distance >= 0.
+         */
         std::array<rush::Plane<float>, 6> getPlanes();
     };
 } // namespace neon
@@ -5,6 +5,8 @@
 #ifndef RVTRACKING_TRANSFORM_H
 #define RVTRACKING_TRANSFORM_H
 
+#include <cstdint>
+
 #include <rush/rush.h>
 
 #include <neon/structure/IdentifiableWrapper.h>
@@ -14,29 +16,46 @@ namespace neon
 
     class GameObject;
 
+    class TransformHierarchy;
+
+    /**
+     * The position, rotation and scale of a game object.
+     * <p>
+     * The model and normal matrices are stored inside the
+     * TransformHierarchy of the room and returned by value.
+     * <p>
+     * The returned matrices are the ones calculated by the last update of the hierarchy,
+     * which rooms run once per frame before pre-drawing their components.
+     * Modifications are visible one frame later to components reading the matrices
+     * during their update. Use refresh() when fresh values are required.
+     * <p>
+     * Reading a matrix does not lock: matrices may be read concurrently by several threads,
+     * such as by components updated in parallel.
+     */
     class Transform
     {
-        uint64_t _id;
+        friend class GameObject;
+        friend class TransformHierarchy;
 
         rush::Vec3f _position;
         rush::Quatf _rotation;
         rush::Vec3f _scale;
 
         IdentifiableWrapper<GameObject> _gameObject;
-        uint64_t _parentIdOnLastRefresh;
 
-        bool _dirty;
-        rush::Mat4f _localModel;
-        rush::Mat4f _localNormal;
-        rush::Mat4f _model;
-        rush::Mat4f _normal;
+        TransformHierarchy* _hierarchy;
+        uint32_t _node;
+
+        void markChanged();
 
-        void recalculateIfRequired();
+        void markParentChanged();
 
       public:
         Transform(const Transform& other) = delete;
 
-        explicit Transform(IdentifiableWrapper<GameObject> object);
+        Transform(IdentifiableWrapper<GameObject> object, TransformHierarchy& hierarchy);
+
+        ~Transform();
 
         [[nodiscard]] IdentifiableWrapper<GameObject> getGameObject() const;
 
@@ -58,9 +77,38 @@ namespace neon
 
         const rush::Quatf& rotate(const rush::Vec3f& direction, float angle);
 
-        const rush::Mat4f& getModel();
-
-        const rush::Mat4f& getNormal();
+        /**
+         * @return the model matrix calculated by the last update of the hierarchy.
+         */
+        [[nodiscard]] rush::Mat4f getModel() const;
+
+        /**
+         * @return the normal matrix calculated by the last update of the hierarchy.
+         */
+        [[nodiscard]] rush::Mat4f getNormal() const;
+
+        /**
+         * Returns the version of the model and normal matrices.
+         * <p>
+         * The version changes every time the matrices are recalculated,
+         * including when the transform of a parent changes.
+         * Several transforms may share the same version.
+         * Use it to detect whether the matrices have changed since the last time
+         * they were read. Versions are never 0.
+         *
+         * @return the version of the matrices calculated by the last update of the hierarchy.
+         */
+        [[nodiscard]] uint64_t getVersion() const;
+
+        /**
+         * Recalculates the matrices of the modified transforms inside the tree of this transform,
+         * from its root to its leaves.
+         * <p>
+         * Trees may be refreshed concurrently as long as no other thread
+         * reads or modifies the refreshed tree at the same time.
+         * This method must not run concurrently with the update of the hierarchy.
+         */
+        void refresh();
     };
 } // namespace neon
 
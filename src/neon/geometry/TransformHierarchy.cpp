@@ -0,0 +1,378 @@
+#include "TransformHierarchy.h"
+
+#include <neon/geometry/Transform.h>
+#include <neon/structure/GameObject.h>
+#include <neon/util/task/TaskRunner.h>
+
+namespace neon
+{
+    namespace
+    {
+        /**
+         * Multiplies two column-major 4x4 matrices.
+         * Each column is computed as a linear combination of four columns:
+         * the compiler vectorizes the inner loops.
+         */
+        void multiply(const rush::Mat4f& left, const rush::Mat4f& right, rush::Mat4f& result)
+        {
+            auto* a = reinterpret_cast<const float*>(&left);
+            auto* b = reinterpret_cast<const float*>(&right);
+            auto* out = reinterpret_cast<float*>(&result);
+
+            for (size_t c = 0; c < 4; ++c) {
+                float column[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+                for (size_t k = 0; k < 4; ++k) {
+                    const float scalar = b[c * 4 + k];
+                    for (size_t r = 0; r < 4; ++r) {
+                        column[r] += a[k * 4 + r] * scalar;
+                    }
+                }
+                for (size_t r = 0; r < 4; ++r) {
+                    out[c * 4 + r] = column[r];
+                }
+            }
+        }
+    } // namespace
+
+    TransformHierarchy::TransformHierarchy() :
+        _generation(0),
+        _removed(0),
+        _chunksChanged(false),
+        _pending(false)
+    {
+    }
+
+    uint32_t TransformHierarchy::add(Transform* transform)
+    {
+        // New transforms are roots: they are appended at the end.
+        auto node = static_cast<uint32_t>(_transforms.size());
+        _transforms.push_back(transform);
+        _parents.push_back(NO_PARENT);
+        _sizes.push_back(1);
+        _changed.push_back(1);
+        _localStale.push_back(1);
+        _versions.push_back(0);
+        _parentVersions.push_back(0);
+        _localModels.emplace_back(1.0f);
+        _localNormals.emplace_back(1.0f);
+        _models.emplace_back(1.0f);
+        _normals.emplace_back(1.0f);
+
+        _chunksChanged = true;
+        _pending.store(true, std::memory_order_relaxed);
+        return node;
+    }
+
+    void TransformHierarchy::remove(uint32_t node)
+    {
+        // The children become roots. They stay inside the range of the node:
+        // a range may contain roots, and they are only moved if they get a new parent.
+        size_t end = node + _sizes[node];
+        for (size_t child = node + 1; child < end; child += _sizes[child]) {
+            if (_transforms[child] != nullptr && _parents[child] == node) {
+                _parents[child] = NO_PARENT;
+                _changed[child] = 1;
+            }
+        }
+
+        // The node is discarded on the next compaction.
+        _transforms[node] = nullptr;
+        ++_removed;
+        _pending.store(true, std::memory_order_relaxed);
+    }
+
+    void TransformHierarchy::markChanged(uint32_t node)
+    {
+        _changed[node] = 1;
+        _localStale[node] = 1;
+        _pending.store(true, std::memory_order_relaxed);
+    }
+
+    void TransformHierarchy::markParentChanged(uint32_t node)
+    {
+        _changed[node] = 1;
+        _pending.store(true, std::memory_order_relaxed);
+
+        size_t end = node + _sizes[node];
+        auto parentObject = _transforms[node]->_gameObject->getParent();
+        if (parentObject == nullptr) {
+            if (_parents[node] != NO_PARENT) {
+                relocate(node, node, nullptr);
+            }
+            return;
+        }
+
+        Transform* parentTransform = &parentObject->getTransform();
+        if (parentTransform->_node >= node && parentTransform->_node < end) {
+            // The new parent is inside the range of the node. Cycles are not supported:
+            // it must belong to a root placed inside the range, which is moved out first.
+            uint32_t root = parentTransform->_node;
+            while (root != node && _parents[root] != NO_PARENT) {
+                root = _parents[root];
+            }
+            if (root == node) {
+                return;
+            }
+            relocate(root, root, nullptr);
+        }
+
+        uint32_t root = parentTransform->_node;
+        while (_parents[root] != NO_PARENT) {
+            root = _parents[root];
+        }
+
+        // The tree of the new parent is moved along with the subtree.
+        relocate(root, node, parentTransform);
+    }
+
+    void TransformHierarchy::refreshTree(uint32_t node)
+    {
+        uint32_t root = node;
+        while (_parents[root] != NO_PARENT) {
+            root = _parents[root];
+        }
+        updateRange(root, root + _sizes[root], _generation.fetch_add(1, std::memory_order_relaxed) + 1);
+    }
+
+    void TransformHierarchy::recalculateLocal(uint32_t node)
+    {
+        auto* transform = _transforms[node];
+        _localModels[node] = rush::Mat4f::model(transform->_scale, transform->_rotation, transform->_position);
+        _localNormals[node] = rush::Mat4f::normal(transform->_scale, transform->_rotation);
+        _localStale[node] = 0;
+    }
+
+    void TransformHierarchy::appendSlot(uint32_t from, uint32_t parent)
+    {
+        auto node = static_cast<uint32_t>(_transforms.size());
+        _transforms.push_back(_transforms[from]);
+        _parents.push_back(parent);
+        _sizes.push_back(1);
+        _changed.push_back(_changed[from]);
+        _localStale.push_back(_localStale[from]);
+        _versions.push_back(_versions[from]);
+        _parentVersions.push_back(_parentVersions[from]);
+        _localModels.push_back(_localModels[from]);
+        _localNormals.push_back(_localNormals[from]);
+        _models.push_back(_models[from]);
+        _normals.push_back(_normals[from]);
+        _transforms[node]->_node = node;
+    }
+
+    void TransformHierarchy::copySlot(uint32_t from, uint32_t to)
+    {
+        _transforms[to] = _transforms[from];
+        _changed[to] = _changed[from];
+        _localStale[to] = _localStale[from];
+        _versions[to] = _versions[from];
+        _parentVersions[to] = _parentVersions[from];
+        _localModels[to] = _localModels[from];
+        _localNormals[to] = _localNormals[from];
+        _models[to] = _models[from];
+        _normals[to] = _normals[from];
+        _transforms[to]->_node = to;
+    }
+
+    void TransformHierarchy::relocate(uint32_t root, uint32_t subtree, Transform* parent)
+    {
+        // Visits the moved slots in their new order: the tree of the root,
+        // with the subtree placed after the last slot of the parent's range.
+        // Tombstones and other roots inside the ranges are skipped along with their ranges: they stay in place.
+        size_t insertion = parent == nullptr ? 0 : parent->_node + _sizes[parent->_node];
+        auto visit = [&](auto&& consumer) {
+            auto visitRange = [&](size_t from, size_t to, size_t first) {
+                for (size_t node = from; node < to;) {
+                    bool stays = _transforms[node] == nullptr || _parents[node] == NO_PARENT || node == subtree;
+                    if (node != first && stays) {
+                        node += _sizes[node];
+                    } else {
+                        consumer(node);
+                        ++node;
+                    }
+                }
+            };
+
+            if (parent == nullptr) {
+                visitRange(subtree, subtree + _sizes[subtree], subtree);
+                return;
+            }
+
+            visitRange(root, insertion, root);
+            visitRange(subtree, subtree + _sizes[subtree], subtree);
+            visitRange(insertion, root + _sizes[root], root);
+        };
+
+        auto start = static_cast<uint32_t>(_transforms.size());
+        visit([&](size_t node) {
+            // Parents are placed before their children: their new indices are already known.
+            uint32_t newParent = NO_PARENT;
+            if (node == subtree) {
+                newParent = parent == nullptr ? NO_PARENT : parent->_node;
+            } else if (_parents[node] != NO_PARENT) {
+                newParent = _transforms[_parents[node]]->_node;
+            }
+            appendSlot(static_cast<uint32_t>(node), newParent);
+        });
+
+        visit([&](size_t node) {
+            _transforms[node] = nullptr;
+            ++_removed;
+        });
+
+        // The moved slots only contain whole subtrees.
+
+        for (size_t node = _transforms.size() - 1; node > start; --node) {
+            _sizes[_parents[node]] += _sizes[node];
+        }
+
+        _chunksChanged = true;
+    }
+
+    void TransformHierarchy::compact()
+    {
+        // The new index of each slot is the amount of alive slots before it.
+        std::vector<uint32_t> remap(_transforms.size() + 1);
+        uint32_t alive = 0;
+        for (size_t node = 0; node < _transforms.size(); ++node) {
+            remap[node] = alive;
+            if (_transforms[node] != nullptr) {
+                ++alive;
+            }
+        }
+        remap[_transforms.size()] = alive;
+
+        for (size_t node = 0; node < _transforms.size(); ++node) {
+            if (_transforms[node] == nullptr) {
+                continue;
+            }
+            uint32_t to = remap[node];
+            uint32_t size = remap[node + _sizes[node]] - to;
+            _parents[to] = _parents[node] == NO_PARENT ? NO_PARENT : remap[_parents[node]];
+            _sizes[to] = size;
+            copySlot(static_cast<uint32_t>(node), to);
+        }
+
+        _transforms.resize(alive);
+        _parents.resize(alive);
+        _sizes.resize(alive);
+        _changed.resize(alive);
+        _localStale.resize(alive);
+        _versions.resize(alive);
+        _parentVersions.resize(alive);
+        _localModels.resize(alive);
+        _localNormals.resize(alive);
+        _models.resize(alive);
+        _normals.resize(alive);
+
+        _removed = 0;
+        _chunksChanged = true;
+    }
+
+    void TransformHierarchy::rebuildChunks()
+    {
+        _chunks.clear();
+        size_t chunkStart = 0;
+
+        // Ranges of roots and tombstones are never split.
+        for (size_t node = 0; node < _transforms.size();) {
+            node += _sizes[node];
+            if (node - chunkStart >= CHUNK_NODES) {
+                _chunks.emplace_back(chunkStart, node);
+                chunkStart = node;
+            }
+        }
+
+        if (chunkStart < _transforms.size()) {
+            _chunks.emplace_back(chunkStart, _transforms.size());
+        }
+
+        _chunksChanged = false;
+    }
+
+    void TransformHierarchy::prepareUpdate()
+    {
+        if (_removed >= MIN_COMPACTION_NODES && _removed * 4 >= _transforms.size()) {
+            compact();
+        }
+        if (_chunksChanged) {
+            rebuildChunks();
+        }
+    }
+
+    void TransformHierarchy::updateRange(size_t from, size_t to, uint64_t version)
+    {
+        for (size_t node = from; node < to; ++node) {
+            if (_transforms[node] == nullptr) {
+                continue;
+            }
+
+            uint32_t parent = _parents[node];
+            uint64_t parentVersion = parent == NO_PARENT ? 0 : _versions[parent];
+
+            if (!_changed[node] && _parentVersions[node] == parentVersion) {
+                continue;
+            }
+
+            if (_localStale[node]) {
+                recalculateLocal(static_cast<uint32_t>(node));
+            }
+
+            if (parent == NO_PARENT) {
+                _models[node] = _localModels[node];
+                _normals[node] = _localNormals[node];
+            } else {
+                multiply(_models[parent], _localModels[node], _models[node]);
+                multiply(_normals[parent], _localNormals[node], _normals[node]);
+            }
+
+            _parentVersions[node] = parentVersion;
+            _versions[node] = version;
+            _changed[node] = 0;
+        }
+    }
+
+    size_t TransformHierarchy::size() const
+    {
+        return _transforms.size() - _removed;
+    }
+
+    bool TransformHierarchy::hasPendingChanges() const
+    {
+        return _pending.load(std::memory_order_relaxed);
+    }
+
+    void TransformHierarchy::update(TaskRunner& runner)
+    {
+        prepareUpdate();
+
+        if (!_pending.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        // All nodes updated in this pass share the same version:
+        // it only has to be different from the previous ones.
+        uint64_t version = _generation.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (_chunks.size() > 1) {
+            runner.parallelFor(0, _chunks.size(), 1, [this, version](size_t chunk) {
+                auto [from, to] = _chunks[chunk];
+                updateRange(from, to, version);
+            });
+        } else {
+            updateRange(0, _transforms.size(), version);
+        }
+
+        _pending.store(false, std::memory_order_relaxed);
+    }
+
+    void TransformHierarchy::update()
+    {
+        prepareUpdate();
+
+        if (!_pending.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        updateRange(0, _transforms.size(), _generation.fetch_add(1, std::memory_order_relaxed) + 1);
+        _pending.store(false, std::memory_order_relaxed);
+    }
+} // namespace neon
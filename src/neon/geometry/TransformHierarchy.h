@@ -0,0 +1,134 @@
+#ifndef NEON_TRANSFORMHIERARCHY_H
+#define NEON_TRANSFORMHIERARCHY_H
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <rush/rush.h>
+
+namespace neon
+{
+    class Transform;
+
+    class TaskRunner;
+
+    /**
+     * Stores the matrices of all transforms inside a room.
+     * <p>
+     * Matrices are stored in flat arrays, one per property,
+     * in hierarchical pre-order: parents are always placed before their children
+     * and each subtree is contiguous. Dirty subtrees are updated once
+     * per frame by update() in a linear pass, where each root can be processed in parallel.
+     * <p>
+     * Reading a matrix is a plain memory read: transforms return the matrices
+     * calculated by the last update. Modifications are visible after the next update,
+     * one frame later. Callers that need fresh values may refresh the tree
+     * of a transform using Transform::refresh().
+     * <p>
+     * Structural changes are incremental. New transforms are appended at the end of the arrays.
+     * Removed transforms leave tombstones that are compacted in batches. When the parent of a transform
+     * changes, only its subtree and the tree of its new parent are moved.
+     */
+    class TransformHierarchy
+    {
+        friend class Transform;
+
+      public:
+        static constexpr uint32_t NO_PARENT = std::numeric_limits<uint32_t>::max();
+
+        /**
+         * The minimum amount of nodes processed by a single task in update().
+         */
+        static constexpr size_t CHUNK_NODES = 4096;
+
+        /**
+         * The minimum amount of tombstones compacted by update().
+         * Tombstones are compacted once they fill a quarter of the arrays.
+         */
+        static constexpr size_t MIN_COMPACTION_NODES = 1024;
+
+      private:
+        std::vector<Transform*> _transforms;
+        std::vector<uint32_t> _parents;
+        // Slots of the range of each node, including tombstones.
+        std::vector<uint32_t> _sizes;
+        std::vector<uint8_t> _changed;
+        std::vector<uint8_t> _localStale;
+        std::vector<uint64_t> _versions;
+        std::vector<uint64_t> _parentVersions;
+        std::vector<rush::Mat4f> _localModels;
+        std::vector<rush::Mat4f> _localNormals;
+        std::vector<rush::Mat4f> _models;
+        std::vector<rush::Mat4f> _normals;
+
+        // Ranges of nodes containing whole subtrees.
+        std::vector<std::pair<size_t, size_t>> _chunks;
+
+        std::atomic_uint64_t _generation;
+        size_t _removed;
+        bool _chunksChanged;
+        std::atomic_bool _pending;
+
+        uint32_t add(Transform* transform);
+
+        void remove(uint32_t node);
+
+        void markChanged(uint32_t node);
+
+        void markParentChanged(uint32_t node);
+
+        void refreshTree(uint32_t node);
+
+        void recalculateLocal(uint32_t node);
+
+        void appendSlot(uint32_t from, uint32_t parent);
+
+        void copySlot(uint32_t from, uint32_t to);
+
+        void relocate(uint32_t root, uint32_t subtree, Transform* parent);
+
+        void compact();
+
+        void rebuildChunks();
+
+        void prepareUpdate();
+
+        void updateRange(size_t from, size_t to, uint64_t version);
+
+      public:
+        TransformHierarchy(const TransformHierarchy& other) = delete;
+
+        TransformHierarchy();
+
+        /**
+         * @return the amount of transforms inside this hierarchy.
+         */
+        [[nodiscard]] size_t size() const;
+
+        /**
+         * @return whether any transform has been modified since the last update.
+         */
+        [[nodiscard]] bool hasPendingChanges() const;
+
+        /**
+         * Recalculates the matrices of all modified transforms and their children.
+         * <p>
+         * Rooms invoke this method once per frame before pre-drawing their components.
+         * Reads during the update of the components return the matrices of the previous frame.
+         *
+         * @param runner the task runner used to update independent subtrees in parallel.
+         */
+        void update(TaskRunner& runner);
+
+        /**
+         * Recalculates the matrices of all modified transforms and their children
+         * in the current thread.
+         */
+        void update();
+    };
+} // namespace neon
+
+#endif // NEON_TRANSFORMHIERARCHY_H
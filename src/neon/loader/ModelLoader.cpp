@@ -195,6 +195,8 @@ namespace neon
     {
         ModelCreateInfo info;
         info.maximumInstances = json.value("maximum_instances", info.maximumInstances);
+        info.initialInstanceCapacity = json.value("initial_instance_capacity", info.initialInstanceCapacity);
+        info.instanceShrinkDelay = json.value("instance_shrink_delay", info.instanceShrinkDelay);
         info.uniformDescriptor = getAsset<ShaderUniformDescriptor>(json["uniform_descriptor"], context);
         info.shouldAutoFlush = json.value("auto_flush", info.shouldAutoFlush);
 
@@ -5,13 +5,14 @@
 #include "ShaderProgramLoader.h"
 
 #include <neon/filesystem/FileSystem.h>
+#include <neon/loader/AssetLoaderHelpers.h>
 #include <neon/logging/Logger.h>
 #include <neon/structure/Application.h>
 
 namespace neon
 {
-    std::shared_ptr<ShaderProgram> ShaderProgramLoader::loadAsset(std::string name, nlohmann::json json,
-                                                                  AssetLoaderContext context)
+    std::shared_ptr<ShaderProgram> ShaderProgramLoader::createProgram(std::string name, nlohmann::json json,
+                                                                      const AssetLoaderContext& context)
     {
         constexpr std::array TYPES = {ShaderType::VERTEX, ShaderType::FRAGMENT, ShaderType::GEOMETRY, ShaderType::TASK,
                                       ShaderType::MESH};
@@ -44,15 +45,100 @@ namespace neon
             }
         }
 
-        auto fileSystem = context.fileSystem;
+        return shader;
+    }
+
+    IncluderCreateInfo ShaderProgramLoader::createIncluderInfo(const AssetLoaderContext& context)
+    {
         auto parentPath = context.path.has_value() ? context.path.value().parent_path() : std::filesystem::path();
+        return IncluderCreateInfo{context.fileSystem, parentPath};
+    }
 
-        IncluderCreateInfo info{fileSystem, parentPath};
-        if (auto result = shader->compile(info); result.has_value()) {
+    std::shared_ptr<ShaderProgram> ShaderProgramLoader::loadAsset(std::string name, nlohmann::json json,
+                                                                  AssetLoaderContext context)
+    {
+        auto shader = createProgram(std::move(name), std::move(json), context);
+        if (auto result = shader->compile(createIncluderInfo(context)); result.has_value()) {
             logger.error(result.value());
             return nullptr;
         }
 
         return shader;
     }
+
+    std::vector<std::shared_ptr<ShaderProgram>> ShaderProgramLoader::loadFiles(
+        const std::vector<std::filesystem::path>& paths, const AssetLoaderContext& context)
+    {
+        std::vector<std::shared_ptr<ShaderProgram>> programs(paths.size());
+        if (context.fileSystem == nullptr) {
+            return programs;
+        }
+
+        struct Pending
+        {
+            size_t index;
+            AssetLoaderContext context;
+            AssetGeneralProperties<ShaderProgram> properties;
+        };
+
+        std::vector<Pending> pending;
+        std::vector<std::shared_ptr<ShaderProgram>> toCompile;
+        std::vector<IncluderCreateInfo> includers;
+
+        for (size_t i = 0; i < paths.size(); ++i) {
+            auto fileContext = context;
+            fileContext.path = context.path.has_value() ? context.path.value().parent_path() / paths[i] : paths[i];
+
+            auto file = context.fileSystem->readFile(fileContext.path.value());
+            if (!file.has_value()) {
+                logger.error(MessageBuilder().print("Shader program file not found: ").print(paths[i].string()));
+                continue;
+            }
+            auto json = file.value().toJson();
+            if (!json.has_value()) {
+                logger.error(MessageBuilder().print("Invalid shader program file: ").print(paths[i].string()));
+                continue;
+            }
+
+            auto properties = fetchGeneralProperties<ShaderProgram>(json.value(), fileContext);
+            if (properties.error.has_value()) {
+                logger.error(properties.error.value());
+                continue;
+            }
+            if (properties.present) {
+                programs[i] = properties.present;
+                continue;
+            }
+
+            programs[i] = createProgram(properties.name, json.value(), fileContext);
+            toCompile.push_back(programs[i]);
+            includers.push_back(createIncluderInfo(fileContext));
+            pending.push_back({i, std::move(fileContext), std::move(properties)});
+        }
+
+        auto tasks = ShaderProgram::compileAll(toCompile, includers);
+        auto& runner = context.application->getTaskRunner();
+
+        for (size_t j = 0; j < pending.size(); ++j) {
+            auto& [index, fileContext, properties] = pending[j];
+            std::optional<std::string> error;
+            if (tasks[j] == nullptr) {
+                // The TaskRunner has been stopped.
+                error = toCompile[j]->compile(includers[j]);
+            } else {
+                runner.waitAndHelp(*tasks[j]);
+                auto& result = tasks[j]->getResult();
+                error = result.has_value() ? result.value() : std::optional<std::string>("Compilation cancelled.");
+            }
+
+            if (error.has_value()) {
+                logger.error(error.value());
+                programs[index] = nullptr;
+                continue;
+            }
+            applyGeneralProperties(programs[index], properties, fileContext);
+        }
+
+        return programs;
+    }
 } // namespace neon
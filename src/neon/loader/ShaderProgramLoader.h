@@ -5,6 +5,9 @@
 #ifndef SHADERASSETLOADER_H
 #define SHADERASSETLOADER_H
 
+#include <filesystem>
+#include <vector>
+
 #include <neon/loader/AssetLoader.h>
 #include <neon/render/shader/ShaderProgram.h>
 
@@ -12,6 +15,11 @@ namespace neon
 {
     class ShaderProgramLoader : public AssetLoader<ShaderProgram>
     {
+        static std::shared_ptr<ShaderProgram> createProgram(std::string name, nlohmann::json json,
+                                                            const AssetLoaderContext& context);
+
+        static IncluderCreateInfo createIncluderInfo(const AssetLoaderContext& context);
+
       public:
         ShaderProgramLoader() = default;
 
@@ -19,6 +27,23 @@ namespace neon
 
         std::shared_ptr<ShaderProgram> loadAsset(std::string name, nlohmann::json json,
                                                  AssetLoaderContext context) override;
+
+        /**
+         * Loads the shader programs described by the given files,
+         * compiling them concurrently on the application's TaskRunner.
+         * <p>
+         * The calling thread waits once for all the compilations, helping the TaskRunner meanwhile.
+         * Load the shader programs of a material library using this method before loading its materials:
+         * materials read the reflection data of their programs as soon as they are loaded.
+         * Programs saved in the asset collection can be referenced by the materials using "A:name".
+         *
+         * @param paths the paths of the files, relative to the context's path.
+         * @param context the context used to load the files.
+         * @return the programs, in the same order as the paths.
+         * Programs that could not be loaded or compiled are null.
+         */
+        static std::vector<std::shared_ptr<ShaderProgram>> loadFiles(const std::vector<std::filesystem::path>& paths,
+                                                                     const AssetLoaderContext& context);
     };
 } // namespace neon
 
@@ -0,0 +1,111 @@
+#ifndef NEON_DRAWLIST_H
+#define NEON_DRAWLIST_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace neon
+{
+    class Drawable;
+
+    class Material;
+
+    class Model;
+
+    /**
+     * List of draw items sorted by material priority.
+     * <p>
+     * Items with a higher priority go first.
+     * Items with the same priority are grouped by material,
+     * and items with the same material keep their insertion order.
+     * <p>
+     * Each item stores the priority its material had when it was inserted.
+     * The list is never re-sorted unless setPriority() is called,
+     * so items can be inserted and removed without sorting the whole list.
+     */
+    class DrawList
+    {
+      public:
+        struct Item
+        {
+            Material* material;
+            Model* model;
+            Drawable* drawable;
+            int32_t priority;
+        };
+
+      private:
+        std::vector<Item> _items;
+
+        static bool goesBefore(const Item& a, const Item& b)
+        {
+            if (a.priority != b.priority) {
+                return a.priority > b.priority;
+            }
+            return std::less<Material*>()(a.material, b.material);
+        }
+
+      public:
+        [[nodiscard]] const std::vector<Item>& getItems() const
+        {
+            return _items;
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            return _items.empty();
+        }
+
+        /**
+         * Inserts the given item after all items that go before it or next to it.
+         */
+        void insert(const Item& item)
+        {
+            _items.insert(std::ranges::upper_bound(_items, item, goesBefore), item);
+        }
+
+        /**
+         * Removes all items of the given model.
+         *
+         * @param model the model.
+         * @param onRemoved the function invoked for each removed item.
+         */
+        template<typename Func>
+        void removeModel(const Model* model, Func&& onRemoved)
+        {
+            std::erase_if(_items, [&](const Item& item) {
+                if (item.model != model) {
+                    return false;
+                }
+                onRemoved(item);
+                return true;
+            });
+        }
+
+        /**
+         * Changes the priority of the items of the given material,
+         * moving them to their new position.
+         *
+         * @param material the material.
+         * @param priority the new priority.
+         */
+        void setPriority(const Material* material, int32_t priority)
+        {
+            bool changed = false;
+            for (auto& item : _items) {
+                if (item.material == material && item.priority != priority) {
+                    item.priority = priority;
+                    changed = true;
+                }
+            }
+
+            if (changed) {
+                std::ranges::stable_sort(_items, goesBefore);
+            }
+        }
+    };
+} // namespace neon
+
+#endif // NEON_DRAWLIST_H
@@ -0,0 +1,93 @@
+#include "FrustumCuller.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace neon
+{
+    FrustumCuller::FrustumCuller(const std::array<rush::Plane<float>, PLANES>& planes) :
+        _a(),
+        _b(),
+        _c(),
+        _d()
+    {
+        for (size_t p = 0; p < PLANES; ++p) {
+            _a[p] = planes[p].normal.x();
+            _b[p] = planes[p].normal.y();
+            _c[p] = planes[p].normal.z();
+            _d[p] = planes[p].distance;
+        }
+    }
+
+    bool FrustumCuller::isVisible(const BoundingSphere& sphere) const
+    {
+        for (size_t p = 0; p < PLANES; ++p) {
+            float distance = _a[p] * sphere.center[0] + _b[p] * sphere.center[1] + _c[p] * sphere.center[2] + _d[p];
+            if (distance < -sphere.radius) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t FrustumCuller::cull(const BoundingSphere& bounds, const void* transforms, size_t stride, size_t amount,
+                               std::vector<uint32_t>& visible) const
+    {
+        visible.clear();
+
+        const auto* bytes = static_cast<const char*>(transforms);
+        const float cx = bounds.center[0];
+        const float cy = bounds.center[1];
+        const float cz = bounds.center[2];
+
+        alignas(32) float x[BATCH_SIZE];
+        alignas(32) float y[BATCH_SIZE];
+        alignas(32) float z[BATCH_SIZE];
+        alignas(32) float radius[BATCH_SIZE];
+        alignas(32) uint32_t inside[BATCH_SIZE];
+
+        for (size_t first = 0; first < amount; first += BATCH_SIZE) {
+            size_t count = std::min(BATCH_SIZE, amount - first);
+
+            for (size_t i = 0; i < count; ++i) {
+                auto* m = reinterpret_cast<const float*>(bytes + (first + i) * stride);
+                x[i] = m[0] * cx + m[4] * cy + m[8] * cz + m[12];
+                y[i] = m[1] * cx + m[5] * cy + m[9] * cz + m[13];
+                z[i] = m[2] * cx + m[6] * cy + m[10] * cz + m[14];
+
+                float sx = m[0] * m[0] + m[1] * m[1] + m[2] * m[2];
+                float sy = m[4] * m[4] + m[5] * m[5] + m[6] * m[6];
+                float sz = m[8] * m[8] + m[9] * m[9] + m[10] * m[10];
+                radius[i] = bounds.radius * std::sqrt(std::max(sx, std::max(sy, sz)));
+            }
+
+            // Unused lanes are always outside.
+            for (size_t i = count; i < BATCH_SIZE; ++i) {
+                x[i] = y[i] = z[i] = 0.0f;
+                radius[i] = -std::numeric_limits<float>::infinity();
+            }
+
+            for (size_t i = 0; i < BATCH_SIZE; ++i) {
+                inside[i] = 1;
+            }
+
+            // Branchless loops: these are vectorized by the compiler.
+            for (size_t p = 0; p < PLANES; ++p) {
+                const float a = _a[p], b = _b[p], c = _c[p], d = _d[p];
+                for (size_t i = 0; i < BATCH_SIZE; ++i) {
+                    float distance = a * x[i] + b * y[i] + c * z[i] + d;
+                    inside[i] &= static_cast<uint32_t>(distance + radius[i] >= 0.0f);
+                }
+            }
+
+            for (size_t i = 0; i < count; ++i) {
+                if (inside[i]) {
+                    visible.push_back(static_cast<uint32_t>(first + i));
+                }
+            }
+        }
+
+        return visible.size();
+    }
+} // namespace neon
@@ -0,0 +1,67 @@
+#ifndef NEON_FRUSTUMCULLER_H
+#define NEON_FRUSTUMCULLER_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <rush/rush.h>
+
+#include <neon/geometry/BoundingSphere.h>
+
+namespace neon
+{
+    /**
+     * Tests bounding volumes against the six planes of a camera's frustum.
+     * <p>
+     * The planes are stored in structure-of-arrays layout and instances
+     * are tested in batches of BATCH_SIZE, so the compiler can
+     * test several instances at once using SIMD instructions.
+     */
+    class FrustumCuller
+    {
+      public:
+        static constexpr size_t PLANES = 6;
+        static constexpr size_t BATCH_SIZE = 8;
+
+      private:
+        // A point is inside a plane when a * x + b * y + c * z + d >= 0.
+        std::array<float, PLANES> _a;
+        std::array<float, PLANES> _b;
+        std::array<float, PLANES> _c;
+        std::array<float, PLANES> _d;
+
+      public:
+        /**
+         * Creates a culler using the given frustum planes.
+         *
+         * @param planes the planes of the camera's frustum, as returned by Camera::getPlanes().
+         */
+        explicit FrustumCuller(const std::array<rush::Plane<float>, PLANES>& planes);
+
+        /**
+         * @return whether the given sphere is at least partially inside the frustum.
+         */
+        [[nodiscard]] bool isVisible(const BoundingSphere& sphere) const;
+
+        /**
+         * Tests the instances of a model against the frustum.
+         * <p>
+         * The bounding sphere of the model is transformed by the model matrix
+         * of each instance. The radius is scaled by the largest scale of the matrix.
+         *
+         * @param bounds the bounding sphere of the model, in model space.
+         * @param transforms pointer to the model matrix of the first instance.
+         * Matrices must be column-major 4x4 float matrices.
+         * @param stride the distance in bytes between the model matrices of two consecutive instances.
+         * @param amount the amount of instances.
+         * @param visible the vector where the indices of the visible instances are written.
+         * Its previous content is discarded.
+         * @return the amount of visible instances.
+         */
+        size_t cull(const BoundingSphere& bounds, const void* transforms, size_t stride, size_t amount,
+                    std::vector<uint32_t>& visible) const;
+    };
+} // namespace neon
+
+#endif // NEON_FRUSTUMCULLER_H
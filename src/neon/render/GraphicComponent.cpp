@@ -16,12 +16,14 @@
 namespace neon
 {
     GraphicComponent::GraphicComponent() :
+        _uploadedTransformVersion(0),
         _firstPreDrawExecuted(false)
     {
     }
 
     GraphicComponent::GraphicComponent(std::shared_ptr<Model> model) :
         _model(std::move(model)),
+        _uploadedTransformVersion(0),
         _firstPreDrawExecuted(false)
     {
         if (_model != nullptr) {
@@ -54,11 +56,13 @@ namespace neon
                 _model->getInstanceData(0)->freeInstance(_modelTargetId.value());
             }
             if (_firstPreDrawExecuted) {
-                getRoom()->unmarkUsingModel(model.get());
+                getRoom()->unmarkUsingModel(_model.get());
             }
         }
 
         _model = model;
+        _modelTargetId = {};
+        _uploadedTransformVersion = 0;
 
         if (_model != nullptr) {
             if (_firstPreDrawExecuted) {
@@ -89,11 +93,19 @@ namespace neon
             return;
         }
 
+        // Static objects keep their uploaded data: only upload when the matrices change.
+        auto& transform = getGameObject()->getTransform();
+        uint64_t version = transform.getVersion();
+        if (version == _uploadedTransformVersion) {
+            return;
+        }
+        _uploadedTransformVersion = version;
+
         auto& types = _model->getInstanceData(0)->getInstancingStructTypes();
 
         const DefaultInstancingData data{
-            getGameObject()->getTransform().getModel(),
-            getGameObject()->getTransform().getNormal(),
+            transform.getModel(),
+            transform.getNormal(),
         };
 
         for (size_t i = 0; i < types.size(); ++i) {
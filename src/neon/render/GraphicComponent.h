@@ -18,6 +18,7 @@ namespace neon
     {
         std::shared_ptr<Model> _model;
         std::optional<InstanceData::Instance> _modelTargetId;
+        uint64_t _uploadedTransformVersion;
 
         bool _firstPreDrawExecuted;
 
@@ -5,7 +5,6 @@
 #include "Render.h"
 
 #include <utility>
-#include <set>
 #include <unordered_set>
 
 #include <neon/render/buffer/FrameBuffer.h>
@@ -61,21 +60,11 @@ namespace neon
             return;
         }
 
-        std::set<std::shared_ptr<Material>> materials;
-        for (const auto& model : room->usedModels() | std::views::keys) {
-            for (size_t i = 0; i < model->getMeshesAmount(); ++i) {
-                for (const auto& material : model->getDrawable(i)->getMaterials()) {
-                    materials.insert(material);
-                }
-            }
-        }
-
-        std::vector sortedMaterials(materials.begin(), materials.end());
-        std::ranges::sort(sortedMaterials,
-                          [](const auto& a, const auto& b) { return a->getPriority() > b->getPriority(); });
+        // The room's render queue has been refreshed in Room::preDraw().
+        auto& materials = room->getRenderQueue().getSortedMaterials();
 
         for (const auto& strategy : _strategies) {
-            strategy.strategy->render(room, this, sortedMaterials);
+            strategy.strategy->render(room, this, materials);
         }
     }
 
@@ -41,13 +41,8 @@ namespace neon
     {
         render->beginRenderPass(_frameBuffer);
         if (room != nullptr) {
-            for (const auto& material : materials) {
-                if (material->getTarget() != _frameBuffer) {
-                    continue;
-                }
-                for (const auto& [model, amount] : room->usedModels()) {
-                    model->draw(material.get());
-                }
+            for (const auto& item : room->getRenderQueue().getItems(_frameBuffer.get())) {
+                item.model->draw(item.material, item.drawable);
             }
         }
         render->endRenderPass();
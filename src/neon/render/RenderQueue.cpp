@@ -0,0 +1,142 @@
+#include "RenderQueue.h"
+
+#include <algorithm>
+#include <ranges>
+#include <utility>
+
+#include <neon/render/model/Model.h>
+#include <neon/render/shader/Material.h>
+
+namespace neon
+{
+    std::atomic_uint64_t RenderQueue::GENERATION = 0;
+
+    void RenderQueue::insertItems(Model* model, std::vector<uint64_t>& versions)
+    {
+        versions.clear();
+        versions.reserve(model->getMeshesAmount());
+        for (size_t i = 0; i < model->getMeshesAmount(); ++i) {
+            Drawable* drawable = model->getDrawable(i);
+            versions.push_back(drawable->getMaterialsVersion());
+            for (const auto& material : std::as_const(*drawable).getMaterials()) {
+                acquireMaterial(material);
+                int32_t priority = _materials[material.get()].priority;
+                _lists[material->getTarget().get()].insert({material.get(), model, drawable, priority});
+            }
+        }
+    }
+
+    void RenderQueue::removeItems(Model* model)
+    {
+        for (auto& list : _lists | std::views::values) {
+            list.removeModel(model, [this](const DrawItem& item) { releaseMaterial(item.material); });
+        }
+        std::erase_if(_lists, [](const auto& entry) { return entry.second.empty(); });
+    }
+
+    void RenderQueue::acquireMaterial(const std::shared_ptr<Material>& material)
+    {
+        auto [it, inserted] =
+            _materials.try_emplace(material.get(), MaterialEntry{material, 0, material->getPriority()});
+        ++it->second.uses;
+        if (!inserted) {
+            return;
+        }
+
+        // Materials with the same priority keep their insertion order.
+        auto position = std::ranges::upper_bound(_sortedMaterials, it->second.priority, std::greater(),
+                                                 [this](const auto& m) { return _materials[m.get()].priority; });
+        _sortedMaterials.insert(position, material);
+    }
+
+    void RenderQueue::releaseMaterial(Material* material)
+    {
+        auto it = _materials.find(material);
+        if (it == _materials.end() || --it->second.uses > 0) {
+            return;
+        }
+        _materials.erase(it);
+        std::erase_if(_sortedMaterials, [material](const auto& m) { return m.get() == material; });
+    }
+
+    void RenderQueue::refreshPriorities()
+    {
+        bool changed = false;
+        for (auto& [material, entry] : _materials) {
+            int32_t priority = material->getPriority();
+            if (entry.priority == priority) {
+                continue;
+            }
+            entry.priority = priority;
+            changed = true;
+            for (auto& list : _lists | std::views::values) {
+                list.setPriority(material, priority);
+            }
+        }
+
+        if (changed) {
+            std::ranges::stable_sort(_sortedMaterials, std::greater(),
+                                     [this](const auto& m) { return _materials[m.get()].priority; });
+        }
+    }
+
+    RenderQueue::RenderQueue() :
+        _generation(GENERATION.load(std::memory_order_relaxed))
+    {
+    }
+
+    void RenderQueue::invalidateAll()
+    {
+        GENERATION.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void RenderQueue::addModel(Model* model)
+    {
+        auto [it, inserted] = _models.try_emplace(model);
+        if (inserted) {
+            insertItems(model, it->second);
+        }
+    }
+
+    void RenderQueue::removeModel(Model* model)
+    {
+        if (_models.erase(model) > 0) {
+            removeItems(model);
+        }
+    }
+
+    void RenderQueue::refresh()
+    {
+        uint64_t generation = GENERATION.load(std::memory_order_relaxed);
+        if (generation == _generation) {
+            return;
+        }
+        _generation = generation;
+
+        refreshPriorities();
+
+        for (auto& [model, versions] : _models) {
+            bool changed = versions.size() != model->getMeshesAmount();
+            for (size_t i = 0; !changed && i < versions.size(); ++i) {
+                changed = versions[i] != model->getDrawable(i)->getMaterialsVersion();
+            }
+
+            if (changed) {
+                removeItems(model);
+                insertItems(model, versions);
+            }
+        }
+    }
+
+    const std::vector<RenderQueue::DrawItem>& RenderQueue::getItems(const FrameBuffer* target) const
+    {
+        static const std::vector<DrawItem> EMPTY;
+        auto it = _lists.find(target);
+        return it == _lists.end() ? EMPTY : it->second.getItems();
+    }
+
+    const std::vector<std::shared_ptr<Material>>& RenderQueue::getSortedMaterials() const
+    {
+        return _sortedMaterials;
+    }
+} // namespace neon
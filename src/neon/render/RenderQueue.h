@@ -0,0 +1,105 @@
+#ifndef NEON_RENDERQUEUE_H
+#define NEON_RENDERQUEUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <neon/render/DrawList.h>
+
+namespace neon
+{
+    class FrameBuffer;
+
+    /**
+     * List of the draw calls of a room, grouped by target frame buffer.
+     * <p>
+     * Each draw item is a (material, model, drawable) triplet.
+     * Items are sorted by material priority and grouped by material,
+     * so render pass strategies can draw them in a single linear pass.
+     * <p>
+     * The queue is patched, never rebuilt:
+     * adding or removing a model only inserts or removes the items of that model.
+     * When a drawable or a material changes, refresh() only patches the models
+     * of this queue whose drawables changed and only re-sorts
+     * the lists containing a material whose priority changed.
+     */
+    class RenderQueue
+    {
+      public:
+        using DrawItem = DrawList::Item;
+
+      private:
+        struct MaterialEntry
+        {
+            std::shared_ptr<Material> material;
+            uint32_t uses;
+            int32_t priority;
+        };
+
+        static std::atomic_uint64_t GENERATION;
+
+        // The materials version of each drawable of each model when its items were inserted.
+        std::unordered_map<Model*, std::vector<uint64_t>> _models;
+        std::unordered_map<const FrameBuffer*, DrawList> _lists;
+        std::unordered_map<Material*, MaterialEntry> _materials;
+        std::vector<std::shared_ptr<Material>> _sortedMaterials;
+        uint64_t _generation;
+
+        void insertItems(Model* model, std::vector<uint64_t>& versions);
+
+        void removeItems(Model* model);
+
+        void acquireMaterial(const std::shared_ptr<Material>& material);
+
+        void releaseMaterial(Material* material);
+
+        void refreshPriorities();
+
+      public:
+        RenderQueue(const RenderQueue& other) = delete;
+
+        RenderQueue();
+
+        /**
+         * Notifies all render queues that the materials of a drawable
+         * or the priority of a material may have changed.
+         * Each queue checks its own models and materials on its next refresh().
+         */
+        static void invalidateAll();
+
+        /**
+         * Adds the draw items of the given model.
+         */
+        void addModel(Model* model);
+
+        /**
+         * Removes the draw items of the given model.
+         */
+        void removeModel(Model* model);
+
+        /**
+         * Patches the queue if a drawable or a material has changed.
+         * Rooms invoke this method once per frame before rendering.
+         */
+        void refresh();
+
+        /**
+         * Returns the draw items targeting the given frame buffer,
+         * sorted by material priority.
+         *
+         * @param target the frame buffer.
+         * @return the draw items.
+         */
+        [[nodiscard]] const std::vector<DrawItem>& getItems(const FrameBuffer* target) const;
+
+        /**
+         * @return all materials used by the models of the queue, sorted by priority.
+         */
+        [[nodiscard]] const std::vector<std::shared_ptr<Material>>& getSortedMaterials() const;
+    };
+} // namespace neon
+
+#endif // NEON_RENDERQUEUE_H
@@ -4,32 +4,40 @@
 
 #include "BasicInstanceData.h"
 
+#include <algorithm>
+
 #include <neon/structure/Application.h>
+#include <neon/render/FrustumCuller.h>
 #include <neon/render/model/ModelCreateInfo.h>
 
 namespace neon
 {
     BasicInstanceData::BasicInstanceData(Application* application, const ModelCreateInfo& info) :
         _application(application),
-        _maximumInstances(info.maximumInstances),
+        _mergeThreshold(info.dirtyRangeMergeThreshold),
+        _capacity(info.initialInstanceCapacity, info.maximumInstances, info.instanceShrinkDelay),
         _types(info.instanceTypes),
-        _implementation(application, info)
+        _drawnInstances(0),
+        _compacted(false),
+        _implementation(application, info, _capacity.getCapacity())
     {
+        uint32_t capacity = _capacity.getCapacity();
         _slots.reserve(info.instanceTypes.size());
         for (size_t i = 0; i < info.instanceTypes.size(); ++i) {
             size_t size = info.instanceSizes[i];
-            char* data = new char[size * _maximumInstances];
-            _slots.emplace_back(size, data, Range<uint32_t>(0, 0));
+            char* data = new char[size * capacity];
+            _slots.push_back({size, data, DirtyRanges(capacity)});
+
+            if (!_transformSlot.has_value() && _types[i] == typeid(DefaultInstancingData) && size > 0) {
+                _transformSlot = i;
+            }
         }
     }
 
     BasicInstanceData::~BasicInstanceData()
     {
-        for (auto& [size, data, changeRange] : _slots) {
-            delete[] data;
-        }
-        for (auto* position : _positions) {
-            delete position;
+        for (auto& slot : _slots) {
+            delete[] slot.data;
         }
     }
 
@@ -38,29 +46,67 @@ namespace neon
         return _types;
     }
 
+    bool BasicInstanceData::reserve(size_t amount)
+    {
+        auto capacity = _capacity.computeRequired(amount);
+        if (!capacity.has_value()) {
+            return false;
+        }
+        if (*capacity != _capacity.getCapacity()) {
+            resize(*capacity);
+        }
+        return true;
+    }
+
+    void BasicInstanceData::resize(uint32_t capacity)
+    {
+        auto live = static_cast<uint32_t>(_instances.size());
+
+        for (auto& slot : _slots) {
+            char* data = new char[slot.size * capacity];
+            if (slot.size > 0 && live > 0) {
+                memcpy(data, slot.data, slot.size * live);
+            }
+            delete[] slot.data;
+            slot.data = data;
+
+            // The new GPU buffers are empty: all live instances must be uploaded again.
+            slot.changes = DirtyRanges(capacity);
+            slot.changes.mark(Range<uint32_t>(0, live));
+        }
+
+        _implementation.resize(capacity);
+        _capacity.setCapacity(capacity);
+        _compacted = false;
+    }
+
+    void BasicInstanceData::shrinkIfIdle()
+    {
+        if (auto capacity = _capacity.onFlush(_instances.size()); capacity.has_value()) {
+            resize(*capacity);
+        }
+    }
+
     Result<InstanceData::Instance, std::string> BasicInstanceData::createInstance()
     {
-        if (_positions.size() >= _maximumInstances) {
+        if (!reserve(_instances.size() + 1)) {
             return {"Buffer is full!"};
         }
 
-        auto* id = new uint32_t(static_cast<uint32_t>(_positions.size()));
-        _positions.push_back(id);
-        return Instance(id);
+        return _instances.create();
     }
 
     Result<std::vector<InstanceData::Instance>, std::string> BasicInstanceData::createMultipleInstances(size_t amount)
     {
-        if (_positions.size() + amount > _maximumInstances) {
+        if (!reserve(_instances.size() + amount)) {
             return {"Buffer is full!"};
         }
 
         std::vector<Instance> instances;
         instances.reserve(amount);
+        _instances.reserve(_instances.size() + amount);
         for (size_t i = 0; i < amount; ++i) {
-            auto* id = new uint32_t(static_cast<uint32_t>(_positions.size()));
-            _positions.push_back(id);
-            instances.emplace_back(id);
+            instances.push_back(_instances.create());
         }
 
         return std::move(instances);
@@ -68,78 +114,60 @@ namespace neon
 
     bool BasicInstanceData::freeInstance(Instance instance)
     {
-        const uint32_t id = *instance.id;
-        if (id >= _positions.size()) {
+        uint32_t index = _instances.remove(instance);
+        if (index == IndexTable::INVALID_INDEX) {
             return false;
         }
 
-        auto* toRemove = _positions[id];
-        auto* last = _positions.back();
-
-        for (auto& [size, data, changeRange] : _slots) {
-            if (size == 0) {
-                continue;
+        // The last instance has been moved to the freed index. Move its data too.
+        auto last = static_cast<uint32_t>(_instances.size());
+        if (index != last) {
+            for (auto& slot : _slots) {
+                if (slot.size == 0) {
+                    continue;
+                }
+                memcpy(slot.data + slot.size * index, slot.data + slot.size * last, slot.size);
+                slot.changes.mark(index);
             }
-            memcpy(data + size * id, data + size * *last, size);
-            changeRange += Range(id, id + 1);
         }
 
-        _positions[id] = last;
-        _positions.pop_back();
-        *last = id;
-
-        delete toRemove;
-
         return true;
     }
 
     size_t BasicInstanceData::freeInstances(const std::vector<Instance>& ids)
     {
         size_t freedCount = 0;
-        std::vector<uint32_t> removalIds;
-        removalIds.reserve(ids.size());
-
-        for (const auto& inst : ids) {
-            removalIds.push_back(*inst.id);
-        }
-        std::ranges::sort(removalIds, std::greater<uint32_t>());
-
-        for (uint32_t id : removalIds) {
-            if (id >= _positions.size()) {
-                continue;
-            }
-
-            auto* toRemove = _positions[id];
-            auto* last = _positions.back();
-
-            if (id != _positions.size() - 1) {
-                for (auto& [size, data, changeRange] : _slots) {
-                    if (size == 0) {
-                        continue;
-                    }
-                    memcpy(data + size * id, data + size * *last, size);
-                    changeRange += Range(id, id + 1);
-                }
+        for (auto& instance : ids) {
+            if (freeInstance(instance)) {
+                ++freedCount;
             }
-
-            _positions[id] = last;
-            _positions.pop_back();
-            *last = id;
-
-            delete toRemove;
-            ++freedCount;
         }
         return freedCount;
     }
 
     size_t BasicInstanceData::getInstanceAmount() const
     {
-        return _positions.size();
+        return _instances.size();
+    }
+
+    size_t BasicInstanceData::getDrawnInstanceAmount() const
+    {
+        return _compacted ? _drawnInstances : _instances.size();
     }
 
     size_t BasicInstanceData::getMaximumInstances() const
     {
-        return _maximumInstances;
+        return _capacity.getMaximum();
+    }
+
+    size_t BasicInstanceData::getInstanceCapacity() const
+    {
+        return _capacity.getCapacity();
+    }
+
+    size_t BasicInstanceData::getAllocatedMemory() const
+    {
+        return _capacity.getCapacity() * getBytesRequiredPerInstance() + _implementation.getAllocatedMemory();
     }
 
     size_t BasicInstanceData::getBytesRequiredPerInstance() const
@@ -153,7 +181,7 @@ namespace neon
 
     bool BasicInstanceData::uploadData(Instance instance, size_t index, const void* data)
     {
-        if (_slots.size() < index) {
+        if (_slots.size() <= index) {
             neon::error().group("vulkan") << "Cannot upload instance data. Slot " << index << " is not defined!";
             return false;
         }
@@ -163,16 +191,16 @@ namespace neon
             return false;
         }
 
-        uint32_t id = *instance.id;
+        uint32_t id = _instances.getIndex(instance);
 
-        if (id >= _positions.size()) {
-            neon::error().group("vulkan") << "Cannot upload instance data. Instance" << id << " is not valid!";
+        if (id == IndexTable::INVALID_INDEX) {
+            neon::error().group("vulkan") << "Cannot upload instance data. Instance" << instance.id << " is not valid!";
             return false;
         }
 
         memcpy(slot.data + slot.size * id, data, slot.size);
 
-        slot.changeRange += Range(id, id + 1);
+        slot.changes.mark(id);
 
         return true;
     }
@@ -184,11 +212,98 @@ namespace neon
 
     void BasicInstanceData::flush(const CommandBuffer* commandBuffer)
     {
+        shrinkIfIdle();
+
+        if (_compacted) {
+            // The GPU buffers hold the compacted instances.
+            // Upload the positions that don't hold their own instance.
+            auto amount = static_cast<uint32_t>(_instances.size());
+            auto uploaded = static_cast<uint32_t>(std::min<size_t>(_uploadedInstances.size(), amount));
+            for (auto& slot : _slots) {
+                for (uint32_t i = 0; i < uploaded; ++i) {
+                    if (_uploadedInstances[i] != i) {
+                        slot.changes.mark(i);
+                    }
+                }
+                slot.changes.mark(Range<uint32_t>(uploaded, amount));
+            }
+            _compacted = false;
+        }
+
         for (size_t i = 0; i < _slots.size(); ++i) {
             auto& slot = _slots[i];
-            _implementation.flush(commandBuffer, i, slot.size, slot.data, slot.changeRange);
-            slot.changeRange = Range<uint32_t>(0, 0);
+            slot.changes.collectRuns(_mergeThreshold, slot.runs);
+            _implementation.flush(commandBuffer, i, slot.size, slot.data, slot.runs);
+            slot.changes.clear();
+        }
+    }
+
+    bool BasicInstanceData::cull(const FrustumCuller& culler, const BoundingSphere& bounds,
+                                 std::vector<uint32_t>& visible) const
+    {
+        if (!_transformSlot.has_value()) {
+            return false;
         }
+
+        auto& transforms = _slots[_transformSlot.value()];
+        culler.cull(bounds, transforms.data, transforms.size, _instances.size(), visible);
+        return true;
+    }
+
+    bool BasicInstanceData::supportsCompaction() const
+    {
+        return true;
+    }
+
+    void BasicInstanceData::flushVisible(const CommandBuffer* commandBuffer, const std::vector<uint32_t>& visible)
+    {
+        if (visible.size() >= _instances.size()) {
+            // Nothing to compact.
+            flush(commandBuffer);
+            return;
+        }
+
+        // Shrinking keeps the instance indices: the visible list is still valid.
+        shrinkIfIdle();
+
+        // Position i of the GPU buffers holds the instance uploaded there in the last flush.
+        // After a full flush, that is instance i.
+        auto isOutdated = [this](uint32_t position, uint32_t instance) {
+            if (!_compacted) {
+                return position != instance;
+            }
+            return position >= _uploadedInstances.size() || _uploadedInstances[position] != instance;
+        };
+
+        for (size_t i = 0; i < _slots.size(); ++i) {
+            auto& slot = _slots[i];
+            if (slot.size == 0) {
+                slot.changes.clear();
+                continue;
+            }
+
+            if (slot.compactedChanges.capacity() != _capacity.getCapacity()) {
+                slot.compacted.resize(slot.size * _capacity.getCapacity());
+                slot.compactedChanges = DirtyRanges(_capacity.getCapacity());
+            }
+
+            for (uint32_t position = 0; position < visible.size(); ++position) {
+                uint32_t instance = visible[position];
+                if (isOutdated(position, instance) || slot.changes.isMarked(instance)) {
+                    memcpy(slot.compacted.data() + slot.size * position, slot.data + slot.size * instance, slot.size);
+                    slot.compactedChanges.mark(position);
+                }
+            }
+
+            slot.compactedChanges.collectRuns(_mergeThreshold, slot.runs);
+            _implementation.flush(commandBuffer, i, slot.size, slot.compacted.data(), slot.runs);
+            slot.compactedChanges.clear();
+            slot.changes.clear();
+        }
+
+        _uploadedInstances.assign(visible.begin(), visible.end());
+        _drawnInstances = visible.size();
+        _compacted = true;
     }
 
     InstanceData::Implementation& BasicInstanceData::getImplementation()
@@ -5,7 +5,12 @@
 #ifndef BASICINSTANCEDATA_H
 #define BASICINSTANCEDATA_H
 
+#include <optional>
+
+#include <neon/render/model/InstanceCapacity.h>
 #include <neon/render/model/InstanceData.h>
+#include <neon/util/DirtyRanges.h>
+#include <neon/util/IndexTable.h>
 #include <neon/util/Range.h>
 
 #ifdef USE_VULKAN
@@ -36,17 +41,39 @@ namespace neon
         {
             size_t size;
             char* data;
-            Range<uint32_t> changeRange;
+            DirtyRanges changes;
+            std::vector<Range<uint32_t>> runs;
+
+            // Copy of the data uploaded while culling, laid out like the GPU buffer: visible instances only.
+            std::vector<char> compacted;
+            DirtyRanges compactedChanges;
         };
 
         Application* _application;
-        uint32_t _maximumInstances;
-        std::vector<uint32_t*> _positions;
+        uint32_t _mergeThreshold;
+
+        // Storage grows geometrically and shrinks after being underused for some flushes.
+        InstanceCapacity _capacity;
+        IndexTable _instances;
         std::vector<std::type_index> _types;
         std::vector<InstancingSlot> _slots;
 
+        // Culling state. The slot holding DefaultInstancingData provides the model matrices.
+        // When _compacted is true, the instance at position i of the GPU buffers is _uploadedInstances[i].
+        // Only the positions whose instance or data changed are uploaded again.
+        std::optional<size_t> _transformSlot;
+        std::vector<uint32_t> _uploadedInstances;
+        size_t _drawnInstances;
+        bool _compacted;
+
         Implementation _implementation;
 
+        bool reserve(size_t amount);
+
+        void resize(uint32_t capacity);
+
+        void shrinkIfIdle();
+
       public:
         BasicInstanceData(Application* application, const ModelCreateInfo& info);
 
@@ -64,8 +91,14 @@ namespace neon
 
         [[nodiscard]] size_t getInstanceAmount() const override;
 
+        [[nodiscard]] size_t getDrawnInstanceAmount() const override;
+
         [[nodiscard]] size_t getMaximumInstances() const override;
 
+        [[nodiscard]] size_t getInstanceCapacity() const override;
+
+        [[nodiscard]] size_t getAllocatedMemory() const override;
+
         [[nodiscard]] size_t getBytesRequiredPerInstance() const override;
 
         bool uploadData(Instance instance, size_t index, const void* data) override;
@@ -74,6 +107,13 @@ namespace neon
 
         void flush(const CommandBuffer* commandBuffer) override;
 
+        bool cull(const FrustumCuller& culler, const BoundingSphere& bounds,
+                  std::vector<uint32_t>& visible) const override;
+
+        [[nodiscard]] bool supportsCompaction() const override;
+
+        void flushVisible(const CommandBuffer* commandBuffer, const std::vector<uint32_t>& visible) override;
+
         [[nodiscard]] InstanceData::Implementation& getImplementation() override;
 
         [[nodiscard]] const InstanceData::Implementation& getImplementation() const override;
@@ -12,6 +12,7 @@ namespace neon
     ConcurrentInstanceData::ConcurrentInstanceData(Application* application, const ModelCreateInfo& info) :
         _application(application),
         _maximumInstances(info.maximumInstances),
+        _mergeThreshold(info.dirtyRangeMergeThreshold),
         _types(info.instanceTypes),
         _mutex(info.instanceSizes.size()),
         _implementation(application, info)
@@ -20,7 +21,7 @@ namespace neon
         for (size_t i = 0; i < info.instanceTypes.size(); ++i) {
             size_t size = info.instanceSizes[i];
             char* data = new char[size * _maximumInstances];
-            _slots.emplace_back(size, data, Range<uint32_t>(0, 0));
+            _slots.emplace_back(size, data, DirtyRanges(_maximumInstances), std::vector<Range<uint32_t>>());
         }
     }
 
@@ -30,11 +31,6 @@ namespace neon
             std::lock_guard lock(_mutex[i]);
             delete[] _slots[i].data;
         }
-
-        std::lock_guard lock(_positionMutex);
-        for (auto* position : _positions) {
-            delete position;
-        }
     }
 
     const std::vector<std::type_index>& ConcurrentInstanceData::getInstancingStructTypes() const
@@ -45,99 +41,70 @@ namespace neon
     Result<InstanceData::Instance, std::string> ConcurrentInstanceData::createInstance()
     {
         std::lock_guard lock(_positionMutex);
-        if (_positions.size() >= _maximumInstances) {
+        if (_instances.size() >= _maximumInstances) {
             return {"Buffer is full!"};
         }
 
-        auto* id = new uint32_t(static_cast<uint32_t>(_positions.size()));
-        _positions.push_back(id);
-        return Instance(id);
+        return _instances.create();
     }
 
     Result<std::vector<InstanceData::Instance>, std::string> ConcurrentInstanceData::createMultipleInstances(
         size_t amount)
     {
         std::lock_guard lock(_positionMutex);
-        if (_positions.size() + amount > _maximumInstances) {
+        if (_instances.size() + amount > _maximumInstances) {
             return {"Buffer is full!"};
         }
 
         std::vector<Instance> instances;
         instances.reserve(amount);
+        _instances.reserve(_instances.size() + amount);
         for (size_t i = 0; i < amount; ++i) {
-            auto* id = new uint32_t(static_cast<uint32_t>(_positions.size()));
-            _positions.push_back(id);
-            instances.emplace_back(id);
+            instances.push_back(_instances.create());
         }
 
         return std::move(instances);
     }
 
-    bool ConcurrentInstanceData::freeInstance(Instance instance)
+    bool ConcurrentInstanceData::removeInstance(Instance instance)
     {
-        std::lock_guard lock(_positionMutex);
-
-        const uint32_t id = *instance.id;
-
-        auto* toRemove = _positions[id];
-        auto* last = _positions.back();
+        uint32_t index = _instances.remove(instance);
+        if (index == IndexTable::INVALID_INDEX) {
+            return false;
+        }
 
-        for (size_t i = 0; i < _slots.size(); ++i) {
-            std::lock_guard slotLock(_mutex[i]);
-            auto& [size, data, changeRange] = _slots[i];
-            if (size == 0) {
-                continue;
+        // The last instance has been moved to the freed index. Move its data too.
+        auto last = static_cast<uint32_t>(_instances.size());
+        if (index != last) {
+            for (size_t i = 0; i < _slots.size(); ++i) {
+                std::lock_guard slotLock(_mutex[i]);
+                auto& [size, data, changes, runs] = _slots[i];
+                if (size == 0) {
+                    continue;
+                }
+                memcpy(data + size * index, data + size * last, size);
+                changes.mark(index);
             }
-            memcpy(data + size * id, data + size * *last, size);
-            changeRange += Range(id, id + 1);
         }
 
-        _positions[id] = last;
-        _positions.pop_back();
-        *last = id;
-
-        delete toRemove;
-
         return true;
     }
 
+    bool ConcurrentInstanceData::freeInstance(Instance instance)
+    {
+        std::lock_guard lock(_positionMutex);
+        return removeInstance(instance);
+    }
+
     size_t ConcurrentInstanceData::freeInstances(const std::vector<Instance>& ids)
     {
         std::lock_guard lock(_positionMutex);
 
         size_t freedCount = 0;
-        std::vector<uint32_t> removalIds;
-        removalIds.reserve(ids.size());
-
-        for (const auto& inst : ids) {
-            removalIds.push_back(*inst.id);
-        }
-        std::ranges::sort(removalIds, std::greater<uint32_t>());
-
-        for (uint32_t id : removalIds) {
-            if (id >= _positions.size()) {
-                continue;
+        for (auto& instance : ids) {
+            if (removeInstance(instance)) {
+                ++freedCount;
             }
-
-            auto* toRemove = _positions[id];
-            auto* last = _positions.back();
-
-            if (id != _positions.size() - 1) {
-                for (auto& [size, data, changeRange] : _slots) {
-                    if (size == 0) {
-                        continue;
-                    }
-                    memcpy(data + size * id, data + size * *last, size);
-                    changeRange += Range(id, id + 1);
-                }
-            }
-
-            _positions[id] = last;
-            _positions.pop_back();
-            *last = id;
-
-            delete toRemove;
-            ++freedCount;
         }
         return freedCount;
     }
@@ -145,7 +112,7 @@ namespace neon
     size_t ConcurrentInstanceData::getInstanceAmount() const
     {
         std::lock_guard lock(_positionMutex);
-        return _positions.size();
+        return _instances.size();
     }
 
     size_t ConcurrentInstanceData::getMaximumInstances() const
@@ -164,7 +131,7 @@ namespace neon
 
     bool ConcurrentInstanceData::uploadData(Instance instance, size_t index, const void* data)
     {
-        if (_slots.size() < index) {
+        if (_slots.size() <= index) {
             neon::error().group("vulkan") << "Cannot upload instance data. Slot " << index << " is not defined!";
             return false;
         }
@@ -174,19 +141,21 @@ namespace neon
             return false;
         }
 
-
+        // The position lock is acquired first, as in freeInstance():
+        // the instance cannot be moved while its data is written.
+        std::lock_guard lock(_positionMutex);
         std::lock_guard slotLock(_mutex[index]);
 
-        uint32_t id = *instance.id;
+        uint32_t id = _instances.getIndex(instance);
 
-        if (id >= _positions.size()) {
-            neon::error().group("vulkan") << "Cannot upload instance data. Instance" << id << " is not valid!";
+        if (id == IndexTable::INVALID_INDEX) {
+            neon::error().group("vulkan") << "Cannot upload instance data. Instance" << instance.id << " is not valid!";
             return false;
         }
 
         memcpy(slot.data + slot.size * id, data, slot.size);
 
-        slot.changeRange += Range(id, id + 1);
+        slot.changes.mark(id);
 
         return true;
     }
@@ -201,8 +170,9 @@ namespace neon
         for (size_t i = 0; i < _slots.size(); ++i) {
             std::lock_guard slotLock(_mutex[i]);
             auto& slot = _slots[i];
-            _implementation.flush(commandBuffer, i, slot.size, slot.data, slot.changeRange);
-            slot.changeRange = Range<uint32_t>(0, 0);
+            slot.changes.collectRuns(_mergeThreshold, slot.runs);
+            _implementation.flush(commandBuffer, i, slot.size, slot.data, slot.runs);
+            slot.changes.clear();
         }
     }
 
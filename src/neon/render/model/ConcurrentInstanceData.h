@@ -8,6 +8,8 @@
 #include <mutex>
 
 #include <neon/render/model/InstanceData.h>
+#include <neon/util/DirtyRanges.h>
+#include <neon/util/IndexTable.h>
 #include <neon/util/Range.h>
 
 #ifdef USE_VULKAN
@@ -38,12 +40,14 @@ namespace neon
         {
             size_t size;
             char* data;
-            Range<uint32_t> changeRange;
+            DirtyRanges changes;
+            std::vector<Range<uint32_t>> runs;
         };
 
         Application* _application;
         uint32_t _maximumInstances;
-        std::vector<uint32_t*> _positions;
+        uint32_t _mergeThreshold;
+        IndexTable _instances;
         std::vector<std::type_index> _types;
         std::vector<InstancingSlot> _slots;
         std::vector<std::mutex> _mutex;
@@ -51,6 +55,8 @@ namespace neon
 
         Implementation _implementation;
 
+        bool removeInstance(Instance instance);
+
       public:
         ConcurrentInstanceData(Application* application, const ModelCreateInfo& info);
 
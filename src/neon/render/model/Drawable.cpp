@@ -4,10 +4,13 @@
 
 #include "Drawable.h"
 
+#include <neon/render/RenderQueue.h>
+
 namespace neon
 {
     Drawable::Drawable(std::type_index type, std::string name) :
-        Asset(std::move(type), std::move(name))
+        Asset(std::move(type), std::move(name)),
+        _materialsVersion(0)
     {
     }
 
@@ -18,6 +21,9 @@ namespace neon
 
     std::unordered_set<std::shared_ptr<Material>>& Drawable::getMaterials()
     {
+        // The caller may modify the materials.
+        ++_materialsVersion;
+        RenderQueue::invalidateAll();
         return _materials;
     }
 
@@ -25,5 +31,12 @@ namespace neon
     {
         _materials.clear();
         _materials.insert(material);
+        ++_materialsVersion;
+        RenderQueue::invalidateAll();
+    }
+
+    uint64_t Drawable::getMaterialsVersion() const
+    {
+        return _materialsVersion;
     }
 } // namespace neon
@@ -5,6 +5,7 @@
 #ifndef DRAWABLE_H
 #define DRAWABLE_H
 
+#include <cstdint>
 #include <memory>
 #include <unordered_set>
 #include <neon/render/shader/Material.h>
@@ -20,6 +21,7 @@ namespace neon
     class Drawable : public Asset
     {
         std::unordered_set<std::shared_ptr<Material>> _materials;
+        uint64_t _materialsVersion;
 
       public:
 #ifdef USE_VULKAN
@@ -43,6 +45,9 @@ namespace neon
         /**
          * Returns the materials of the mesh.
          * You can modify this vector to add new materials.
+         * <p>
+         * Calling this method invalidates the render queues:
+         * use the const overload when the materials are only read.
          * @return the materials.
          */
         [[nodiscard]] std::unordered_set<std::shared_ptr<Material>>& getMaterials();
@@ -54,6 +59,14 @@ namespace neon
          * @param material the material.
          */
         void setMaterial(const std::shared_ptr<Material>& material);
+
+        /**
+         * Returns a number that changes every time the materials
+         * of this mesh may have been modified.
+         * Render queues use it to detect which meshes must be patched.
+         * @return the version of the materials.
+         */
+        [[nodiscard]] uint64_t getMaterialsVersion() const;
     };
 } // namespace neon
 
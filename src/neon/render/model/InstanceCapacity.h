@@ -0,0 +1,113 @@
+#ifndef NEON_INSTANCECAPACITY_H
+#define NEON_INSTANCECAPACITY_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace neon
+{
+    /**
+     * Growth policy of the storage of an instance data.
+     * <p>
+     * The capacity starts at the initial capacity and doubles when more instances are required,
+     * up to the maximum amount of instances.
+     * After being underused (a quarter of the capacity or less) for a given amount
+     * of consecutive flushes, the capacity shrinks to twice the amount of live instances,
+     * never going below the initial capacity.
+     * <p>
+     * This class only computes capacities: the owner resizes its storage.
+     */
+    class InstanceCapacity
+    {
+        uint32_t _capacity;
+        uint32_t _initial;
+        uint32_t _maximum;
+        uint32_t _shrinkDelay;
+        uint32_t _idleFlushes;
+
+      public:
+        /**
+         * Creates the policy.
+         *
+         * @param initial the initial capacity. It is clamped to the maximum.
+         * @param maximum the maximum amount of instances.
+         * @param shrinkDelay the amount of consecutive underused flushes before shrinking.
+         * 0 disables shrinking.
+         */
+        InstanceCapacity(uint32_t initial, uint32_t maximum, uint32_t shrinkDelay) :
+            _capacity(std::min(initial, maximum)),
+            _initial(_capacity),
+            _maximum(maximum),
+            _shrinkDelay(shrinkDelay),
+            _idleFlushes(0)
+        {
+        }
+
+        [[nodiscard]] uint32_t getCapacity() const
+        {
+            return _capacity;
+        }
+
+        [[nodiscard]] uint32_t getMaximum() const
+        {
+            return _maximum;
+        }
+
+        /**
+         * Returns the capacity required to hold the given amount of instances.
+         *
+         * @param amount the amount of instances.
+         * @return the current capacity if it is enough, the grown capacity otherwise,
+         * or empty if the amount exceeds the maximum.
+         */
+        [[nodiscard]] std::optional<uint32_t> computeRequired(size_t amount) const
+        {
+            if (amount <= _capacity) {
+                return _capacity;
+            }
+            if (amount > _maximum) {
+                return {};
+            }
+
+            size_t capacity = std::max<size_t>(_capacity, 1);
+            while (capacity < amount) {
+                capacity *= 2;
+            }
+            return static_cast<uint32_t>(std::min<size_t>(capacity, _maximum));
+        }
+
+        /**
+         * Registers a flush.
+         *
+         * @param live the amount of live instances.
+         * @return the capacity to shrink to, or empty if the storage must be kept.
+         */
+        [[nodiscard]] std::optional<uint32_t> onFlush(size_t live)
+        {
+            if (_shrinkDelay == 0 || _capacity <= _initial || live > _capacity / 4) {
+                _idleFlushes = 0;
+                return {};
+            }
+
+            if (++_idleFlushes < _shrinkDelay) {
+                return {};
+            }
+
+            // Keep some room to avoid growing again right away.
+            return static_cast<uint32_t>(std::max<size_t>(_initial, live * 2));
+        }
+
+        /**
+         * Sets the capacity of the storage after resizing it.
+         */
+        void setCapacity(uint32_t capacity)
+        {
+            _capacity = capacity;
+            _idleFlushes = 0;
+        }
+    };
+} // namespace neon
+
+#endif // NEON_INSTANCECAPACITY_H
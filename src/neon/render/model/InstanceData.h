@@ -8,7 +8,9 @@
 #include <cstdint>
 #include <string>
 #include <typeindex>
+#include <vector>
 
+#include <neon/util/IndexTable.h>
 #include <neon/util/Result.h>
 
 #ifdef USE_VULKAN
@@ -19,6 +21,10 @@ namespace neon
 {
     class CommandBuffer;
 
+    class FrustumCuller;
+
+    struct BoundingSphere;
+
     /**
      * Base class that manages the instances of a model.
      * Use this class to create, remove and modify model
@@ -35,10 +41,12 @@ namespace neon
         using Implementation = vulkan::VKInstanceData;
 #endif
 
-        struct Instance
-        {
-            uint32_t* id;
-        };
+        /**
+         * Handle of an instance.
+         * Handles remain valid while the instance exists,
+         * even if its data is moved inside the instance data.
+         */
+        using Instance = IndexTable::Handle;
 
         virtual ~InstanceData() = default;
 
@@ -83,6 +91,19 @@ namespace neon
          */
         [[nodiscard]] virtual size_t getInstanceAmount() const = 0;
 
+        /**
+         * Returns the number of instances that should be drawn.
+         * <p>
+         * This value is lower than getInstanceAmount() when
+         * the last flush only uploaded the visible instances.
+         *
+         * @return the number of instances to draw.
+         */
+        [[nodiscard]] virtual size_t getDrawnInstanceAmount() const
+        {
+            return getInstanceAmount();
+        }
+
         /**
          * Retrieves the maximum number of instances that can be managed.
          * Use this method to determine the upper limit of model instances
@@ -92,6 +113,39 @@ namespace neon
          */
         [[nodiscard]] virtual size_t getMaximumInstances() const = 0;
 
+        /**
+         * Returns the number of instances the current storage can hold
+         * without allocating more memory.
+         * Implementations with fixed storage return getMaximumInstances().
+         *
+         * @return the number of instances.
+         */
+        [[nodiscard]] virtual size_t getInstanceCapacity() const
+        {
+            return getMaximumInstances();
+        }
+
+        /**
+         * Returns the memory allocated to store the instances, in bytes.
+         * The default implementation only counts the CPU-side copy of the instance data.
+         *
+         * @return the allocated memory.
+         */
+        [[nodiscard]] virtual size_t getAllocatedMemory() const
+        {
+            return getInstanceCapacity() * getBytesRequiredPerInstance();
+        }
+
+        /**
+         * Returns the memory used by the live instances, in bytes.
+         *
+         * @return the used memory.
+         */
+        [[nodiscard]] virtual size_t getUsedMemory() const
+        {
+            return getInstanceAmount() * getBytesRequiredPerInstance();
+        }
+
         /**
          * Calculates the number of bytes required to store data for a single instance.
          * This method determines the memory requirements per instance based on the
@@ -131,6 +185,48 @@ namespace neon
          */
         virtual void flush(const CommandBuffer* commandBuffer) = 0;
 
+        /**
+         * Tests the instances against the given frustum using the model matrices stored in this structure.
+         * <p>
+         * The default implementation doesn't store model matrices: it returns false.
+         *
+         * @param culler the culler used to test the instances.
+         * @param bounds the bounding sphere of the model, in model space.
+         * @param visible the vector where the indices of the visible instances are written.
+         * @return whether this structure stores the model matrices of its instances.
+         */
+        virtual bool cull(const FrustumCuller& culler, const BoundingSphere& bounds,
+                          std::vector<uint32_t>& visible) const
+        {
+            return false;
+        }
+
+        /**
+         * @return whether this structure can upload a compacted list of instances using flushVisible().
+         */
+        [[nodiscard]] virtual bool supportsCompaction() const
+        {
+            return false;
+        }
+
+        /**
+         * Uploads only the given instances. The instance buffers are compacted:
+         * the given instances are uploaded contiguously at the start of each buffer.
+         * <p>
+         * All the instance datas of a model must be flushed using the same list,
+         * so the attributes at the same position of every buffer belong to the same instance.
+         * Model::flushInstances() takes care of this.
+         * <p>
+         * The default implementation doesn't compact: it uploads all instances.
+         *
+         * @param commandBuffer the command buffer used to upload the data. It may be null.
+         * @param visible the indices of the instances to upload, in ascending order.
+         */
+        virtual void flushVisible(const CommandBuffer* commandBuffer, const std::vector<uint32_t>& visible)
+        {
+            flush(commandBuffer);
+        }
+
         /**
          * @return the implementation of this structure.
          */
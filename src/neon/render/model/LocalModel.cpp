@@ -66,6 +66,17 @@ namespace neon
         return _meshes;
     }
 
+    BoundingSphere LocalModel::computeBoundingSphere() const
+    {
+        std::vector<rush::Vec3f> positions;
+        for (const auto& mesh : _meshes) {
+            for (const auto& vertex : mesh.getData()) {
+                positions.push_back(vertex.position);
+            }
+        }
+        return BoundingSphere::fromPoints(positions);
+    }
+
     std::optional<LocalVertexEntry> serialization::toLocalVertexEntry(std::string s)
     {
         static const std::unordered_map<std::string, LocalVertexEntry> map = {
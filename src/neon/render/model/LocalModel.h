@@ -6,6 +6,7 @@
 #define LOCALMODEL_H
 
 #include <neon/structure/Asset.h>
+#include <neon/geometry/BoundingSphere.h>
 #include <rush/vector/vec.h>
 
 #include "InputDescription.h"
@@ -80,6 +81,14 @@ namespace neon
         [[nodiscard]] std::vector<LocalMesh>& getMeshes();
 
         [[nodiscard]] const std::vector<LocalMesh>& getMeshes() const;
+
+        /**
+         * Computes a bounding sphere containing the positions of all meshes.
+         * Use this sphere as the culling bounds of the GPU model.
+         *
+         * @return the bounding sphere, in model space.
+         */
+        [[nodiscard]] BoundingSphere computeBoundingSphere() const;
     };
 
     namespace serialization
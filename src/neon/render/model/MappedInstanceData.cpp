@@ -0,0 +1,228 @@
+#include "MappedInstanceData.h"
+
+#include <cstring>
+
+#include <neon/structure/Application.h>
+#include <neon/render/model/ModelCreateInfo.h>
+
+namespace neon
+{
+    MappedInstanceData::MappedInstanceData(Application* application, const ModelCreateInfo& info) :
+        _application(application),
+        _maximumInstances(info.maximumInstances),
+        _mergeThreshold(info.dirtyRangeMergeThreshold),
+        _types(info.instanceTypes),
+        _implementation(application, info)
+    {
+        _frame = _implementation.getCurrentFrame();
+
+        _slots.reserve(info.instanceTypes.size());
+        for (size_t i = 0; i < info.instanceTypes.size(); ++i) {
+            _slots.push_back(
+                {info.instanceSizes[i], FrameDirtyRanges(_implementation.getFrameAmount(), _maximumInstances, _frame)});
+        }
+    }
+
+    void MappedInstanceData::synchronize()
+    {
+        uint32_t frame = _implementation.getCurrentFrame();
+        if (frame == _frame) {
+            return;
+        }
+
+        // The previous frame's buffers hold the latest version of every instance.
+        // Copy the instances modified since the new frame's buffers were used.
+        for (size_t i = 0; i < _slots.size(); ++i) {
+            auto& slot = _slots[i];
+            const char* source = _implementation.getData(i, _frame);
+            char* destination = _implementation.getData(i, frame);
+
+            slot.stale.advance(frame, _mergeThreshold, [&](Range<uint32_t> run) {
+                if (slot.size == 0 || source == nullptr || destination == nullptr) {
+                    return;
+                }
+                memcpy(destination + run.getFrom() * slot.size, source + run.getFrom() * slot.size,
+                       run.size() * slot.size);
+            });
+        }
+
+        _frame = frame;
+    }
+
+    void MappedInstanceData::markModified(size_t index, Range<uint32_t> range)
+    {
+        _slots[index].stale.mark(range);
+    }
+
+    char* MappedInstanceData::fetchInstances(size_t index, size_t elementSize, Range<uint32_t> range)
+    {
+        if (_slots.size() <= index) {
+            neon::error().group("vulkan") << "Cannot access instance data. Slot " << index << " is not defined!";
+            return nullptr;
+        }
+        auto& slot = _slots[index];
+        if (slot.size != elementSize) {
+            neon::error().group("vulkan") << "Cannot access instance data. Slot " << index << " has a size of "
+                                          << slot.size << " bytes, but " << elementSize << " were requested!";
+            return nullptr;
+        }
+        if (range.getTo() > _instances.size()) {
+            neon::error().group("vulkan") << "Cannot access instance data. Range [" << range.getFrom() << ", "
+                                          << range.getTo() << ") is out of bounds!";
+            return nullptr;
+        }
+
+        synchronize();
+        char* data = _implementation.getData(index, _frame);
+        if (data == nullptr || range.size() == 0) {
+            return nullptr;
+        }
+        markModified(index, range);
+        return data + range.getFrom() * slot.size;
+    }
+
+    const std::vector<std::type_index>& MappedInstanceData::getInstancingStructTypes() const
+    {
+        return _types;
+    }
+
+    Result<InstanceData::Instance, std::string> MappedInstanceData::createInstance()
+    {
+        if (_instances.size() >= _maximumInstances) {
+            return {"Buffer is full!"};
+        }
+
+        return _instances.create();
+    }
+
+    Result<std::vector<InstanceData::Instance>, std::string> MappedInstanceData::createMultipleInstances(size_t amount)
+    {
+        if (_instances.size() + amount > _maximumInstances) {
+            return {"Buffer is full!"};
+        }
+
+        std::vector<Instance> instances;
+        instances.reserve(amount);
+        _instances.reserve(_instances.size() + amount);
+        for (size_t i = 0; i < amount; ++i) {
+            instances.push_back(_instances.create());
+        }
+
+        return std::move(instances);
+    }
+
+    bool MappedInstanceData::freeInstance(Instance instance)
+    {
+        synchronize();
+
+        uint32_t index = _instances.remove(instance);
+        if (index == IndexTable::INVALID_INDEX) {
+            return false;
+        }
+
+        // The last instance has been moved to the freed index. Move its data too.
+        auto last = static_cast<uint32_t>(_instances.size());
+        if (index == last) {
+            return true;
+        }
+
+        for (size_t i = 0; i < _slots.size(); ++i) {
+            size_t size = _slots[i].size;
+            char* data = _implementation.getData(i, _frame);
+            if (data == nullptr) {
+                continue;
+            }
+            memcpy(data + size * index, data + size * last, size);
+            markModified(i, Range<uint32_t>(index, index + 1));
+        }
+
+        return true;
+    }
+
+    size_t MappedInstanceData::freeInstances(const std::vector<Instance>& ids)
+    {
+        size_t freedCount = 0;
+        for (auto& instance : ids) {
+            if (freeInstance(instance)) {
+                ++freedCount;
+            }
+        }
+        return freedCount;
+    }
+
+    size_t MappedInstanceData::getInstanceAmount() const
+    {
+        return _instances.size();
+    }
+
+    size_t MappedInstanceData::getMaximumInstances() const
+    {
+        return _maximumInstances;
+    }
+
+    size_t MappedInstanceData::getAllocatedMemory() const
+    {
+        return _implementation.getAllocatedMemory();
+    }
+
+    size_t MappedInstanceData::getBytesRequiredPerInstance() const
+    {
+        size_t bytes = 0;
+        for (auto& slot : _slots) {
+            bytes += slot.size;
+        }
+        return bytes;
+    }
+
+    uint32_t MappedInstanceData::getInstanceIndex(Instance instance) const
+    {
+        return _instances.getIndex(instance);
+    }
+
+    bool MappedInstanceData::uploadData(Instance instance, size_t index, const void* data)
+    {
+        if (_slots.size() <= index) {
+            neon::error().group("vulkan") << "Cannot upload instance data. Slot " << index << " is not defined!";
+            return false;
+        }
+        auto& slot = _slots[index];
+        if (slot.size == 0) {
+            neon::error().group("vulkan") << "Cannot upload instance data. Slot" << index << " has no memory!";
+            return false;
+        }
+
+        uint32_t id = _instances.getIndex(instance);
+
+        if (id == IndexTable::INVALID_INDEX) {
+            neon::error().group("vulkan") << "Cannot upload instance data. Instance" << instance.id << " is not valid!";
+            return false;
+        }
+
+        synchronize();
+        memcpy(_implementation.getData(index, _frame) + slot.size * id, data, slot.size);
+        markModified(index, Range<uint32_t>(id, id + 1));
+
+        return true;
+    }
+
+    void MappedInstanceData::flush()
+    {
+        flush(nullptr);
+    }
+
+    void MappedInstanceData::flush(const CommandBuffer* commandBuffer)
+    {
+        // The GPU reads the mapped memory directly. Only the frame's buffers must be up to date.
+        synchronize();
+    }
+
+    InstanceData::Implementation& MappedInstanceData::getImplementation()
+    {
+        return _implementation;
+    }
+
+    const InstanceData::Implementation& MappedInstanceData::getImplementation() const
+    {
+        return _implementation;
+    }
+} // namespace neon
@@ -0,0 +1,157 @@
+#ifndef NEON_MAPPEDINSTANCEDATA_H
+#define NEON_MAPPEDINSTANCEDATA_H
+
+#include <span>
+
+#include <neon/render/model/InstanceData.h>
+#include <neon/util/FrameDirtyRanges.h>
+#include <neon/util/IndexTable.h>
+#include <neon/util/Range.h>
+
+#ifdef USE_VULKAN
+
+    #include <vulkan/render/model/VKMappedInstanceData.h>
+
+#endif
+
+namespace neon
+{
+    class Application;
+    class CommandBuffer;
+    struct ModelCreateInfo;
+
+    /**
+     * InstanceData implementation that writes the instances
+     * directly into persistently mapped, host-visible GPU memory.
+     * <p>
+     * Each slot is stored in a ring of buffers, one per frame in flight.
+     * Data is written into the buffer of the current frame: there's no
+     * CPU-side copy of the data and flushing records no transfer commands.
+     * When the frame changes, the instances modified in the previous frames
+     * are copied into the new frame's buffer.
+     * <p>
+     * Use getInstances() to fill the instances in place.
+     * <p>
+     * This implementation is designed for integrated GPUs and software rasterizers,
+     * where host-visible memory is the GPU memory. On discrete GPUs, the GPU reads
+     * the instances through the PCIe bus: prefer BasicInstanceData.
+     * <p>
+     * Instances are kept contiguous: freeing an instance moves the last one to its position.
+     * This implementation is not thread-safe.
+     */
+    class MappedInstanceData : public InstanceData
+    {
+      public:
+#ifdef USE_VULKAN
+        using Implementation = vulkan::VKMappedInstanceData;
+#endif
+
+      private:
+        struct MappedSlot
+        {
+            size_t size;
+            // Instances modified since each frame's buffer was last used.
+            FrameDirtyRanges stale;
+        };
+
+        Application* _application;
+        uint32_t _maximumInstances;
+        uint32_t _mergeThreshold;
+        IndexTable _instances;
+        std::vector<std::type_index> _types;
+        std::vector<MappedSlot> _slots;
+        uint32_t _frame;
+
+        Implementation _implementation;
+
+        void synchronize();
+
+        void markModified(size_t index, Range<uint32_t> range);
+
+        char* fetchInstances(size_t index, size_t elementSize, Range<uint32_t> range);
+
+      public:
+        MappedInstanceData(Application* application, const ModelCreateInfo& info);
+
+        ~MappedInstanceData() override = default;
+
+        [[nodiscard]] const std::vector<std::type_index>& getInstancingStructTypes() const override;
+
+        [[nodiscard]] Result<Instance, std::string> createInstance() override;
+
+        [[nodiscard]] Result<std::vector<Instance>, std::string> createMultipleInstances(size_t amount) override;
+
+        bool freeInstance(Instance instance) override;
+
+        size_t freeInstances(const std::vector<Instance>& ids) override;
+
+        [[nodiscard]] size_t getInstanceAmount() const override;
+
+        [[nodiscard]] size_t getMaximumInstances() const override;
+
+        [[nodiscard]] size_t getAllocatedMemory() const override;
+
+        [[nodiscard]] size_t getBytesRequiredPerInstance() const override;
+
+        /**
+         * Returns the position of the given instance inside the spans
+         * returned by getInstances().
+         * Positions change when other instances are freed.
+         *
+         * @param instance the instance.
+         * @return the position or IndexTable::INVALID_INDEX if the instance is not valid.
+         */
+        [[nodiscard]] uint32_t getInstanceIndex(Instance instance) const;
+
+        /**
+         * Returns the mapped memory of the given slot, containing all instances.
+         * <p>
+         * The returned span is valid until the end of the current frame,
+         * or until an instance is created or freed.
+         * All instances are considered modified.
+         *
+         * @tparam T the type of the slot.
+         * @param index the index of the slot.
+         * @return the instances.
+         */
+        template<typename T>
+        std::span<T> getInstances(size_t index)
+        {
+            return getInstances<T>(index, Range<uint32_t>(0, static_cast<uint32_t>(_instances.size())));
+        }
+
+        /**
+         * Returns the mapped memory of the given slot, containing the instances in the given range.
+         * <p>
+         * The returned span is valid until the end of the current frame,
+         * or until an instance is created or freed.
+         * The instances in the range are considered modified.
+         *
+         * @tparam T the type of the slot. Its size must match the size of the slot.
+         * @param index the index of the slot.
+         * @param range the positions of the instances. It must be inside the amount of instances.
+         * @return the instances, or an empty span if the slot, the type or the range is not valid.
+         */
+        template<typename T>
+        std::span<T> getInstances(size_t index, Range<uint32_t> range)
+        {
+            char* data = fetchInstances(index, sizeof(T), range);
+            if (data == nullptr) {
+                return {};
+            }
+            return std::span<T>(reinterpret_cast<T*>(data), range.size());
+        }
+
+        bool uploadData(Instance instance, size_t index, const void* data) override;
+
+        void flush() override;
+
+        void flush(const CommandBuffer* commandBuffer) override;
+
+        [[nodiscard]] InstanceData::Implementation& getImplementation() override;
+
+        [[nodiscard]] const InstanceData::Implementation& getImplementation() const override;
+    };
+} // namespace neon
+
+#endif // NEON_MAPPEDINSTANCEDATA_H
@@ -4,6 +4,9 @@
 
 #include "Model.h"
 
+#include <algorithm>
+
+#include <neon/render/FrustumCuller.h>
 #include <neon/structure/Room.h>
 
 namespace neon
@@ -13,6 +16,7 @@ namespace neon
         _meshes(info.drawables),
         _bufferBindings(info.uniformBufferBindings),
         _shouldAutoFlush(info.shouldAutoFlush),
+        _cullingBounds(info.cullingBounds),
         _implementation(application, this)
     {
         if (info.uniformDescriptor != nullptr) {
@@ -65,6 +69,24 @@ namespace neon
         return _instanceDatas[index].get();
     }
 
+    size_t Model::getAllocatedInstanceMemory() const
+    {
+        size_t bytes = 0;
+        for (auto& data : _instanceDatas) {
+            bytes += data->getAllocatedMemory();
+        }
+        return bytes;
+    }
+
+    size_t Model::getUsedInstanceMemory() const
+    {
+        size_t bytes = 0;
+        for (auto& data : _instanceDatas) {
+            bytes += data->getUsedMemory();
+        }
+        return bytes;
+    }
+
     bool Model::shouldAutoFlush() const
     {
         return _shouldAutoFlush;
@@ -75,6 +97,42 @@ namespace neon
         _shouldAutoFlush = autoFlush;
     }
 
+    const std::optional<BoundingSphere>& Model::getCullingBounds() const
+    {
+        return _cullingBounds;
+    }
+
+    void Model::setCullingBounds(std::optional<BoundingSphere> bounds)
+    {
+        _cullingBounds = bounds;
+    }
+
+    void Model::flushInstances(const CommandBuffer* commandBuffer, const FrustumCuller& culler)
+    {
+        // VKMesh binds the buffers of all instance datas using the same instance index:
+        // either all of them are compacted using the same list, or none of them is.
+        bool compact = _cullingBounds.has_value() && !_instanceDatas.empty() &&
+                       std::ranges::all_of(_instanceDatas, [this](const auto& data) {
+                           return data->supportsCompaction() &&
+                                  data->getInstanceAmount() == _instanceDatas.front()->getInstanceAmount();
+                       });
+
+        if (compact) {
+            // The first instance data storing the model matrices culls the instances.
+            compact = std::ranges::any_of(_instanceDatas, [this, &culler](const auto& data) {
+                return data->cull(culler, _cullingBounds.value(), _visibleInstances);
+            });
+        }
+
+        for (auto& data : _instanceDatas) {
+            if (compact) {
+                data->flushVisible(commandBuffer, _visibleInstances);
+            } else {
+                data->flush(commandBuffer);
+            }
+        }
+    }
+
     const std::vector<std::shared_ptr<Drawable>>& Model::getMeshes() const
     {
         return _meshes;
@@ -102,6 +160,11 @@ namespace neon
         _implementation.draw(material);
     }
 
+    void Model::draw(Material* material, Drawable* drawable) const
+    {
+        _implementation.draw(material, drawable);
+    }
+
     void Model::drawOutside(Material* material, CommandBuffer* commandBuffer) const
     {
         _implementation.drawOutside(material, commandBuffer);
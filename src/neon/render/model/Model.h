@@ -5,9 +5,11 @@
 #ifndef NEON_MODEL_H
 #define NEON_MODEL_H
 
+#include <optional>
 #include <string>
 
 #include <neon/structure/Asset.h>
+#include <neon/geometry/BoundingSphere.h>
 #include <neon/render/model/Drawable.h>
 #include <neon/render/model/ModelCreateInfo.h>
 #include <neon/render/model/InstanceData.h>
@@ -26,6 +28,8 @@ namespace neon
 
     class CommandBuffer;
 
+    class FrustumCuller;
+
     /**
      * Represents a model that can be rendered
      * inside a scene.
@@ -48,6 +52,8 @@ namespace neon
         std::unordered_map<uint32_t, ModelBufferBinding> _bufferBindings;
         std::vector<std::unique_ptr<InstanceData>> _instanceDatas;
         bool _shouldAutoFlush;
+        std::optional<BoundingSphere> _cullingBounds;
+        std::vector<uint32_t> _visibleInstances;
 
         Implementation _implementation;
 
@@ -96,6 +102,16 @@ namespace neon
         */
         [[nodiscard]] InstanceData* getInstanceData(size_t index) const;
 
+        /**
+         * Returns the memory allocated by all instance datas of this model, in bytes.
+         */
+        [[nodiscard]] size_t getAllocatedInstanceMemory() const;
+
+        /**
+         * Returns the memory used by the live instances of this model, in bytes.
+         */
+        [[nodiscard]] size_t getUsedInstanceMemory() const;
+
         /**
          * Whether the renderer should call Model::flush() before rendering.
          * Set this flag to false if you want to manage the instance data
@@ -116,6 +132,37 @@ namespace neon
         */
         void setShouldAutoFlush(bool autoFlush);
 
+        /**
+         * Returns the bounding sphere used to cull the instances of this model.
+         * <p>
+         * When present, the room uploads only the instances
+         * inside the camera's frustum when auto-flushing.
+         *
+         * @return the bounding sphere in model space, or empty if culling is disabled.
+         */
+        [[nodiscard]] const std::optional<BoundingSphere>& getCullingBounds() const;
+
+        /**
+         * Sets the bounding sphere used to cull the instances of this model.
+         * Use an empty optional to disable culling.
+         *
+         * @param bounds the bounding sphere in model space.
+         */
+        void setCullingBounds(std::optional<BoundingSphere> bounds);
+
+        /**
+         * Uploads the instances of all instance datas of this model.
+         * <p>
+         * If the model has culling bounds, the instances are culled once,
+         * and every instance data uploads the same list of visible instances.
+         * Culling is skipped if any instance data cannot compact its instances
+         * or if no instance data stores the model matrices of the instances.
+         *
+         * @param commandBuffer the command buffer used to upload the data. It may be null.
+         * @param culler the culler used to test the instances.
+         */
+        void flushInstances(const CommandBuffer* commandBuffer, const FrustumCuller& culler);
+
         /**
          * Returns the list containing all meshes inside this model.
          * @return the meshes.
@@ -152,6 +199,19 @@ namespace neon
          */
         void draw(Material* material) const;
 
+        /**
+         * Calls the draw call of the given drawable
+         * using the given material.
+         * <p>
+         * This method can only be used
+         * when a draw operation is being performed.
+         * The drawable must be one of the meshes of this model.
+         *
+         * @param material the material.
+         * @param drawable the drawable.
+         */
+        void draw(Material* material, Drawable* drawable) const;
+
         /**
          * Calls the draw calls for the meshes that
          * contain the given material.
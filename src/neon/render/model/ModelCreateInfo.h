@@ -27,8 +27,10 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 
+#include <neon/geometry/BoundingSphere.h>
 #include <neon/render/model/DefaultInstancingData.h>
 #include <neon/render/model/BasicInstanceData.h>
 #include <neon/render/model/Drawable.h>
@@ -76,6 +78,9 @@ namespace neon
     struct ModelCreateInfo
     {
         static constexpr uint32_t DEFAULT_MAXIMUM_INSTANCES = 1024 * 16;
+        static constexpr uint32_t DEFAULT_DIRTY_RANGE_MERGE_THRESHOLD = 16;
+        static constexpr uint32_t DEFAULT_INITIAL_INSTANCE_CAPACITY = 256;
+        static constexpr uint32_t DEFAULT_INSTANCE_SHRINK_DELAY = 600;
 
         /**
          * The meshes of the model.
@@ -84,9 +89,25 @@ namespace neon
 
         /**
          * THe maximum amount of instances the model can hold.
+         * <p>
+         * BasicInstanceData uses this value as a limit only: its storage starts
+         * with initialInstanceCapacity instances and grows when required.
+         * Other implementations allocate memory for all instances upfront.
          */
         uint32_t maximumInstances = DEFAULT_MAXIMUM_INSTANCES;
 
+        /**
+         * The amount of instances growable instance datas allocate memory for when created.
+         */
+        uint32_t initialInstanceCapacity = DEFAULT_INITIAL_INSTANCE_CAPACITY;
+
+        /**
+         * The amount of consecutive flushes a growable instance data must use
+         * a quarter of its capacity or less before its storage is shrunk.
+         * Use 0 to disable shrinking.
+         */
+        uint32_t instanceShrinkDelay = DEFAULT_INSTANCE_SHRINK_DELAY;
+
         /**
          * The optional uniform, descriptor of the model.
          * You must define this descriptor in the materials the
@@ -110,6 +131,23 @@ namespace neon
         */
         bool shouldAutoFlush = true;
 
+        /**
+         * The maximum amount of unmodified instances between two modified
+         * instance ranges for both ranges to be uploaded as one.
+         * <p>
+         * Higher values upload more unmodified data, but reduce the amount of copy regions.
+         */
+        uint32_t dirtyRangeMergeThreshold = DEFAULT_DIRTY_RANGE_MERGE_THRESHOLD;
+
+        /**
+         * The bounding sphere of the model, in model space.
+         * <p>
+         * When present, auto-flushed instances outside the camera's frustum
+         * are not uploaded nor drawn. Culling is disabled by default:
+         * enable it only if all passes rendering this model use the main camera.
+         */
+        std::optional<BoundingSphere> cullingBounds = {};
+
         /**
          * The type of the instance data.
          *
@@ -12,6 +12,7 @@ namespace neon
     PinnedInstanceData::PinnedInstanceData(Application* application, const ModelCreateInfo& info) :
         _application(application),
         _maximumInstances(info.maximumInstances),
+        _mergeThreshold(info.dirtyRangeMergeThreshold),
         _types(info.instanceTypes),
         _implementation(application, info)
     {
@@ -19,18 +20,15 @@ namespace neon
         for (size_t i = 0; i < info.instanceTypes.size(); ++i) {
             size_t size = info.instanceSizes[i];
             char* data = new char[size * _maximumInstances];
-            _slots.emplace_back(size, data, Range<uint32_t>(0, 0));
+            _slots.emplace_back(size, data, DirtyRanges(_maximumInstances), std::vector<Range<uint32_t>>());
         }
     }
 
     PinnedInstanceData::~PinnedInstanceData()
     {
-        for (auto& [size, data, changeRange] : _slots) {
+        for (auto& [size, data, changes, runs] : _slots) {
             delete[] data;
         }
-        for (auto* ptr : _positions | std::views::keys) {
-            delete ptr;
-        }
     }
 
     const std::vector<std::type_index>& PinnedInstanceData::getInstancingStructTypes() const
@@ -48,12 +46,12 @@ namespace neon
             auto id = _freedPositions.back();
             _freedPositions.pop_back();
             _positions[id].second = true;
-            return Instance(_positions[id].first);
+            return Instance(id, _positions[id].first);
         }
 
-        auto* id = new uint32_t(static_cast<uint32_t>(getInstanceAmount()));
-        _positions.push_back({id, true});
-        return Instance(id);
+        auto id = static_cast<uint32_t>(_positions.size());
+        _positions.emplace_back(0, true);
+        return Instance(id, 0);
     }
 
     Result<std::vector<InstanceData::Instance>, std::string> PinnedInstanceData::createMultipleInstances(size_t amount)
@@ -69,11 +67,11 @@ namespace neon
                 auto id = _freedPositions.back();
                 _freedPositions.pop_back();
                 _positions[id].second = true;
-                instances.emplace_back(_positions[id].first);
+                instances.emplace_back(id, _positions[id].first);
             } else {
-                auto* id = new uint32_t(static_cast<uint32_t>(getInstanceAmount()));
-                _positions.push_back({id, true});
-                instances.emplace_back(id);
+                auto id = static_cast<uint32_t>(_positions.size());
+                _positions.emplace_back(0, true);
+                instances.emplace_back(id, 0);
             }
         }
 
@@ -82,16 +80,18 @@ namespace neon
 
     bool PinnedInstanceData::freeInstance(Instance instance)
     {
-        const uint32_t id = *instance.id;
+        const uint32_t id = instance.id;
         if (id >= _positions.size()) {
             return false;
         }
-        auto& [_, valid] = _positions[id];
-        if (!valid) {
+        auto& [generation, valid] = _positions[id];
+        if (!valid || generation != instance.generation) {
             return false;
         }
 
+        // Old copies of the handle become invalid.
         valid = false;
+        ++generation;
         _freedPositions.push_back(id);
         return true;
     }
@@ -130,7 +130,7 @@ namespace neon
 
     bool PinnedInstanceData::uploadData(Instance instance, size_t index, const void* data)
     {
-        if (_slots.size() < index) {
+        if (_slots.size() <= index) {
             neon::error().group("vulkan") << "Cannot upload instance data. Slot " << index << " is not defined!";
             return false;
         }
@@ -140,16 +140,16 @@ namespace neon
             return false;
         }
 
-        uint32_t id = *instance.id;
+        uint32_t id = instance.id;
 
-        if (id >= _positions.size() || !_positions[id].second) {
+        if (id >= _positions.size() || !_positions[id].second || _positions[id].first != instance.generation) {
             neon::error().group("vulkan") << "Cannot upload instance data. Instance" << id << " is not valid!";
             return false;
         }
 
         memcpy(slot.data + slot.size * id, data, slot.size);
 
-        slot.changeRange += Range(id, id + 1);
+        slot.changes.mark(id);
 
         return true;
     }
@@ -163,8 +163,9 @@ namespace neon
     {
         for (size_t i = 0; i < _slots.size(); ++i) {
             auto& slot = _slots[i];
-            _implementation.flush(commandBuffer, i, slot.size, slot.data, slot.changeRange);
-            slot.changeRange = Range<uint32_t>(0, 0);
+            slot.changes.collectRuns(_mergeThreshold, slot.runs);
+            _implementation.flush(commandBuffer, i, slot.size, slot.data, slot.runs);
+            slot.changes.clear();
         }
     }
 
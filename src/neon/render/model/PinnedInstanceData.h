@@ -6,6 +6,7 @@
 #define PINNEDINSTANCEDATA_H
 
 #include <neon/render/model/InstanceData.h>
+#include <neon/util/DirtyRanges.h>
 #include <neon/util/Range.h>
 
 #ifdef USE_VULKAN
@@ -40,12 +41,14 @@ namespace neon
         {
             size_t size;
             char* data;
-            Range<uint32_t> changeRange;
+            DirtyRanges changes;
+            std::vector<Range<uint32_t>> runs;
         };
 
         Application* _application;
         uint32_t _maximumInstances;
-        std::vector<std::pair<uint32_t*, bool>> _positions; // {pointer to index, valid (not deleted)}
+        uint32_t _mergeThreshold;
+        std::vector<std::pair<uint32_t, bool>> _positions; // {generation, valid (not deleted)}
         std::vector<uint32_t> _freedPositions;
         std::vector<std::type_index> _types;
         std::vector<InstancingSlot> _slots;
@@ -32,12 +32,7 @@ namespace neon
     {
     }
 
-    PinnedStorageBufferInstanceData::~PinnedStorageBufferInstanceData()
-    {
-        for (auto* position : _positions | std::views::keys) {
-            delete position;
-        }
-    }
+    PinnedStorageBufferInstanceData::~PinnedStorageBufferInstanceData() = default;
 
     const std::vector<std::type_index>& PinnedStorageBufferInstanceData::getInstancingStructTypes() const
     {
@@ -54,12 +49,12 @@ namespace neon
             auto id = _freedPositions.back();
             _freedPositions.pop_back();
             _positions[id].second = true;
-            return Instance(_positions[id].first);
+            return Instance(id, _positions[id].first);
         }
 
-        auto* id = new uint32_t(static_cast<uint32_t>(getInstanceAmount()));
-        _positions.push_back({id, true});
-        return Instance(id);
+        auto id = static_cast<uint32_t>(_positions.size());
+        _positions.emplace_back(0, true);
+        return Instance(id, 0);
     }
 
     Result<std::vector<InstanceData::Instance>, std::string> PinnedStorageBufferInstanceData::createMultipleInstances(
@@ -76,11 +71,11 @@ namespace neon
                 auto id = _freedPositions.back();
                 _freedPositions.pop_back();
                 _positions[id].second = true;
-                instances.emplace_back(_positions[id].first);
+                instances.emplace_back(id, _positions[id].first);
             } else {
-                auto* id = new uint32_t(static_cast<uint32_t>(getInstanceAmount()));
-                _positions.push_back({id, true});
-                instances.emplace_back(id);
+                auto id = static_cast<uint32_t>(_positions.size());
+                _positions.emplace_back(0, true);
+                instances.emplace_back(id, 0);
             }
         }
 
@@ -89,16 +84,18 @@ namespace neon
 
     bool PinnedStorageBufferInstanceData::freeInstance(Instance instance)
     {
-        const uint32_t id = *instance.id;
+        const uint32_t id = instance.id;
         if (id >= _positions.size()) {
             return false;
         }
-        auto& [_, valid] = _positions[id];
-        if (!valid) {
+        auto& [generation, valid] = _positions[id];
+        if (!valid || generation != instance.generation) {
             return false;
         }
 
+        // Old copies of the handle become invalid.
         valid = false;
+        ++generation;
         _freedPositions.push_back(id);
         return true;
     }
@@ -137,7 +134,7 @@ namespace neon
 
     bool PinnedStorageBufferInstanceData::uploadData(Instance instance, size_t index, const void* data)
     {
-        if (_slots.size() < index) {
+        if (_slots.size() <= index) {
             neon::error().group("vulkan") << "Cannot upload instance data. Slot " << index << " is not defined!";
             return false;
         }
@@ -147,9 +144,9 @@ namespace neon
             return false;
         }
 
-        uint32_t id = *instance.id;
+        uint32_t id = instance.id;
 
-        if (id >= _positions.size() || !_positions[id].second) {
+        if (id >= _positions.size() || !_positions[id].second || _positions[id].first != instance.generation) {
             neon::error().group("vulkan") << "Cannot upload instance data. Instance" << id << " is not valid!";
             return false;
         }
@@ -38,7 +38,7 @@ namespace neon
       private:
         Application* _application;
         uint32_t _maximumInstances;
-        std::vector<std::pair<uint32_t*, bool>> _positions; // {pointer to index, valid (not deleted)}
+        std::vector<std::pair<uint32_t, bool>> _positions; // {generation, valid (not deleted)}
         std::vector<uint32_t> _freedPositions;
         std::vector<std::type_index> _types;
         std::vector<Slot> _slots;
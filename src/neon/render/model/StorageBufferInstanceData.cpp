@@ -29,12 +29,7 @@ namespace neon
     {
     }
 
-    StorageBufferInstanceData::~StorageBufferInstanceData()
-    {
-        for (auto* position : _positions) {
-            delete position;
-        }
-    }
+    StorageBufferInstanceData::~StorageBufferInstanceData() = default;
 
     const std::vector<std::type_index>& StorageBufferInstanceData::getInstancingStructTypes() const
     {
@@ -43,28 +38,25 @@ namespace neon
 
     Result<InstanceData::Instance, std::string> StorageBufferInstanceData::createInstance()
     {
-        if (_positions.size() >= _maximumInstances) {
+        if (_instances.size() >= _maximumInstances) {
             return {"Buffer is full!"};
         }
 
-        auto* id = new uint32_t(static_cast<uint32_t>(_positions.size()));
-        _positions.push_back(id);
-        return Instance(id);
+        return _instances.create();
     }
 
     Result<std::vector<InstanceData::Instance>, std::string> StorageBufferInstanceData::createMultipleInstances(
         size_t amount)
     {
-        if (_positions.size() + amount > _maximumInstances) {
+        if (_instances.size() + amount > _maximumInstances) {
             return {"Buffer is full!"};
         }
 
         std::vector<Instance> instances;
         instances.reserve(amount);
+        _instances.reserve(_instances.size() + amount);
         for (size_t i = 0; i < amount; ++i) {
-            auto* id = new uint32_t(static_cast<uint32_t>(_positions.size()));
-            _positions.push_back(id);
-            instances.emplace_back(id);
+            instances.push_back(_instances.create());
         }
 
         return std::move(instances);
@@ -72,74 +64,44 @@ namespace neon
 
     bool StorageBufferInstanceData::freeInstance(Instance instance)
     {
-        const uint32_t id = *instance.id;
+        uint32_t id = _instances.remove(instance);
+        if (id == IndexTable::INVALID_INDEX) {
+            return false;
+        }
 
-        auto* toRemove = _positions[id];
-        auto* last = _positions.back();
+        // The last instance has been moved to the freed index. Move its data too.
+        auto last = static_cast<uint32_t>(_instances.size());
+        if (id == last) {
+            return true;
+        }
 
-        for (auto& slot : _slots) {
-            if (slot.size == 0) {
+        for (auto& [size, padding, binding, uniformBuffer] : _slots) {
+            if (size == 0) {
                 continue;
             }
 
-            auto index = static_cast<uint32_t>(slot.binding);
-            const char* data = static_cast<const char*>(slot.uniformBuffer->fetchData(index)) + slot.padding * *last;
-            slot.uniformBuffer->uploadData(index, data, slot.size, slot.padding * id);
+            auto index = static_cast<uint32_t>(binding);
+            const char* data = static_cast<const char*>(uniformBuffer->fetchData(index)) + padding * last;
+            uniformBuffer->uploadData(index, data, size, padding * id);
         }
 
-        _positions[id] = last;
-        _positions.pop_back();
-        *last = id;
-
-        delete toRemove;
-
         return true;
     }
 
     size_t StorageBufferInstanceData::freeInstances(const std::vector<Instance>& ids)
     {
         size_t freedCount = 0;
-        std::vector<uint32_t> removalIds;
-        removalIds.reserve(ids.size());
-
-        for (const auto& inst : ids) {
-            removalIds.push_back(*inst.id);
-        }
-        std::ranges::sort(removalIds, std::greater<uint32_t>());
-
-        for (uint32_t id : removalIds) {
-            if (id >= _positions.size()) {
-                continue;
+        for (auto& instance : ids) {
+            if (freeInstance(instance)) {
+                ++freedCount;
             }
-
-            auto* toRemove = _positions[id];
-            auto* last = _positions.back();
-
-            if (id != _positions.size() - 1) {
-                for (auto& [size, padding, binding, uniformBuffer] : _slots) {
-                    if (size == 0) {
-                        continue;
-                    }
-
-                    auto index = static_cast<uint32_t>(binding);
-                    const char* data = static_cast<const char*>(uniformBuffer->fetchData(index)) + padding * *last;
-                    uniformBuffer->uploadData(index, data, size, padding * id);
-                }
-            }
-
-            _positions[id] = last;
-            _positions.pop_back();
-            *last = id;
-
-            delete toRemove;
-            ++freedCount;
         }
         return freedCount;
     }
 
     size_t StorageBufferInstanceData::getInstanceAmount() const
     {
-        return _positions.size();
+        return _instances.size();
     }
 
     size_t StorageBufferInstanceData::getMaximumInstances() const
@@ -158,7 +120,7 @@ namespace neon
 
     bool StorageBufferInstanceData::uploadData(Instance instance, size_t index, const void* data)
     {
-        if (_slots.size() < index) {
+        if (_slots.size() <= index) {
             neon::error().group("vulkan") << "Cannot upload instance data. Slot " << index << " is not defined!";
             return false;
         }
@@ -168,10 +130,10 @@ namespace neon
             return false;
         }
 
-        uint32_t id = *instance.id;
+        uint32_t id = _instances.getIndex(instance);
 
-        if (id >= _positions.size()) {
-            neon::error().group("vulkan") << "Cannot upload instance data. Instance" << id << " is not valid!";
+        if (id == IndexTable::INVALID_INDEX) {
+            neon::error().group("vulkan") << "Cannot upload instance data. Instance" << instance.id << " is not valid!";
             return false;
         }
 
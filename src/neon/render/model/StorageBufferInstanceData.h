@@ -7,6 +7,7 @@
 
 #include <neon/render/model/InstanceData.h>
 #include <neon/render/shader/ShaderUniformBuffer.h>
+#include <neon/util/IndexTable.h>
 
 namespace neon
 {
@@ -34,7 +35,7 @@ namespace neon
       private:
         Application* _application;
         uint32_t _maximumInstances;
-        std::vector<uint32_t*> _positions;
+        IndexTable _instances;
         std::vector<std::type_index> _types;
         std::vector<Slot> _slots;
 
@@ -7,6 +7,8 @@
 
 #include <utility>
 
+#include <neon/render/RenderQueue.h>
+
 namespace neon
 {
     namespace
@@ -62,6 +64,7 @@ namespace neon
     void Material::setPriority(int32_t priority)
     {
         _priority = priority;
+        RenderQueue::invalidateAll();
     }
 
     const Material::Implementation& Material::getImplementation() const
@@ -6,10 +6,13 @@
 
 #include <utility>
 
+#include <neon/structure/Application.h>
+
 namespace neon
 {
     ShaderProgram::ShaderProgram(Application* application, std::string name) :
         Asset(typeid(ShaderProgram), std::move(name)),
+        _application(application),
         _compiled(false),
         _implementation(application)
     {
@@ -27,33 +30,28 @@ namespace neon
 
     bool ShaderProgram::addShader(ShaderType type, cmrc::file resource)
     {
-        if (_compiled) {
-            return false;
-        }
-        _rawShaders[type] = std::string(resource.begin(), resource.size());
-        return true;
+        return addShader(type, std::string(resource.begin(), resource.size()));
     }
 
     bool ShaderProgram::addShader(ShaderType type, std::string resource)
     {
+        std::lock_guard lock(_mutex);
+        if (_compiled) {
+            return false;
+        }
         _rawShaders[type] = std::move(resource);
         return true;
     }
 
     std::optional<std::string> ShaderProgram::compile()
     {
-        if (_compiled) {
-            return "Shader already compiled.";
-        }
-        auto result = _implementation.compile(_rawShaders, IncluderCreateInfo{});
-        if (!result.has_value()) {
-            _compiled = true;
-        }
-        return result;
+        return compile(IncluderCreateInfo{});
     }
 
     std::optional<std::string> ShaderProgram::compile(IncluderCreateInfo includerCreateInfo)
     {
+        // Concurrent compilations of the same program wait for the first one.
+        std::lock_guard lock(_mutex);
         if (_compiled) {
             return "Shader already compiled.";
         }
@@ -64,6 +62,14 @@ namespace neon
         return result;
     }
 
+    std::shared_ptr<Task<std::optional<std::string>>> ShaderProgram::compileAsync(
+        std::shared_ptr<ShaderProgram> program, IncluderCreateInfo includerCreateInfo)
+    {
+        auto& runner = program->_application->getTaskRunner();
+        return runner.executeAsync([program](IncluderCreateInfo info) { return program->compile(std::move(info)); },
+                                   std::move(includerCreateInfo));
+    }
+
     const std::vector<ShaderUniformBlock>& ShaderProgram::getUniformBlocks() const
     {
         return _implementation.getUniformBlocks();
@@ -74,6 +80,30 @@ namespace neon
         return _implementation.getUniformSamplers();
     }
 
+    std::vector<std::shared_ptr<Task<std::optional<std::string>>>> ShaderProgram::compileAll(
+        const std::vector<std::shared_ptr<ShaderProgram>>& programs, const IncluderCreateInfo& includerCreateInfo)
+    {
+        std::vector<std::shared_ptr<Task<std::optional<std::string>>>> tasks;
+        tasks.reserve(programs.size());
+        for (const auto& program : programs) {
+            tasks.push_back(compileAsync(program, includerCreateInfo));
+        }
+        return tasks;
+    }
+
+    std::vector<std::shared_ptr<Task<std::optional<std::string>>>> ShaderProgram::compileAll(
+        const std::vector<std::shared_ptr<ShaderProgram>>& programs,
+        const std::vector<IncluderCreateInfo>& includerCreateInfos)
+    {
+        std::vector<std::shared_ptr<Task<std::optional<std::string>>>> tasks;
+        tasks.reserve(programs.size());
+        for (size_t i = 0; i < programs.size(); ++i) {
+            tasks.push_back(compileAsync(programs[i], i < includerCreateInfos.size() ? includerCreateInfos[i]
+                                                                                      : IncluderCreateInfo{}));
+        }
+        return tasks;
+    }
+
     Result<std::shared_ptr<ShaderProgram>, std::string> ShaderProgram::createShader(Application* app, std::string name,
                                                                                     std::string vert, std::string frag)
     {
@@ -8,7 +8,9 @@
 #include <unordered_map>
 #include <optional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include <cmrc/cmrc.hpp>
 
@@ -18,6 +20,7 @@
 #include <neon/render/shader/IncluderCreateInfo.h>
 
 #include <neon/util/Result.h>
+#include <neon/util/task/TaskRunner.h>
 
 #ifdef USE_VULKAN
 
@@ -42,6 +45,11 @@ namespace neon
      * <p>
      * You may use the util static method <i>createShader</i> to
      * create and compile a shader program in one line.
+     * <p>
+     * Programs can be compiled on the application's TaskRunner
+     * using <i>compileAsync</i> or <i>compileAll</i>.
+     * ShaderProgramLoader::loadFiles uses them to load several programs at once.
+     * Several programs may be compiled concurrently.
      */
     class ShaderProgram : public Asset
     {
@@ -54,6 +62,8 @@ namespace neon
 #endif
 
       private:
+        Application* _application;
+        std::mutex _mutex;
         bool _compiled;
         std::unordered_map<ShaderType, std::string> _rawShaders;
         Implementation _implementation;
@@ -138,6 +148,53 @@ namespace neon
 
         // region Util static methods
 
+        /**
+         * @brief Compiles the given shader program on a worker thread of the application's TaskRunner.
+         *
+         * The task keeps the program alive until it finishes.
+         * The program must not be used or modified until the task finishes.
+         * Concurrent compilations of the same program are serialized: only the first one compiles it.
+         * The file system of the includer must support concurrent reads.
+         *
+         * @warning No new shaders can be added after the program has been compiled.
+         *
+         * @param program the program to compile.
+         * @param includerCreateInfo the information that configures the includer's creation.
+         * @return the task that finishes once the program is compiled. Its result contains
+         * the compilation error if one occurs. Null if the TaskRunner has been stopped.
+         */
+        static std::shared_ptr<Task<std::optional<std::string>>> compileAsync(
+            std::shared_ptr<ShaderProgram> program, IncluderCreateInfo includerCreateInfo = {});
+
+        /**
+         * Compiles all the given programs concurrently on the application's TaskRunner.
+         * <p>
+         * The returned tasks keep their programs alive until they finish.
+         * The programs must not be used or modified until their tasks finish.
+         *
+         * @param programs the programs to compile.
+         * @param includerCreateInfo the information that configures the includer of each program.
+         * @return the tasks compiling each program, in the same order as the programs.
+         * Their results contain the compilation error if one occurs.
+         */
+        static std::vector<std::shared_ptr<Task<std::optional<std::string>>>> compileAll(
+            const std::vector<std::shared_ptr<ShaderProgram>>& programs,
+            const IncluderCreateInfo& includerCreateInfo = {});
+
+        /**
+         * Compiles all the given programs concurrently on the application's TaskRunner,
+         * using a different includer configuration for each program.
+         *
+         * @param programs the programs to compile.
+         * @param includerCreateInfos the information that configures the includer of each program,
+         * in the same order as the programs.
+         * @return the tasks compiling each program, in the same order as the programs.
+         * Their results contain the compilation error if one occurs.
+         */
+        static std::vector<std::shared_ptr<Task<std::optional<std::string>>>> compileAll(
+            const std::vector<std::shared_ptr<ShaderProgram>>& programs,
+            const std::vector<IncluderCreateInfo>& includerCreateInfos);
+
         /**
          * Util static method that creates a new shader program
          * that only has a vertex and fragment shader.
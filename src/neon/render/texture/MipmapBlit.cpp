@@ -0,0 +1,39 @@
+#include "MipmapBlit.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace neon
+{
+    rush::Vec3ui nextMipmapSize(const rush::Vec3ui& size)
+    {
+        return rush::Vec3ui(std::max(size.x() / 2, 1u), std::max(size.y() / 2, 1u), std::max(size.z() / 2, 1u));
+    }
+
+    MipmapBlitBox computeMipmapBlitBox(const rush::Vec3ui& source, const rush::Vec3ui& destination,
+                                       const rush::Vec3ui& offset, const rush::Vec3ui& size)
+    {
+        uint32_t srcFrom[3], srcTo[3], dstFrom[3], dstTo[3];
+        for (size_t axis = 0; axis < 3; ++axis) {
+            uint64_t src = source[axis];
+            uint64_t dst = destination[axis];
+            uint64_t from = offset[axis];
+            uint64_t to = from + size[axis];
+
+            // Texels of the next level sampling the region, rounded outwards.
+            dstFrom[axis] = static_cast<uint32_t>(from * dst / src);
+            dstTo[axis] = static_cast<uint32_t>(std::min((to * dst + src - 1) / src, dst));
+
+            // The source box that maps to those texels using the same scale as a full blit.
+            srcFrom[axis] = static_cast<uint32_t>(dstFrom[axis] * src / dst);
+            srcTo[axis] = static_cast<uint32_t>(std::min((dstTo[axis] * src + dst - 1) / dst, src));
+        }
+
+        MipmapBlitBox box;
+        box.sourceFrom = rush::Vec3ui(srcFrom[0], srcFrom[1], srcFrom[2]);
+        box.sourceTo = rush::Vec3ui(srcTo[0], srcTo[1], srcTo[2]);
+        box.destinationFrom = rush::Vec3ui(dstFrom[0], dstFrom[1], dstFrom[2]);
+        box.destinationTo = rush::Vec3ui(dstTo[0], dstTo[1], dstTo[2]);
+        return box;
+    }
+} // namespace neon
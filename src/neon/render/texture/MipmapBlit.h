@@ -0,0 +1,44 @@
+#ifndef NEON_MIPMAPBLIT_H
+#define NEON_MIPMAPBLIT_H
+
+#include <rush/vector/vec.h>
+
+namespace neon
+{
+    /**
+     * The boxes of a blit regenerating the texels of a mipmap level
+     * derived from a region of the previous level.
+     * <p>
+     * Boxes are given by their first texel and the texel after their last one.
+     */
+    struct MipmapBlitBox
+    {
+        rush::Vec3ui sourceFrom;
+        rush::Vec3ui sourceTo;
+        rush::Vec3ui destinationFrom;
+        rush::Vec3ui destinationTo;
+    };
+
+    /**
+     * Returns the size of the mipmap level after a level of the given size.
+     * Each dimension is halved, never going below 1.
+     */
+    rush::Vec3ui nextMipmapSize(const rush::Vec3ui& size);
+
+    /**
+     * Computes the blit regenerating the texels of a mipmap level that sample the given region of the previous level.
+     * <p>
+     * The destination box is rounded outwards. The source box is the box that maps to the destination box
+     * using the same scale as a full-level blit, so the regenerated texels match a full regeneration.
+     *
+     * @param source the size of the previous level.
+     * @param destination the size of the regenerated level.
+     * @param offset the first texel of the region in the previous level.
+     * @param size the size of the region.
+     * @return the boxes of the blit.
+     */
+    MipmapBlitBox computeMipmapBlitBox(const rush::Vec3ui& source, const rush::Vec3ui& destination,
+                                       const rush::Vec3ui& offset, const rush::Vec3ui& size);
+} // namespace neon
+
+#endif // NEON_MIPMAPBLIT_H
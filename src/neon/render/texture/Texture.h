@@ -8,6 +8,7 @@
 #include <string>
 #include <optional>
 #include <any>
+#include <vector>
 
 #include <rush/rush.h>
 
@@ -16,10 +17,58 @@
 #include <neon/render/texture/TextureCreateInfo.h>
 #include <neon/filesystem/CMRCFileSystem.h>
 #include <neon/util/Result.h>
+#include <neon/util/task/TaskRunner.h>
 
 namespace neon
 
 {
+    /**
+     * @brief A region of a texture modified by TextureCapabilityModifiable::updateRegions().
+     */
+    struct TextureUpdateRegion
+    {
+        /**
+         * 3D offset in texels where the region begins.
+         */
+        rush::Vec3ui offset;
+
+        /**
+         * Size of the region in texels.
+         */
+        rush::Vec3ui size;
+
+        /**
+         * Index of the first texture layer of the region.
+         */
+        uint32_t layerOffset = 0;
+
+        /**
+         * Number of texture layers of the region.
+         */
+        uint32_t layers = 1;
+    };
+
+    /**
+     * @brief How the mipmaps of a texture are regenerated after its first level is modified.
+     */
+    enum class MipmapRegeneration
+    {
+        /**
+         * Mipmaps are not regenerated. They keep their previous contents.
+         */
+        NONE,
+
+        /**
+         * Only the texels of each level derived from the modified regions are regenerated.
+         */
+        REGIONS,
+
+        /**
+         * All levels are regenerated.
+         */
+        FULL
+    };
+
     /**
      * @brief Capability interface for textures that support dynamic data modification.
      *
@@ -45,6 +94,45 @@ namespace neon
         virtual Result<void, std::string> updateData(const void* data, rush::Vec3ui offset, rush::Vec3ui size,
                                                      uint32_t layerOffset, uint32_t layers,
                                                      CommandBuffer* commandBuffer) = 0;
+
+        /**
+         * @brief Updates several regions of the texture using a single transfer.
+         *
+         * The source data is an image of the given dimensions and layers,
+         * tightly packed, where each region is read at the same offset it is written to.
+         * This matches the dirty rectangles reported by most windowing and web libraries:
+         * only the dirty texels are uploaded.
+         *
+         * @param data Pointer to the source image.
+         * @param dataSize Dimensions of the source image in texels.
+         * @param regions The regions to update.
+         * @param mipmaps How the mipmaps are regenerated.
+         * @param commandBuffer Optional command buffer used for GPU transfer.
+         * @return A Result indicating success or an error message.
+         */
+        virtual Result<void, std::string> updateRegions(const void* data, rush::Vec3ui dataSize,
+                                                        const std::vector<TextureUpdateRegion>& regions,
+                                                        MipmapRegeneration mipmaps, CommandBuffer* commandBuffer) = 0;
+
+        /**
+         * @brief Updates a region of the texture without recording the transfer on the frame's command buffers.
+         *
+         * The data is streamed by the application, using a dedicated transfer queue if the device has one.
+         * Mipmaps are regenerated. Updates requested during the same frame share a single transfer.
+         * Otherwise, the texture must not be used by the GPU or updated again until the returned task finishes.
+         * Synchronous reads and updates of the texture fail while the task is pending.
+         *
+         * @param data Pointer to the source data to upload. It may be freed once this method returns.
+         * @param offset 3D offset in texels where the update should begin.
+         * @param size Size of the region to update in texels.
+         * @param layerOffset Index of the first texture layer to update.
+         * @param layers Number of texture layers to update.
+         * @return The task that finishes when the texture can be used, or an error message.
+         */
+        virtual Result<std::shared_ptr<Task<void>>, std::string> updateDataAsync(const void* data, rush::Vec3ui offset,
+                                                                                rush::Vec3ui size,
+                                                                                uint32_t layerOffset,
+                                                                                uint32_t layers) = 0;
     };
 
     /**
@@ -69,6 +157,25 @@ namespace neon
          */
         virtual Result<void, std::string> readData(void* data, rush::Vec3ui offset, rush::Vec3ui size,
                                                    uint32_t layerOffset, uint32_t layers) const = 0;
+
+        /**
+         * @brief Reads a region of the texture without blocking the calling thread.
+         *
+         * The copy is recorded and submitted immediately into a pooled readback buffer.
+         * The returned task finishes once the GPU has executed the copy,
+         * holding the pixel data or an error message.
+         * <p>
+         * The task is resolved by the application's TaskRunner while it flushes the main thread tasks.
+         * Don't block the main thread waiting for it: use Task::then() or poll Task::hasFinished() instead.
+         *
+         * @param offset 3D offset in texels where the read should begin.
+         * @param size Size of the region to read in texels.
+         * @param layerOffset Index of the first texture layer to read.
+         * @param layers Number of texture layers to read.
+         * @return The task that will hold the pixel data.
+         */
+        [[nodiscard]] virtual std::shared_ptr<Task<Result<std::vector<std::byte>, std::string>>> readDataAsync(
+            rush::Vec3ui offset, rush::Vec3ui size, uint32_t layerOffset, uint32_t layers) const = 0;
     };
 
     /**
@@ -4,6 +4,7 @@
 
 #include "Application.h"
 
+#include <neon/filesystem/FileSystem.h>
 #include <neon/io/CharEvent.h>
 #include <neon/structure/Room.h>
 #include <neon/io/KeyboardEvent.h>
@@ -141,6 +142,16 @@ namespace neon
         _render = render;
     }
 
+    const std::shared_ptr<FileSystem>& Application::getShaderCache() const
+    {
+        return _shaderCache;
+    }
+
+    void Application::setShaderCache(const std::shared_ptr<FileSystem>& shaderCache)
+    {
+        _shaderCache = shaderCache;
+    }
+
     FrameInformation Application::getCurrentFrameInformation() const
     {
         return _implementation->getCurrentFrameInformation();
@@ -30,6 +30,8 @@ namespace neon
 
     class CommandBuffer;
 
+    class FileSystem;
+
     class Application;
 
     /**
@@ -146,6 +148,7 @@ namespace neon
         AssetLoaderCollection _assetLoaders;
         TaskRunner _taskRunner;
         std::shared_ptr<Render> _render;
+        std::shared_ptr<FileSystem> _shaderCache;
         std::optional<rush::Vec2i> _forcedViewport;
 
       public:
@@ -293,6 +296,23 @@ namespace neon
          */
         void setRender(const std::shared_ptr<Render>& render);
 
+        /**
+         * @brief Returns the file system where compiled shaders are cached.
+         * @return the file system, or null if compiled shaders are not cached.
+         */
+        [[nodiscard]] const std::shared_ptr<FileSystem>& getShaderCache() const;
+
+        /**
+         * @brief Sets the file system where compiled shaders are cached.
+         *
+         * Shader programs compiled afterward look for their compiled code in this file system
+         * before invoking the shader compiler, and store it after compiling it.
+         * The file system must be writable for the compiled code to be stored.
+         *
+         * @param shaderCache the file system, or null to disable the cache.
+         */
+        void setShaderCache(const std::shared_ptr<FileSystem>& shaderCache);
+
         /**
          * @brief Returns the current frame information.
          * @return the current frame information.
@@ -56,6 +56,9 @@ namespace neon
         template<class T>
         friend class IdentifiableWrapper;
 
+        template<class T>
+        friend class ComponentDispatcher;
+
         uint64_t _id;
         bool _started;
         bool _enabled;
@@ -163,6 +166,11 @@ namespace neon
 
         /**
          * Virtual method invoked every game tick.
+         * <p>
+         * Component types that declare "static constexpr bool PARALLEL_UPDATE = true"
+         * have this method invoked concurrently from the application's TaskRunner workers.
+         * See ParallelUpdateComponent.
+         *
          * @param deltaTime the time between the last and the current tick, in seconds.
          */
         virtual void onUpdate(float deltaTime);
@@ -171,6 +179,10 @@ namespace neon
          * Virtual method invoked every game tick.
          * This method is invoked after all "onUpdate" methods
          * from all components have been called.
+         * <p>
+         * Component types that declare "static constexpr bool PARALLEL_LATE_UPDATE = true"
+         * have this method invoked concurrently from the application's TaskRunner workers.
+         * See ParallelLateUpdateComponent.
          *
          * @param deltaTime the time between the last and the current tick, in seconds.
          */
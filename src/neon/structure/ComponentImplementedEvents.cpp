@@ -12,7 +12,7 @@ namespace neon
         std::type_index onConstructionFunction, std::type_index onStartFunction, std::type_index onUpdateFunction,
         std::type_index onLateUpdateFunction, std::type_index onPreDrawFunction, std::type_index onKeyFunction,
         std::type_index onCharFunction, std::type_index onMouseButtonFunction, std::type_index onCursorMoveFunction,
-        std::type_index onScrollFunction) :
+        std::type_index onScrollFunction, bool parallelUpdate, bool parallelLateUpdate) :
         onConstruction(onConstructionFunction != typeid(&Component::onConstruction)),
         onStart(onStartFunction != typeid(&Component::onStart)),
         onUpdate(onUpdateFunction != typeid(&Component::onUpdate)),
@@ -22,7 +22,9 @@ namespace neon
         onChar(onCharFunction != typeid(&Component::onChar)),
         onMouseButton(onMouseButtonFunction != typeid(&Component::onMouseButton)),
         onCursorMove(onCursorMoveFunction != typeid(&Component::onCursorMove)),
-        onScroll(onScrollFunction != typeid(&Component::onScroll))
+        onScroll(onScrollFunction != typeid(&Component::onScroll)),
+        parallelUpdate(parallelUpdate),
+        parallelLateUpdate(parallelLateUpdate)
     {
     }
 } // namespace neon
@@ -9,6 +9,27 @@
 
 namespace neon
 {
+    /**
+     * Component types that satisfy this concept have their onUpdate() method
+     * invoked concurrently from the workers of the application's TaskRunner.
+     * <p>
+     * To opt in, declare "static constexpr bool PARALLEL_UPDATE = true;" inside the component.
+     * Its onUpdate() implementation must only modify the component itself or
+     * data that is protected against concurrent access.
+     * Creating or destroying components or game objects inside it is not allowed.
+     */
+    template<class T>
+    concept ParallelUpdateComponent = requires { requires T::PARALLEL_UPDATE; };
+
+    /**
+     * Component types that satisfy this concept have their onLateUpdate() method
+     * invoked concurrently from the workers of the application's TaskRunner.
+     * <p>
+     * To opt in, declare "static constexpr bool PARALLEL_LATE_UPDATE = true;" inside the component.
+     * The same restrictions of ParallelUpdateComponent apply.
+     */
+    template<class T>
+    concept ParallelLateUpdateComponent = requires { requires T::PARALLEL_LATE_UPDATE; };
 
     /**
      * This class helps to determine which events
@@ -24,7 +45,8 @@ namespace neon
             return ComponentImplementedEvents(typeid(&T::onConstruction), typeid(&T::onStart), typeid(&T::onUpdate),
                                               typeid(&T::onLateUpdate), typeid(&T::onPreDraw), typeid(&T::onKey),
                                               typeid(&T::onChar), typeid(&T::onMouseButton), typeid(&T::onCursorMove),
-                                              typeid(&T::onScroll));
+                                              typeid(&T::onScroll), ParallelUpdateComponent<T>,
+                                              ParallelLateUpdateComponent<T>);
         }
 
         bool onConstruction;
@@ -37,12 +59,15 @@ namespace neon
         bool onMouseButton;
         bool onCursorMove;
         bool onScroll;
+        bool parallelUpdate;
+        bool parallelLateUpdate;
 
         ComponentImplementedEvents(std::type_index onConstructionFunction, std::type_index onStartFunction,
                                    std::type_index onUpdateFunction, std::type_index onLateUpdateFunction,
                                    std::type_index onPreDrawFunction, std::type_index onKeyFunction,
                                    std::type_index onCharFunction, std::type_index onMouseButtonFunction,
-                                   std::type_index onCursorMoveFunction, std::type_index onScrollFunction);
+                                   std::type_index onCursorMoveFunction, std::type_index onScrollFunction,
+                                   bool parallelUpdate = false, bool parallelLateUpdate = false);
     };
 } // namespace neon
 
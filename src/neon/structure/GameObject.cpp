@@ -11,28 +11,33 @@ namespace neon
 {
     uint64_t GAME_OBJECT_ID_GENERATOR = 1;
 
+    namespace
+    {
+        TransformHierarchy& getHierarchy(Room* room)
+        {
+            if (room == nullptr) {
+                throw std::runtime_error("Room is null!");
+            }
+            return room->getTransformHierarchy();
+        }
+    } // namespace
+
     GameObject::GameObject(Room* room) :
         _id(GAME_OBJECT_ID_GENERATOR++),
         _name(std::format("Game Object {}", _id)),
-        _transform(this),
+        _transform(this, getHierarchy(room)),
         _room(room),
         _parent(nullptr)
     {
-        if (_room == nullptr) {
-            throw std::runtime_error("Room is null!");
-        }
     }
 
     GameObject::GameObject(Room* room, std::string name) :
         _id(GAME_OBJECT_ID_GENERATOR++),
         _name(std::move(name)),
-        _transform(this),
+        _transform(this, getHierarchy(room)),
         _room(room),
         _parent(nullptr)
     {
-        if (_room == nullptr) {
-            throw std::runtime_error("Room is null!");
-        }
     }
 
     GameObject::~GameObject()
@@ -99,6 +104,8 @@ namespace neon
         if (_parent) {
             _parent->_children.insert(IdentifiableWrapper<GameObject>(this));
         }
+
+        _transform.markParentChanged();
     }
 
     const std::unordered_set<IdentifiableWrapper<GameObject>>& GameObject::getChildren() const
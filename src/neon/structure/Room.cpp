@@ -11,6 +11,7 @@
 #include <neon/structure/GameObject.h>
 #include <neon/structure/Component.h>
 #include <neon/structure/Application.h>
+#include <neon/render/FrustumCuller.h>
 #include <neon/render/GraphicComponent.h>
 
 namespace neon
@@ -22,6 +23,7 @@ namespace neon
     Room::Room(Application* application) :
         _application(application),
         _camera(Frustum(DEFAULT_FRUSTUM_NEAR, DEFAULT_FRUSTUM_FAR, 1.0f, DEFAULT_FRUSTUM_FOV)),
+        _transformHierarchy(),
         _gameObjects(),
         _components(),
         _usedModels()
@@ -50,6 +52,16 @@ namespace neon
         return _camera;
     }
 
+    const TransformHierarchy& Room::getTransformHierarchy() const
+    {
+        return _transformHierarchy;
+    }
+
+    TransformHierarchy& Room::getTransformHierarchy()
+    {
+        return _transformHierarchy;
+    }
+
     const ComponentCollection& Room::getComponents() const
     {
         return _components;
@@ -90,7 +102,9 @@ namespace neon
 
     void Room::destroyComponentLater(IdentifiableWrapper<neon::Component> component)
     {
-        _destroyLater.insert(component);
+        if (auto handle = _components.getHandle(component.raw())) {
+            _destroyLater.insert(handle);
+        }
     }
 
     size_t Room::getGameObjectAmount()
@@ -248,21 +262,22 @@ namespace neon
 
     void Room::update(float deltaTime)
     {
-        for (const auto& component : _destroyLater) {
-            if (component.isValid()) {
+        for (const auto& handle : _destroyLater) {
+            if (auto* component = handle.get()) {
                 component->destroy();
             }
         }
         _destroyLater.clear();
 
         auto& p = getApplication()->getProfiler();
+        auto& runner = getApplication()->getTaskRunner();
         {
             DEBUG_PROFILE(p, update);
-            _components.updateComponents(p, deltaTime);
+            _components.updateComponents(p, runner, deltaTime);
         }
         {
             DEBUG_PROFILE(p, lateUpdate);
-            _components.lateUpdateComponents(p, deltaTime);
+            _components.lateUpdateComponents(p, runner, deltaTime);
         }
     }
 
@@ -272,14 +287,17 @@ namespace neon
         auto* cb = _application->getCurrentCommandBuffer();
 
         DEBUG_PROFILE(p, preDraw);
+        {
+            DEBUG_PROFILE(p, transforms);
+            _transformHierarchy.update(getApplication()->getTaskRunner());
+        }
         _components.preDrawComponents(p);
         {
             DEBUG_PROFILE(p, models);
+            FrustumCuller culler(_camera.getPlanes());
             for (const auto& [model, amount] : _usedModels) {
                 if (model->shouldAutoFlush()) {
-                    for (auto& instanceData : model->getInstanceDatas()) {
-                        instanceData->flush(cb);
-                    }
+                    model->flushInstances(cb, culler);
                 }
                 if (model->getUniformBuffer() != nullptr) {
                     model->getUniformBuffer()->prepareForFrame(cb);
@@ -290,15 +308,7 @@ namespace neon
             DEBUG_PROFILE(p, uniformBuffers);
             _application->getRender()->getGlobalUniformBuffer().prepareForFrame(cb);
 
-            std::unordered_set<Material*> materials;
-
-            for (const auto& [model, amount] : _usedModels) {
-                for (int i = 0; i < model->getMeshesAmount(); ++i) {
-                    for (const auto& mat : model->getDrawable(i)->getMaterials()) {
-                        materials.insert(mat.get());
-                    }
-                }
-
+            for (const auto& model : _usedModels | std::views::keys) {
                 for (auto [location, buffer] : model->getUniformBufferBindings() | std::views::values) {
                     if (location == ModelBufferLocation::EXTRA && buffer != nullptr) {
                         buffer->prepareForFrame(cb);
@@ -306,7 +316,8 @@ namespace neon
                 }
             }
 
-            for (const auto& material : materials) {
+            _renderQueue.refresh();
+            for (const auto& material : _renderQueue.getSortedMaterials()) {
                 if (material->getUniformBuffer() != nullptr) {
                     material->getUniformBuffer()->prepareForFrame(cb);
                 }
@@ -319,9 +330,21 @@ namespace neon
         return _usedModels;
     }
 
+    const RenderQueue& Room::getRenderQueue() const
+    {
+        return _renderQueue;
+    }
+
+    RenderQueue& Room::getRenderQueue()
+    {
+        return _renderQueue;
+    }
+
     void Room::markUsingModel(neon::Model* model)
     {
-        ++_usedModels[model];
+        if (++_usedModels[model] == 1) {
+            _renderQueue.addModel(model);
+        }
     }
 
     void Room::unmarkUsingModel(neon::Model* model)
@@ -332,6 +355,7 @@ namespace neon
         }
         if (it->second <= 1) {
             _usedModels.erase(model);
+            _renderQueue.removeModel(model);
         } else {
             --it->second;
         }
@@ -9,11 +9,13 @@
 #include <unordered_set>
 
 #include <neon/geometry/Camera.h>
+#include <neon/geometry/TransformHierarchy.h>
 
 #include <neon/structure/collection/ComponentCollection.h>
 #include <neon/structure/collection/IdentifiableCollection.h>
 #include <neon/structure/GameObject.h>
 #include <neon/render/Render.h>
+#include <neon/render/RenderQueue.h>
 
 #include <neon/util/ClusteredLinkedCollection.h>
 
@@ -42,12 +44,14 @@ namespace neon
         Application* _application;
 
         Camera _camera;
+        TransformHierarchy _transformHierarchy; // Must outlive the game objects.
         ClusteredLinkedCollection<GameObject> _gameObjects;
         ComponentCollection _components;
 
         std::unordered_map<Model*, uint32_t> _usedModels;
+        RenderQueue _renderQueue;
 
-        std::unordered_set<IdentifiableWrapper<Component>> _destroyLater;
+        std::unordered_set<ClusteredHandle<Component>> _destroyLater;
 
       public:
         Room(const Room& other) = delete;
@@ -62,6 +66,10 @@ namespace neon
 
         [[nodiscard]] Camera& getCamera();
 
+        [[nodiscard]] const TransformHierarchy& getTransformHierarchy() const;
+
+        [[nodiscard]] TransformHierarchy& getTransformHierarchy();
+
         [[nodiscard]] const ComponentCollection& getComponents() const;
 
         [[nodiscard]] ComponentCollection& getComponents();
@@ -86,6 +94,15 @@ namespace neon
 
         const std::unordered_map<Model*, uint32_t>& usedModels() const;
 
+        /**
+         * Returns the draw list of this room.
+         * The list contains the draw items of all models used by this room.
+         * It is refreshed once per frame, before rendering.
+         */
+        [[nodiscard]] const RenderQueue& getRenderQueue() const;
+
+        [[nodiscard]] RenderQueue& getRenderQueue();
+
         /**
          * THIS METHOD SHOULD ONLY BE USED BY GRAPHIC COMPONENTS!
          * USERS MUSTN'T USE THIS METHOD.
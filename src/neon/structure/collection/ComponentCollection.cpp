@@ -11,6 +11,7 @@
 #include <neon/structure/Component.h>
 #include <neon/render/GraphicComponent.h>
 #include <neon/render/model/Model.h>
+#include <neon/util/task/TaskRunner.h>
 
 namespace neon
 {
@@ -18,6 +19,20 @@ namespace neon
     {
     }
 
+    ClusteredHandle<Component> ComponentCollection::getHandle(Component* component) const
+    {
+        if (component == nullptr) {
+            return {};
+        }
+
+        auto it = _components.find(typeid(*component));
+        if (it == _components.end()) {
+            return {};
+        }
+
+        return it->second->getHandle(component);
+    }
+
     void ComponentCollection::destroyComponent(const IdentifiableWrapper<Component>& component)
     {
         auto& type = typeid(*component.raw());
@@ -30,8 +45,7 @@ namespace neon
             component->onDisable();
         }
 
-        auto collection = std::reinterpret_pointer_cast<AbstractClusteredLinkedCollection>(it->second.second);
-        if (!collection->erase(component.raw())) {
+        if (!it->second->getCollection()->erase(component.raw())) {
             std::cerr << "Failed to erase component: " << typeid(Component).name() << std::endl;
         }
     }
@@ -39,176 +53,104 @@ namespace neon
     void ComponentCollection::invokeKeyEvent(Profiler& profiler, const KeyboardEvent& event)
     {
         flushNotStartedComponents();
-        for (const auto& [type, data] : _components) {
-            if (!data.first.onKey) {
+        for (const auto& [type, dispatcher] : _components) {
+            if (!dispatcher->getEvents().onKey) {
                 continue;
             }
 
-            auto entry = ComponentRegister::instance().getEntry(type);
-            auto name = entry.has_value() ? entry->name.c_str() : type.name();
-            DEBUG_PROFILE_ID(profiler, type, name);
-
-            auto ptr = std::static_pointer_cast<AbstractClusteredLinkedCollection>(data.second);
-            ptr->forEachRaw([&event](void* ptr) {
-                auto* component = reinterpret_cast<Component*>(ptr);
-                if (component->isEnabled() && component->hasStarted()) {
-                    component->onKey(event);
-                }
-            });
+            DEBUG_PROFILE_ID(profiler, type, dispatcher->getName());
+            dispatcher->invokeKeyEvent(event);
         }
     }
 
     void ComponentCollection::invokeCharEvent(Profiler& profiler, const CharEvent& event)
     {
         flushNotStartedComponents();
-        for (const auto& [type, data] : _components) {
-            if (!data.first.onChar) {
+        for (const auto& [type, dispatcher] : _components) {
+            if (!dispatcher->getEvents().onChar) {
                 continue;
             }
 
-            auto entry = ComponentRegister::instance().getEntry(type);
-            auto name = entry.has_value() ? entry->name.c_str() : type.name();
-            DEBUG_PROFILE_ID(profiler, type, name);
-
-            auto ptr = std::static_pointer_cast<AbstractClusteredLinkedCollection>(data.second);
-            ptr->forEachRaw([&event](void* ptr) {
-                auto* component = reinterpret_cast<Component*>(ptr);
-                if (component->isEnabled() && component->hasStarted()) {
-                    component->onChar(event);
-                }
-            });
+            DEBUG_PROFILE_ID(profiler, type, dispatcher->getName());
+            dispatcher->invokeCharEvent(event);
         }
     }
 
     void ComponentCollection::invokeMouseButtonEvent(neon::Profiler& profiler, const MouseButtonEvent& event)
     {
         flushNotStartedComponents();
-        for (const auto& [type, data] : _components) {
-            if (!data.first.onMouseButton) {
+        for (const auto& [type, dispatcher] : _components) {
+            if (!dispatcher->getEvents().onMouseButton) {
                 continue;
             }
 
-            auto entry = ComponentRegister::instance().getEntry(type);
-            auto name = entry.has_value() ? entry->name.c_str() : type.name();
-            DEBUG_PROFILE_ID(profiler, type, name);
-
-            auto ptr = std::static_pointer_cast<AbstractClusteredLinkedCollection>(data.second);
-            ptr->forEachRaw([&event](void* ptr) {
-                auto* component = reinterpret_cast<Component*>(ptr);
-                if (component->isEnabled() && component->hasStarted()) {
-                    component->onMouseButton(event);
-                }
-            });
+            DEBUG_PROFILE_ID(profiler, type, dispatcher->getName());
+            dispatcher->invokeMouseButtonEvent(event);
         }
     }
 
     void ComponentCollection::invokeCursorMoveEvent(Profiler& profiler, const CursorMoveEvent& event)
     {
         flushNotStartedComponents();
-        for (const auto& [type, data] : _components) {
-            if (!data.first.onCursorMove) {
+        for (const auto& [type, dispatcher] : _components) {
+            if (!dispatcher->getEvents().onCursorMove) {
                 continue;
             }
 
-            auto entry = ComponentRegister::instance().getEntry(type);
-            auto name = entry.has_value() ? entry->name.c_str() : type.name();
-            DEBUG_PROFILE_ID(profiler, type, name);
-
-            auto ptr = std::static_pointer_cast<AbstractClusteredLinkedCollection>(data.second);
-            ptr->forEachRaw([&event](void* ptr) {
-                auto* component = reinterpret_cast<Component*>(ptr);
-                if (component->isEnabled() && component->hasStarted()) {
-                    component->onCursorMove(event);
-                }
-            });
+            DEBUG_PROFILE_ID(profiler, type, dispatcher->getName());
+            dispatcher->invokeCursorMoveEvent(event);
         }
     }
 
     void ComponentCollection::invokeScrollEvent(Profiler& profiler, const ScrollEvent& event)
     {
         flushNotStartedComponents();
-        for (const auto& [type, data] : _components) {
-            if (!data.first.onScroll) {
+        for (const auto& [type, dispatcher] : _components) {
+            if (!dispatcher->getEvents().onScroll) {
                 continue;
             }
 
-            auto entry = ComponentRegister::instance().getEntry(type);
-            auto name = entry.has_value() ? entry->name.c_str() : type.name();
-            DEBUG_PROFILE_ID(profiler, type, name);
-
-            auto ptr = std::static_pointer_cast<AbstractClusteredLinkedCollection>(data.second);
-            ptr->forEachRaw([&event](void* ptr) {
-                auto* component = reinterpret_cast<Component*>(ptr);
-                if (component->isEnabled() && component->hasStarted()) {
-                    component->onScroll(event);
-                }
-            });
+            DEBUG_PROFILE_ID(profiler, type, dispatcher->getName());
+            dispatcher->invokeScrollEvent(event);
         }
     }
 
-    void ComponentCollection::updateComponents(Profiler& profiler, float deltaTime)
+    void ComponentCollection::updateComponents(Profiler& profiler, TaskRunner& runner, float deltaTime)
     {
         flushNotStartedComponents();
-        for (const auto& [type, data] : _components) {
-            if (!data.first.onUpdate) {
+        for (const auto& [type, dispatcher] : _components) {
+            if (!dispatcher->getEvents().onUpdate) {
                 continue;
             }
 
-            auto entry = ComponentRegister::instance().getEntry(type);
-            auto name = entry.has_value() ? entry->name.c_str() : type.name();
-            DEBUG_PROFILE_ID(profiler, type, name);
-
-            auto ptr = std::static_pointer_cast<AbstractClusteredLinkedCollection>(data.second);
-            ptr->forEachRaw([deltaTime](void* ptr) {
-                auto* component = reinterpret_cast<Component*>(ptr);
-                if (component->isEnabled() && component->hasStarted()) {
-                    component->onUpdate(deltaTime);
-                }
-            });
+            DEBUG_PROFILE_ID(profiler, type, dispatcher->getName());
+            dispatcher->update(runner, deltaTime);
         }
     }
 
-    void ComponentCollection::lateUpdateComponents(Profiler& profiler, float deltaTime)
+    void ComponentCollection::lateUpdateComponents(Profiler& profiler, TaskRunner& runner, float deltaTime)
     {
         flushNotStartedComponents();
-        for (const auto& [type, data] : _components) {
-            if (!data.first.onLateUpdate) {
+        for (const auto& [type, dispatcher] : _components) {
+            if (!dispatcher->getEvents().onLateUpdate) {
                 continue;
             }
 
-            auto entry = ComponentRegister::instance().getEntry(type);
-            auto name = entry.has_value() ? entry->name.c_str() : type.name();
-            DEBUG_PROFILE_ID(profiler, type, name);
-
-            auto ptr = std::static_pointer_cast<AbstractClusteredLinkedCollection>(data.second);
-            ptr->forEachRaw([deltaTime](void* ptr) {
-                auto* component = reinterpret_cast<Component*>(ptr);
-                if (component->isEnabled() && component->hasStarted()) {
-                    component->onLateUpdate(deltaTime);
-                }
-            });
+            DEBUG_PROFILE_ID(profiler, type, dispatcher->getName());
+            dispatcher->lateUpdate(runner, deltaTime);
         }
     }
 
     void ComponentCollection::preDrawComponents(Profiler& profiler)
     {
         flushNotStartedComponents();
-        for (const auto& [type, data] : _components) {
-            if (!data.first.onPreDraw) {
+        for (const auto& [type, dispatcher] : _components) {
+            if (!dispatcher->getEvents().onPreDraw) {
                 continue;
             }
 
-            auto entry = ComponentRegister::instance().getEntry(type);
-            auto name = entry.has_value() ? entry->name.c_str() : type.name();
-            DEBUG_PROFILE_ID(profiler, type, name);
-
-            auto ptr = std::static_pointer_cast<AbstractClusteredLinkedCollection>(data.second);
-            ptr->forEachRaw([](void* ptr) {
-                auto* component = reinterpret_cast<Component*>(ptr);
-                if (component->isEnabled() && component->hasStarted()) {
-                    component->onPreDraw();
-                }
-            });
+            DEBUG_PROFILE_ID(profiler, type, dispatcher->getName());
+            dispatcher->preDraw();
         }
     }
 
@@ -217,17 +159,23 @@ namespace neon
         reinterpret_cast<Component*>(rawComponent)->onConstruction();
     }
 
+    std::string ComponentCollection::fetchComponentName(const std::type_index& type)
+    {
+        auto entry = ComponentRegister::instance().getEntry(type);
+        return entry.has_value() ? entry->name : type.name();
+    }
+
     void ComponentCollection::flushNotStartedComponents()
     {
         for (; !_notStartedComponents.empty(); _notStartedComponents.pop()) {
-            auto ptr = _notStartedComponents.front();
+            auto* component = _notStartedComponents.front().get();
 
-            if (ptr.isValid()) {
-                if (ptr->isEnabled()) {
-                    ptr->onEnable();
+            if (component != nullptr) {
+                if (component->isEnabled()) {
+                    component->onEnable();
                 }
-                ptr->onStart();
-                ptr->_started = true;
+                component->onStart();
+                component->_started = true;
             }
         }
     }
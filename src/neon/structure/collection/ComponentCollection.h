@@ -12,6 +12,8 @@
 
 #include <neon/structure/IdentifiableWrapper.h>
 #include <neon/structure/ComponentImplementedEvents.h>
+#include <neon/structure/collection/ComponentDispatcher.h>
+#include <neon/util/ClusteredHandle.h>
 #include <neon/util/ClusteredLinkedCollection.h>
 #include <neon/util/profile/Profiler.h>
 
@@ -24,6 +26,8 @@ namespace neon
 
     class GraphicComponent;
 
+    class TaskRunner;
+
     struct KeyboardEvent;
 
     struct MouseButtonEvent;
@@ -39,11 +43,13 @@ namespace neon
      */
     class ComponentCollection
     {
-        std::unordered_map<std::type_index, std::pair<ComponentImplementedEvents, std::shared_ptr<void>>> _components;
-        std::queue<IdentifiableWrapper<Component>> _notStartedComponents;
+        std::unordered_map<std::type_index, std::unique_ptr<AbstractComponentDispatcher>> _components;
+        std::queue<ClusteredHandle<Component>> _notStartedComponents;
 
         static void callOnConstruction(void* rawComponent);
 
+        static std::string fetchComponentName(const std::type_index& type);
+
         void flushNotStartedComponents();
 
       public:
@@ -71,24 +77,17 @@ namespace neon
             auto it = _components.find(typeid(T));
 
             if (it == _components.end()) {
-                auto events = ComponentImplementedEvents::fromGeneric<T>();
                 auto pointer = std::make_shared<ClusteredLinkedCollection<T>>();
-                _components.insert(std::make_pair(std::type_index(typeid(T)),
-                                                  std::make_pair(events, std::static_pointer_cast<void>(pointer))));
-
-                T* component = pointer->emplace(std::forward<Args>(values)...);
-                _notStartedComponents.push(static_cast<Component*>(component));
-                if (events.onConstruction) {
-                    callOnConstruction(component);
-                }
-                return component;
+                auto dispatcher = std::make_unique<ComponentDispatcher<T>>(pointer, fetchComponentName(typeid(T)));
+                it = _components.emplace(std::type_index(typeid(T)), std::move(dispatcher)).first;
             }
 
-            auto components = std::static_pointer_cast<ClusteredLinkedCollection<T>>(it->second.second);
+            auto* dispatcher = static_cast<ComponentDispatcher<T>*>(it->second.get());
 
-            T* component = components->emplace(std::forward<Args>(values)...);
-            _notStartedComponents.push(static_cast<Component*>(component));
-            if (it->second.first.onConstruction) {
+            auto& collection = *dispatcher->getTypedCollection();
+            T* component = collection.emplace(std::forward<Args>(values)...);
+            _notStartedComponents.push(ClusteredHandle<T>(collection, component));
+            if (dispatcher->getEvents().onConstruction) {
                 callOnConstruction(component);
             }
             return component;
@@ -110,9 +109,19 @@ namespace neon
             if (it == _components.end()) {
                 return nullptr;
             }
-            return std::reinterpret_pointer_cast<ClusteredLinkedCollection<T>>(it->second.second);
+            return static_cast<ComponentDispatcher<T>*>(it->second.get())->getTypedCollection();
         }
 
+        /**
+         * Creates a handle pointing to the given component.
+         * <p>
+         * The handle becomes invalid once the component is destroyed.
+         *
+         * @param component the component.
+         * @return the handle, or an invalid handle if the component is not inside this collection.
+         */
+        [[nodiscard]] ClusteredHandle<Component> getHandle(Component* component) const;
+
         /**
          * Destroys the given component.
          *
@@ -168,20 +177,34 @@ namespace neon
          * USERS MUSTN'T USE THIS METHOD.
          * <p>
          * Calls onUpdate() on all components.
+         * <p>
+         * Component types that satisfy ParallelUpdateComponent are updated
+         * using the given runner, processing each cluster of their collection
+         * in a different task. This method returns once all components
+         * have been updated.
+         *
          * @param profiler the profiler.
+         * @param runner the runner used to update parallel-safe components.
          * @param deltaTime the delay between this frame and the last one, in seconds.
          */
-        void updateComponents(Profiler& profiler, float deltaTime);
+        void updateComponents(Profiler& profiler, TaskRunner& runner, float deltaTime);
 
         /**
          * THIS METHOD SHOULD ONLY BE USED BY ROOMS!
          * USERS MUSTN'T USE THIS METHOD.
          * <p>
          * Calls onLateUpdate() on all components.
+         * <p>
+         * Component types that satisfy ParallelLateUpdateComponent are updated
+         * using the given runner, processing each cluster of their collection
+         * in a different task. This method returns once all components
+         * have been updated.
+         *
          * @param profiler the profiler.
+         * @param runner the runner used to update parallel-safe components.
          * @param deltaTime the delay between this frame and the last one, in seconds.
          */
-        void lateUpdateComponents(Profiler& profiler, float deltaTime);
+        void lateUpdateComponents(Profiler& profiler, TaskRunner& runner, float deltaTime);
 
         /**
          * THIS METHOD SHOULD ONLY BE USED BY ROOMS!
@@ -0,0 +1,223 @@
+#ifndef NEON_COMPONENTDISPATCHER_H
+#define NEON_COMPONENTDISPATCHER_H
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <neon/structure/ComponentImplementedEvents.h>
+#include <neon/util/ClusteredHandle.h>
+#include <neon/util/ClusteredLinkedCollection.h>
+#include <neon/util/task/TaskRunner.h>
+
+namespace neon
+{
+    class Component;
+
+    struct KeyboardEvent;
+
+    struct MouseButtonEvent;
+
+    struct CursorMoveEvent;
+
+    struct ScrollEvent;
+
+    struct CharEvent;
+
+    /**
+     * Invokes the events of all components of a single type.
+     * <p>
+     * ComponentCollection creates one dispatcher per component type.
+     * This allows the collection to invoke each event with only
+     * one virtual call per type, instead of one per component.
+     */
+    class AbstractComponentDispatcher
+    {
+        ComponentImplementedEvents _events;
+        std::string _name;
+
+      public:
+        AbstractComponentDispatcher(const AbstractComponentDispatcher& other) = delete;
+
+        /**
+         * Creates the dispatcher.
+         * @param events the events implemented by the component type.
+         * @param name the name of the component type. Used by the profiler.
+         */
+        AbstractComponentDispatcher(ComponentImplementedEvents events, std::string name) :
+            _events(events),
+            _name(std::move(name))
+        {
+        }
+
+        virtual ~AbstractComponentDispatcher() = default;
+
+        /**
+         * @return the events implemented by the component type.
+         */
+        [[nodiscard]] const ComponentImplementedEvents& getEvents() const
+        {
+            return _events;
+        }
+
+        /**
+         * @return the name of the component type.
+         */
+        [[nodiscard]] const std::string& getName() const
+        {
+            return _name;
+        }
+
+        /**
+         * @return the collection holding all components of the type.
+         */
+        [[nodiscard]] virtual std::shared_ptr<AbstractClusteredLinkedCollection> getCollection() const = 0;
+
+        /**
+         * Creates a handle pointing to the given component.
+         * The component's dynamic type must be the type of this dispatcher.
+         *
+         * @param component the component.
+         * @return the handle.
+         */
+        [[nodiscard]] virtual ClusteredHandle<Component> getHandle(Component* component) const = 0;
+
+        virtual void invokeKeyEvent(const KeyboardEvent& event) = 0;
+
+        virtual void invokeCharEvent(const CharEvent& event) = 0;
+
+        virtual void invokeMouseButtonEvent(const MouseButtonEvent& event) = 0;
+
+        virtual void invokeCursorMoveEvent(const CursorMoveEvent& event) = 0;
+
+        virtual void invokeScrollEvent(const ScrollEvent& event) = 0;
+
+        virtual void update(TaskRunner& runner, float deltaTime) = 0;
+
+        virtual void lateUpdate(TaskRunner& runner, float deltaTime) = 0;
+
+        virtual void preDraw() = 0;
+    };
+
+    /**
+     * Dispatcher implementation for the component type T.
+     * <p>
+     * Events are invoked in a tight loop over the occupied
+     * slots of the collection, calling T's implementation directly
+     * instead of using the virtual methods of Component.
+     *
+     * @tparam T the type of the components.
+     */
+    template<class T>
+    class ComponentDispatcher final : public AbstractComponentDispatcher
+    {
+        std::shared_ptr<ClusteredLinkedCollection<T>> _collection;
+
+        template<class Base = Component>
+        static bool isActive(const T& component)
+        {
+            auto& base = static_cast<const Base&>(component);
+            return base._enabled && base._started;
+        }
+
+        template<class Func>
+        void forEachActive(Func&& function)
+        {
+            for (T& component : *_collection) {
+                if (isActive(component)) {
+                    function(component);
+                }
+            }
+        }
+
+        template<class Func>
+        void forEachActiveInParallel(TaskRunner& runner, Func&& function)
+        {
+            runner.parallelFor(0, _collection->getClusterAmount(), 1, [this, &function](size_t cluster) {
+                _collection->forEachInCluster(cluster, [&function](T& component) {
+                    if (isActive(component)) {
+                        function(component);
+                    }
+                });
+            });
+        }
+
+      public:
+        ComponentDispatcher(std::shared_ptr<ClusteredLinkedCollection<T>> collection, std::string name) :
+            AbstractComponentDispatcher(ComponentImplementedEvents::fromGeneric<T>(), std::move(name)),
+            _collection(std::move(collection))
+        {
+        }
+
+        [[nodiscard]] std::shared_ptr<AbstractClusteredLinkedCollection> getCollection() const override
+        {
+            return _collection;
+        }
+
+        [[nodiscard]] ClusteredHandle<Component> getHandle(Component* component) const override
+        {
+            // The caller has already checked the dynamic type: a static_cast is enough.
+            return ClusteredHandle<T>(*_collection, static_cast<T*>(component));
+        }
+
+        /**
+         * @return the collection holding all components of type T.
+         */
+        [[nodiscard]] const std::shared_ptr<ClusteredLinkedCollection<T>>& getTypedCollection() const
+        {
+            return _collection;
+        }
+
+        void invokeKeyEvent(const KeyboardEvent& event) override
+        {
+            forEachActive([&event](T& component) { component.T::onKey(event); });
+        }
+
+        void invokeCharEvent(const CharEvent& event) override
+        {
+            forEachActive([&event](T& component) { component.T::onChar(event); });
+        }
+
+        void invokeMouseButtonEvent(const MouseButtonEvent& event) override
+        {
+            forEachActive([&event](T& component) { component.T::onMouseButton(event); });
+        }
+
+        void invokeCursorMoveEvent(const CursorMoveEvent& event) override
+        {
+            forEachActive([&event](T& component) { component.T::onCursorMove(event); });
+        }
+
+        void invokeScrollEvent(const ScrollEvent& event) override
+        {
+            forEachActive([&event](T& component) { component.T::onScroll(event); });
+        }
+
+        void update(TaskRunner& runner, float deltaTime) override
+        {
+            auto function = [deltaTime](T& component) { component.T::onUpdate(deltaTime); };
+            if (getEvents().parallelUpdate) {
+                forEachActiveInParallel(runner, function);
+            } else {
+                forEachActive(function);
+            }
+        }
+
+        void lateUpdate(TaskRunner& runner, float deltaTime) override
+        {
+            auto function = [deltaTime](T& component) { component.T::onLateUpdate(deltaTime); };
+            if (getEvents().parallelLateUpdate) {
+                forEachActiveInParallel(runner, function);
+            } else {
+                forEachActive(function);
+            }
+        }
+
+        void preDraw() override
+        {
+            forEachActive([](T& component) { component.T::onPreDraw(); });
+        }
+    };
+} // namespace neon
+
+#endif // NEON_COMPONENTDISPATCHER_H
@@ -0,0 +1,112 @@
+#ifndef NEON_BUFFERRING_H
+#define NEON_BUFFERRING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace neon
+{
+    /**
+     * Pool of reusable buffers.
+     * <p>
+     * A buffer is in use while any reference returned by acquire() is alive.
+     * Free buffers are reused by the next acquisitions. Free buffers too small
+     * for an acquisition are replaced by a bigger one.
+     * When all buffers are in use and the ring is full,
+     * a temporary buffer that is not pooled is returned.
+     * <p>
+     * This class is not thread-safe.
+     *
+     * @tparam Buffer the pooled buffer. It must provide "size_t size() const".
+     */
+    template<typename Buffer>
+    class BufferRing
+    {
+      public:
+        /**
+         * Creates a buffer able to hold the given amount of bytes.
+         */
+        using Factory = std::function<std::shared_ptr<Buffer>(size_t size)>;
+
+      private:
+        Factory _factory;
+        uint32_t _maxBuffers;
+        std::vector<std::shared_ptr<Buffer>> _buffers;
+
+      public:
+        BufferRing(const BufferRing& other) = delete;
+
+        /**
+         * Creates the ring. No buffer is created until the first acquisition.
+         *
+         * @param factory the function creating the buffers.
+         * @param maxBuffers the maximum amount of pooled buffers.
+         */
+        BufferRing(Factory factory, uint32_t maxBuffers) :
+            _factory(std::move(factory)),
+            _maxBuffers(maxBuffers)
+        {
+        }
+
+        /**
+         * Returns a buffer able to hold the given amount of bytes.
+         * The buffer is returned to the ring when the returned reference is destroyed.
+         *
+         * @param size the size in bytes.
+         * @return the buffer.
+         */
+        [[nodiscard]] std::shared_ptr<Buffer> acquire(size_t size)
+        {
+            // Only the ring can add references to the pooled buffers:
+            // a buffer with a single reference is not being used.
+            std::shared_ptr<Buffer>* smallFree = nullptr;
+            for (auto& buffer : _buffers) {
+                if (buffer.use_count() != 1) {
+                    continue;
+                }
+                if (buffer->size() >= size) {
+                    return buffer;
+                }
+                if (smallFree == nullptr) {
+                    smallFree = &buffer;
+                }
+            }
+
+            if (smallFree != nullptr) {
+                *smallFree = _factory(size);
+                return *smallFree;
+            }
+
+            if (_buffers.size() < _maxBuffers) {
+                return _buffers.emplace_back(_factory(size));
+            }
+
+            return _factory(size);
+        }
+
+        /**
+         * @return the amount of pooled buffers.
+         */
+        [[nodiscard]] size_t getBufferAmount() const
+        {
+            return _buffers.size();
+        }
+
+        /**
+         * @return the memory pooled by this ring, in bytes.
+         */
+        [[nodiscard]] size_t getAllocatedMemory() const
+        {
+            size_t bytes = 0;
+            for (auto& buffer : _buffers) {
+                bytes += buffer->size();
+            }
+            return bytes;
+        }
+    };
+} // namespace neon
+
+#endif // NEON_BUFFERRING_H
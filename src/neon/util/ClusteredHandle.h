@@ -0,0 +1,155 @@
+#ifndef NEON_CLUSTEREDHANDLE_H
+#define NEON_CLUSTEREDHANDLE_H
+
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#include <neon/util/ClusteredLinkedCollection.h>
+
+namespace neon
+{
+    /**
+     * A weak reference to an element stored inside a ClusteredLinkedCollection.
+     * <p>
+     * The handle is made of the slot index of the element and the
+     * generation the slot had when the handle was created.
+     * Once the element is erased, the generation of the slot changes
+     * and the handle becomes invalid, even if the slot is reused.
+     * <p>
+     * Copying, validating and dereferencing a handle never allocates memory,
+     * uses RTTI or performs atomic operations.
+     * Elements never move inside the collection, so the handle caches
+     * the element's address and only asks the collection whether it is still alive.
+     * <p>
+     * The collection must outlive all its handles.
+     *
+     * @tparam T the type of the element, or a base class of it.
+     */
+    template<class T>
+    class ClusteredHandle
+    {
+        template<class O>
+        friend class ClusteredHandle;
+
+        const AbstractClusteredLinkedCollection* _collection;
+        T* _pointer;
+        uint32_t _slot;
+        uint32_t _generation;
+
+      public:
+        /**
+         * Creates an invalid handle.
+         */
+        ClusteredHandle() :
+            _collection(nullptr),
+            _pointer(nullptr),
+            _slot(0),
+            _generation(0)
+        {
+        }
+
+        /**
+         * Creates a handle pointing to the given element.
+         * <p>
+         * If the element is not inside the given collection, the handle will be invalid.
+         *
+         * @tparam U the type of the elements of the collection.
+         * @param collection the collection holding the element.
+         * @param element the element.
+         */
+        template<class U, size_t Size>
+            requires std::is_base_of_v<T, U> || std::is_same_v<T, U>
+        ClusteredHandle(const ClusteredLinkedCollection<U, Size>& collection, U* element) :
+            ClusteredHandle()
+        {
+            if (element == nullptr) {
+                return;
+            }
+            if (auto slot = collection.findSlot(element)) {
+                _collection = &collection;
+                _pointer = element;
+                _slot = slot->first;
+                _generation = slot->second;
+            }
+        }
+
+        /**
+         * Creates a handle pointing to the same element as the given handle.
+         * The conversion is resolved at compile time using static_cast.
+         */
+        template<class O>
+            requires std::is_base_of_v<T, O> && (!std::is_same_v<T, O>)
+        ClusteredHandle(const ClusteredHandle<O>& other) :
+            _collection(other._collection),
+            _pointer(static_cast<T*>(other._pointer)),
+            _slot(other._slot),
+            _generation(other._generation)
+        {
+        }
+
+        /**
+         * @return whether the element is still alive.
+         */
+        [[nodiscard]] bool isValid() const
+        {
+            return _collection != nullptr && _collection->isAlive(_slot, _generation);
+        }
+
+        /**
+         * @return the element or nullptr if the element is not alive.
+         */
+        [[nodiscard]] T* get() const
+        {
+            return isValid() ? _pointer : nullptr;
+        }
+
+        T* operator->() const
+        {
+            return get();
+        }
+
+        operator bool() const
+        {
+            return isValid();
+        }
+
+        [[nodiscard]] uint32_t getSlot() const
+        {
+            return _slot;
+        }
+
+        [[nodiscard]] uint32_t getGeneration() const
+        {
+            return _generation;
+        }
+
+        [[nodiscard]] const AbstractClusteredLinkedCollection* getCollection() const
+        {
+            return _collection;
+        }
+
+        bool operator==(const ClusteredHandle& other) const
+        {
+            return _collection == other._collection && _slot == other._slot && _generation == other._generation;
+        }
+
+        bool operator!=(const ClusteredHandle& other) const
+        {
+            return !(*this == other);
+        }
+    };
+} // namespace neon
+
+template<class T>
+struct std::hash<neon::ClusteredHandle<T>>
+{
+    std::size_t operator()(const neon::ClusteredHandle<T>& s) const noexcept
+    {
+        auto hash = std::hash<const void*>{}(s.getCollection());
+        return hash ^ (std::hash<uint64_t>{}(static_cast<uint64_t>(s.getSlot()) << 32 | s.getGeneration()) + 0x9e3779b9 +
+                       (hash << 6) + (hash >> 2));
+    }
+};
+
+#endif // NEON_CLUSTEREDHANDLE_H
@@ -5,8 +5,14 @@
 #ifndef RVTRACKING_CLUSTEREDLINKEDCOLLECTION_H
 #define RVTRACKING_CLUSTEREDLINKEDCOLLECTION_H
 
-#include <bitset>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
 
 namespace neon
 {
@@ -14,6 +20,20 @@ namespace neon
 
     class AbstractClusteredLinkedCollection
     {
+        size_t _clusterSize;
+
+      protected:
+        /**
+         * The generation of each slot, one array per cluster.
+         * A slot's generation is increased each time its element is erased.
+         */
+        std::vector<const uint32_t*> _generations;
+
+        explicit AbstractClusteredLinkedCollection(size_t clusterSize) :
+            _clusterSize(clusterSize)
+        {
+        }
+
       public:
         virtual ~AbstractClusteredLinkedCollection() = default;
 
@@ -25,51 +45,98 @@ namespace neon
 
         virtual void forEachRaw(std::function<void(void*)> function) = 0;
 
+        /**
+         * @return the amount of clusters this collection is split into.
+         */
+        [[nodiscard]] virtual size_t getClusterAmount() const = 0;
+
+        /**
+         * Calls the given function for each element inside the given cluster.
+         * <p>
+         * Different clusters never share elements, so they can be
+         * iterated concurrently as long as the collection is not modified.
+         *
+         * @param cluster the index of the cluster, in the range [0, getClusterAmount()).
+         * @param function the function to invoke.
+         */
+        virtual void forEachRawInCluster(size_t cluster, std::function<void(void*)> function) = 0;
+
         virtual bool erase(const void* value) = 0;
+
+        /**
+         * Finds the slot of the given element.
+         *
+         * @param value the element.
+         * @return the slot index and its current generation,
+         * or an empty optional if the element is not inside this collection.
+         */
+        [[nodiscard]] virtual std::optional<std::pair<uint32_t, uint32_t>> findSlot(const void* value) const = 0;
+
+        /**
+         * Returns whether the element that occupied the given slot
+         * when it had the given generation is still alive.
+         * <p>
+         * This method is not virtual: it only reads the generation table.
+         */
+        [[nodiscard]] bool isAlive(uint32_t slot, uint32_t generation) const
+        {
+            size_t cluster = slot / _clusterSize;
+            return cluster < _generations.size() && _generations[cluster][slot % _clusterSize] == generation;
+        }
     };
 
     template<class CollectionPtr>
     class ClusteredLinkedCollectorIterator
     {
-        CollectionPtr _collection;
+        using Collection = std::remove_const_t<std::remove_pointer_t<CollectionPtr>>;
+        using ClusterPtr = std::conditional_t<std::is_const_v<std::remove_pointer_t<CollectionPtr>>,
+                                              const typename Collection::Cluster*, typename Collection::Cluster*>;
+
+        ClusterPtr _cluster;
         size_t _index;
 
+        void seek()
+        {
+            while (_cluster != nullptr) {
+                _index = _cluster->nextOccupied(_index);
+                if (_index < Collection::CLUSTER_SIZE) {
+                    return;
+                }
+                _index = 0;
+                _cluster = _cluster->next;
+            }
+        }
+
       public:
         using iterator_category = std::forward_iterator_tag;
         using difference_type = std::ptrdiff_t;
         using value_type = typename std::remove_pointer_t<CollectionPtr>::ValueType;
 
-        ClusteredLinkedCollectorIterator(CollectionPtr collection, size_t index) :
-            _collection(collection),
+        ClusteredLinkedCollectorIterator(ClusterPtr cluster, size_t index) :
+            _cluster(cluster),
             _index(index)
         {
-            while (_collection != nullptr && !_collection->_occupied[_index]) {
-                ++_index;
-                if (_index >= _collection->capacity()) {
-                    _index = 0;
-                    _collection = _collection->_next;
-                }
-            }
+            seek();
         }
 
         value_type& operator*() const
         {
-            return _collection->rawPointer(_index)[0];
+            return _cluster->data[_index];
         }
 
         value_type* operator->() const
         {
-            return _collection->rawPointer(_index);
+            return _cluster->data + _index;
         }
 
         value_type* raw() const
         {
-            return _collection->rawPointer(_index);
+            return _cluster->data + _index;
         }
 
-        CollectionPtr getCollection() const
+        ClusterPtr getCluster() const
         {
-            return _collection;
+            return _cluster;
         }
 
         size_t getIndex() const
@@ -79,20 +146,14 @@ namespace neon
 
         operator ClusteredLinkedCollectorIterator<const std::remove_pointer_t<CollectionPtr>*>()
         {
-            return ClusteredLinkedCollectorIterator<const std::remove_pointer_t<CollectionPtr>*>(_collection, _index);
+            return ClusteredLinkedCollectorIterator<const std::remove_pointer_t<CollectionPtr>*>(_cluster, _index);
         }
 
         // Prefix increment
         ClusteredLinkedCollectorIterator<CollectionPtr>& operator++()
         {
-            do {
-                ++_index;
-                if (_index >= _collection->capacity()) {
-                    _index = 0;
-                    _collection = _collection->_next;
-                }
-            } while (_collection != nullptr && !_collection->_occupied[_index]);
-
+            ++_index;
+            seek();
             return *this;
         }
 
@@ -106,12 +167,12 @@ namespace neon
 
         bool operator==(const ClusteredLinkedCollectorIterator<CollectionPtr>& b) const
         {
-            return _collection == b._collection && _index == b._index;
+            return _cluster == b._cluster && _index == b._index;
         };
 
         bool operator!=(const ClusteredLinkedCollectorIterator<CollectionPtr>& b) const
         {
-            return _collection != b._collection || _index != b._index;
+            return _cluster != b._cluster || _index != b._index;
         };
     };
 
@@ -129,6 +190,13 @@ namespace neon
     * <p>
     * Spatial Locality: the collection strives to store elements in contiguous memory blocks,
     * optimizing cache usage and improving performance by leveraging spatial locality.
+    * <p>
+    * Clusters with free slots are tracked in a separate list, so insertions
+    * never walk the whole chain. Erasing by pointer performs a binary search
+    * over the clusters sorted by address.
+    * <p>
+    * Each slot has a generation that is increased when its element is erased.
+    * ClusteredHandle uses it to detect dead elements.
     */
     template<class T, size_t Size = DEFAULT_CLUSTER_SIZE>
     class ClusteredLinkedCollection : public AbstractClusteredLinkedCollection
@@ -141,25 +209,201 @@ namespace neon
         using Iterator = ClusteredLinkedCollectorIterator<ClusteredLinkedCollection<T, Size>*>;
         using ConstIterator = ClusteredLinkedCollectorIterator<const ClusteredLinkedCollection<T, Size>*>;
 
+        static constexpr size_t CLUSTER_SIZE = Size;
+
       private:
-        size_t _objectSize;
+        static constexpr size_t WORD_BITS = 64;
+        static constexpr size_t WORDS = (Size + WORD_BITS - 1) / WORD_BITS;
+        static constexpr size_t NOT_FREE = SIZE_MAX;
+
+        static constexpr uint64_t validBits(size_t word)
+        {
+            size_t remaining = Size - word * WORD_BITS;
+            return remaining >= WORD_BITS ? ~uint64_t(0) : (uint64_t(1) << remaining) - 1;
+        }
+
+        struct Cluster
+        {
+            T* data;
+            std::array<uint64_t, WORDS> occupied;
+            std::array<uint32_t, Size> generations;
+            size_t size;
+            size_t index;
+            size_t freeIndex;
+            Cluster* next;
+
+            explicit Cluster(size_t index) :
+                data(std::allocator<T>().allocate(Size)),
+                occupied(),
+                generations(),
+                size(0),
+                index(index),
+                freeIndex(NOT_FREE),
+                next(nullptr)
+            {
+            }
 
-        T* _data;
-        std::bitset<Size> _occupied;
-        size_t _localSize;
+            ~Cluster()
+            {
+                clear();
+                std::allocator<T>().deallocate(data, Size);
+            }
 
-        ClusteredLinkedCollection* _next;
+            Cluster(const Cluster& other) = delete;
 
-        void expand()
+            /**
+             * @returns the first occupied slot at or after the given index, or Size if there is none.
+             */
+            [[nodiscard]] size_t nextOccupied(size_t from) const
+            {
+                size_t word = from / WORD_BITS;
+                if (word >= WORDS) {
+                    return Size;
+                }
+
+                uint64_t bits = occupied[word] & (~uint64_t(0) << (from % WORD_BITS));
+                while (bits == 0) {
+                    if (++word >= WORDS) {
+                        return Size;
+                    }
+                    bits = occupied[word];
+                }
+
+                return word * WORD_BITS + std::countr_zero(bits);
+            }
+
+            /**
+             * @returns the first free slot. The cluster must not be full.
+             */
+            [[nodiscard]] size_t firstFree() const
+            {
+                for (size_t word = 0; word < WORDS; ++word) {
+                    uint64_t bits = ~occupied[word] & validBits(word);
+                    if (bits != 0) {
+                        return word * WORD_BITS + std::countr_zero(bits);
+                    }
+                }
+                return Size;
+            }
+
+            [[nodiscard]] bool isOccupied(size_t index) const
+            {
+                return (occupied[index / WORD_BITS] >> (index % WORD_BITS)) & 1;
+            }
+
+            void flip(size_t index)
+            {
+                occupied[index / WORD_BITS] ^= uint64_t(1) << (index % WORD_BITS);
+            }
+
+            void clear()
+            {
+                for (size_t i = nextOccupied(0); i < Size; i = nextOccupied(i + 1)) {
+                    ++generations[i];
+                    std::destroy_at(data + i);
+                }
+                occupied.fill(0);
+                size = 0;
+            }
+        };
+
+        std::vector<Cluster*> _clusters;
+        std::vector<Cluster*> _freeClusters;
+        std::vector<Cluster*> _clustersByAddress;
+        size_t _size;
+
+        void addCluster()
         {
-            if (_next == nullptr) {
-                _next = new ClusteredLinkedCollection();
+            auto* cluster = new Cluster(_clusters.size());
+            if (!_clusters.empty()) {
+                _clusters.back()->next = cluster;
             }
+            _clusters.push_back(cluster);
+            _generations.push_back(cluster->generations.data());
+            markFree(cluster);
+
+            auto it = std::upper_bound(_clustersByAddress.begin(), _clustersByAddress.end(), cluster,
+                                       [](const Cluster* a, const Cluster* b) { return std::less()(a->data, b->data); });
+            _clustersByAddress.insert(it, cluster);
+        }
+
+        void markFree(Cluster* cluster)
+        {
+            cluster->freeIndex = _freeClusters.size();
+            _freeClusters.push_back(cluster);
+        }
+
+        void unmarkFree(Cluster* cluster)
+        {
+            Cluster* last = _freeClusters.back();
+            _freeClusters[cluster->freeIndex] = last;
+            last->freeIndex = cluster->freeIndex;
+            _freeClusters.pop_back();
+            cluster->freeIndex = NOT_FREE;
         }
 
-        T* rawPointer(size_t index) const
+        Cluster* findCluster(const T* value) const
         {
-            return static_cast<T*>(_data + index);
+            auto it = std::upper_bound(_clustersByAddress.begin(), _clustersByAddress.end(), value,
+                                       [](const T* v, const Cluster* c) { return std::less()(v, c->data); });
+            if (it == _clustersByAddress.begin()) {
+                return nullptr;
+            }
+            Cluster* cluster = *(it - 1);
+            return std::less()(value, cluster->data + Size) ? cluster : nullptr;
+        }
+
+        T* reserveSlot()
+        {
+            if (_freeClusters.empty()) {
+                addCluster();
+            }
+
+            Cluster* cluster = _freeClusters.back();
+            size_t index = cluster->firstFree();
+            cluster->flip(index);
+            ++cluster->size;
+            ++_size;
+            if (cluster->size == Size) {
+                unmarkFree(cluster);
+            }
+            return cluster->data + index;
+        }
+
+        void releaseSlot(Cluster* cluster, size_t index)
+        {
+            cluster->flip(index);
+            ++cluster->generations[index];
+            if (cluster->size == Size) {
+                markFree(cluster);
+            }
+            --cluster->size;
+            --_size;
+        }
+
+        void destroyClusters()
+        {
+            for (Cluster* cluster : _clusters) {
+                delete cluster;
+            }
+            _clusters.clear();
+            _freeClusters.clear();
+            _clustersByAddress.clear();
+            _generations.clear();
+            _size = 0;
+        }
+
+        template<class... Args>
+        T* construct(Args&&... values)
+        {
+            T* ptr = reserveSlot();
+            try {
+                return std::construct_at<T>(ptr, std::forward<Args>(values)...);
+            } catch (...) {
+                Cluster* cluster = findCluster(ptr);
+                releaseSlot(cluster, ptr - cluster->data);
+                throw;
+            }
         }
 
       public:
@@ -167,37 +411,25 @@ namespace neon
         * Creates a new empty ClusteredLinkedCollection.
         */
         ClusteredLinkedCollection() :
-            _objectSize(sizeof(T)),
-            _data(static_cast<T*>(malloc(sizeof(T) * Size))),
-            _occupied(),
-            _localSize(0),
-            _next(nullptr)
+            AbstractClusteredLinkedCollection(Size),
+            _size(0)
         {
+            addCluster();
         }
 
         ~ClusteredLinkedCollection() override
         {
-            for (size_t i = 0; i < Size; ++i) {
-                if (_occupied[i]) {
-                    T* element = _data + i;
-                    std::destroy_at(element);
-                }
-            }
-
-            free(_data);
-            delete _next;
+            destroyClusters();
         }
 
         /**
         * Creates a copy of the given collection.
         */
         ClusteredLinkedCollection(const ClusteredLinkedCollection& other) :
-            _objectSize(other._objectSize),
-            _data(static_cast<T*>(malloc(other._objectSize * Size))),
-            _occupied(),
-            _localSize(0),
-            _next(nullptr)
+            AbstractClusteredLinkedCollection(Size),
+            _size(0)
         {
+            addCluster();
             for (auto& t : other) {
                 push(t);
             }
@@ -222,16 +454,19 @@ namespace neon
         * Moves the given collection.
         */
         ClusteredLinkedCollection(ClusteredLinkedCollection&& other) noexcept :
-            _objectSize(other._objectSize),
-            _data(other._data),
-            _occupied(other._occupied),
-            _localSize(other._localSize),
-            _next(other._next)
+            AbstractClusteredLinkedCollection(Size),
+            _clusters(std::move(other._clusters)),
+            _freeClusters(std::move(other._freeClusters)),
+            _clustersByAddress(std::move(other._clustersByAddress)),
+            _size(other._size)
         {
-            other._occupied.reset();
-            other._data = static_cast<T*>(malloc(other._objectSize * Size));
-            other._localSize = 0;
-            other._next = nullptr;
+            _generations = std::move(other._generations);
+            other._clusters.clear();
+            other._freeClusters.clear();
+            other._clustersByAddress.clear();
+            other._generations.clear();
+            other._size = 0;
+            other.addCluster();
         }
 
         /**
@@ -243,16 +478,19 @@ namespace neon
                 return *this;
             }
 
-            _objectSize = other._objectSize;
-            _data = other._data;
-            _occupied = other._occupied;
-            _localSize = other._localSize;
-            _next = other._next;
+            destroyClusters();
+            _clusters = std::move(other._clusters);
+            _freeClusters = std::move(other._freeClusters);
+            _clustersByAddress = std::move(other._clustersByAddress);
+            _generations = std::move(other._generations);
+            _size = other._size;
 
-            other._occupied.reset();
-            other._data = static_cast<T*>(malloc(other._objectSize * Size));
-            other._localSize = 0;
-            other._next = nullptr;
+            other._clusters.clear();
+            other._freeClusters.clear();
+            other._clustersByAddress.clear();
+            other._generations.clear();
+            other._size = 0;
+            other.addCluster();
 
             return *this;
         }
@@ -262,7 +500,7 @@ namespace neon
         */
         [[nodiscard]] size_t size() const override
         {
-            return _localSize + (_next == nullptr ? 0 : _next->size());
+            return _size;
         }
 
         /**
@@ -270,11 +508,11 @@ namespace neon
         */
         [[nodiscard]] bool empty() const override
         {
-            return _localSize == 0 && (_next == nullptr || _next->empty());
+            return _size == 0;
         }
 
         /**
-        * @params returns the amount of elements this local cluster can hold without expanding.
+        * @params returns the amount of elements a single cluster can hold.
         */
         [[nodiscard]] size_t capacity() const override
         {
@@ -295,6 +533,41 @@ namespace neon
             }
         }
 
+        /**
+        * @returns the amount of clusters of this collection.
+        */
+        [[nodiscard]] size_t getClusterAmount() const override
+        {
+            return _clusters.size();
+        }
+
+        /**
+        * Calls the given function for each element inside the given cluster.
+        */
+        void forEachRawInCluster(size_t cluster, std::function<void(void*)> function) override
+        {
+            forEachInCluster(cluster, [&function](T& element) { function(&element); });
+        }
+
+        /**
+        * Calls the given function for each element inside the given cluster.
+        * <p>
+        * Unlike forEachRawInCluster(), the function is not type-erased,
+        * allowing the compiler to inline it.
+        */
+        template<class Func>
+        void forEachInCluster(size_t cluster, Func&& function)
+        {
+            if (cluster >= _clusters.size()) {
+                return;
+            }
+
+            Cluster* current = _clusters[cluster];
+            for (size_t i = current->nextOccupied(0); i < Size; i = current->nextOccupied(i + 1)) {
+                function(current->data[i]);
+            }
+        }
+
         /**
         * Calls the given function for each element inside this collection.
         */
@@ -329,20 +602,7 @@ namespace neon
         */
         T* push(const T& t)
         {
-            if (_localSize == Size) {
-                expand();
-                return _next->push(t);
-            }
-
-            size_t index = 0;
-            while (_occupied[index]) {
-                ++index;
-            }
-            _occupied.flip(index);
-            ++_localSize;
-
-            auto* ptr = _data + index;
-            return std::construct_at<T>(ptr, t);
+            return construct(t);
         }
 
         /**
@@ -351,20 +611,7 @@ namespace neon
         */
         T* push(T&& t)
         {
-            if (_localSize == Size) {
-                expand();
-                return _next->push(std::move(t));
-            }
-
-            size_t index = 0;
-            while (_occupied[index]) {
-                ++index;
-            }
-            _occupied.flip(index);
-            ++_localSize;
-
-            auto* ptr = _data + index;
-            return std::construct_at<T>(ptr, std::move(t));
+            return construct(std::move(t));
         }
 
         /**
@@ -374,20 +621,7 @@ namespace neon
         template<class... Args>
         T* emplace(Args&&... values)
         {
-            if (_localSize == Size) {
-                expand();
-                return _next->emplace(std::forward<Args>(values)...);
-            }
-
-            size_t index = 0;
-            while (_occupied[index]) {
-                ++index;
-            }
-            _occupied.flip(index);
-            ++_localSize;
-
-            auto* ptr = _data + index;
-            return std::construct_at<T>(ptr, std::forward<Args>(values)...);
+            return construct(std::forward<Args>(values)...);
         }
 
         /**
@@ -396,23 +630,10 @@ namespace neon
         */
         bool erase(ConstIterator it)
         {
-            if (it.getCollection() == this) {
-                size_t position = it.getIndex();
-                if (!_occupied[position]) {
-                    return false;
-                }
-                auto* ptr = _data + position;
-                _occupied.flip(position);
-                --_localSize;
-                std::destroy_at(ptr);
-                return true;
-            }
-
-            if (_next != nullptr) {
-                return _next->erase(it);
+            if (it.getCluster() == nullptr) {
+                return false;
             }
-
-            return false;
+            return erase(static_cast<const void*>(it.raw()));
         }
 
         /**
@@ -421,51 +642,62 @@ namespace neon
         */
         bool erase(const void* value) override
         {
-            int64_t position = static_cast<const T*>(value) - _data;
-            if (position < 0 || position >= Size) {
-                if (_next != nullptr) {
-                    return _next->erase(value);
-                }
+            auto* element = static_cast<const T*>(value);
+            Cluster* cluster = findCluster(element);
+            if (cluster == nullptr) {
                 return false;
             }
 
-            if (!_occupied[position]) {
+            size_t position = element - cluster->data;
+            if (!cluster->isOccupied(position)) {
                 return false;
             }
 
-            _occupied.flip(position);
-            std::destroy_at(_data + position);
-
-            --_localSize;
+            // The slot is released after the destruction: the destructor may insert elements.
+            std::destroy_at(cluster->data + position);
+            releaseSlot(cluster, position);
             return true;
         }
 
+        [[nodiscard]] std::optional<std::pair<uint32_t, uint32_t>> findSlot(const void* value) const override
+        {
+            auto* element = static_cast<const T*>(value);
+            Cluster* cluster = findCluster(element);
+            if (cluster == nullptr) {
+                return {};
+            }
+
+            size_t position = element - cluster->data;
+            if (!cluster->isOccupied(position)) {
+                return {};
+            }
+
+            return std::make_pair(static_cast<uint32_t>(cluster->index * Size + position),
+                                  cluster->generations[position]);
+        }
+
         /**
         * Clears all the contents of this collection.
+        * The clusters are kept, so they can be reused by new elements.
         */
         void clear()
         {
-            for (size_t i = 0; i < Size; ++i) {
-                if (_occupied[i]) {
-                    std::destroy_at(_data + i);
-                }
+            _freeClusters.clear();
+            for (Cluster* cluster : _clusters) {
+                cluster->clear();
+                markFree(cluster);
             }
-
-            _occupied.reset();
-            _localSize = 0;
-
-            delete _next;
-            _next = nullptr;
+            _size = 0;
         }
 
         Iterator begin()
         {
-            return Iterator(this, 0);
+            return Iterator(_clusters.front(), 0);
         }
 
         ConstIterator begin() const
         {
-            return ConstIterator(this, 0);
+            return ConstIterator(_clusters.front(), 0);
         }
 
         Iterator end()
@@ -0,0 +1,201 @@
+#ifndef NEON_DIRTYRANGES_H
+#define NEON_DIRTYRANGES_H
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+#include <neon/util/Range.h>
+
+namespace neon
+{
+    /**
+     * Set of modified indices, stored as a bitmap.
+     * <p>
+     * Marking an index is a constant-time operation.
+     * The modified indices can be retrieved as runs: ranges of
+     * consecutive modified indices. Runs separated by small gaps
+     * can be merged, reducing the amount of uploads at the cost
+     * of uploading some unmodified indices.
+     */
+    class DirtyRanges
+    {
+        static constexpr uint32_t BITS = 64;
+
+        std::vector<uint64_t> _words;
+        uint32_t _capacity;
+
+        // Bounds of the marked indices. Used to reduce the amount of scanned words.
+        uint32_t _first;
+        uint32_t _last;
+
+        [[nodiscard]] uint32_t findNext(uint32_t from, bool value) const
+        {
+            uint32_t word = from / BITS;
+            uint64_t bits = value ? _words[word] : ~_words[word];
+            bits &= ~uint64_t(0) << (from % BITS);
+
+            uint32_t lastWord = (_last - 1) / BITS;
+            while (bits == 0) {
+                if (++word > lastWord) {
+                    return _last;
+                }
+                bits = value ? _words[word] : ~_words[word];
+            }
+
+            uint32_t index = word * BITS + static_cast<uint32_t>(std::countr_zero(bits));
+            return index < _last ? index : _last;
+        }
+
+      public:
+        DirtyRanges() :
+            DirtyRanges(0)
+        {
+        }
+
+        /**
+         * Creates an empty set.
+         * @param capacity the amount of indices the set can hold.
+         */
+        explicit DirtyRanges(uint32_t capacity) :
+            _words((capacity + BITS - 1) / BITS, 0),
+            _capacity(capacity),
+            _first(capacity),
+            _last(0)
+        {
+        }
+
+        [[nodiscard]] uint32_t capacity() const
+        {
+            return _capacity;
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            return _first >= _last;
+        }
+
+        /**
+         * @return the smallest range containing all marked indices.
+         */
+        [[nodiscard]] Range<uint32_t> getBounds() const
+        {
+            return empty() ? Range<uint32_t>(0, 0) : Range<uint32_t>(_first, _last);
+        }
+
+        /**
+         * @return whether the given index is marked as modified.
+         */
+        [[nodiscard]] bool isMarked(uint32_t index) const
+        {
+            if (index < _first || index >= _last) {
+                return false;
+            }
+            return (_words[index / BITS] >> (index % BITS)) & 1;
+        }
+
+        /**
+         * Marks the given index as modified.
+         * Indices outside the capacity of the set are ignored.
+         */
+        void mark(uint32_t index)
+        {
+            if (index >= _capacity) {
+                return;
+            }
+            _words[index / BITS] |= uint64_t(1) << (index % BITS);
+            _first = std::min(_first, index);
+            _last = std::max(_last, index + 1);
+        }
+
+        /**
+         * Marks all the indices inside the given range as modified.
+         */
+        void mark(Range<uint32_t> range)
+        {
+            uint32_t from = range.getFrom();
+            uint32_t to = std::min(range.getTo(), _capacity);
+            if (from >= to) {
+                return;
+            }
+
+            for (uint32_t index = from; index < to;) {
+                uint32_t bit = index % BITS;
+                uint32_t amount = std::min(BITS - bit, to - index);
+                uint64_t mask = amount == BITS ? ~uint64_t(0) : ((uint64_t(1) << amount) - 1) << bit;
+                _words[index / BITS] |= mask;
+                index += amount;
+            }
+
+            _first = std::min(_first, from);
+            _last = std::max(_last, to);
+        }
+
+        /**
+         * Unmarks all indices.
+         * Only the words inside the bounds of the marked indices are cleared.
+         */
+        void clear()
+        {
+            if (empty()) {
+                return;
+            }
+            for (uint32_t word = _first / BITS; word <= (_last - 1) / BITS; ++word) {
+                _words[word] = 0;
+            }
+            _first = _capacity;
+            _last = 0;
+        }
+
+        /**
+         * Invokes the given function for each run of marked indices.
+         * Runs are given in ascending order.
+         *
+         * @param mergeThreshold runs separated by this amount of unmarked indices
+         * or less are merged into a single run.
+         * @param function the function. It receives a Range<uint32_t>.
+         */
+        template<typename Func>
+        void forEachRun(uint32_t mergeThreshold, Func&& function) const
+        {
+            if (empty()) {
+                return;
+            }
+
+            uint32_t runStart = _first;
+            uint32_t runEnd = findNext(_first, false);
+
+            while (runEnd < _last) {
+                uint32_t next = findNext(runEnd, true);
+                if (next >= _last) {
+                    break;
+                }
+                uint32_t nextEnd = findNext(next, false);
+                if (next - runEnd > mergeThreshold) {
+                    function(Range<uint32_t>(runStart, runEnd));
+                    runStart = next;
+                }
+                runEnd = nextEnd;
+            }
+
+            function(Range<uint32_t>(runStart, runEnd));
+        }
+
+        /**
+         * Writes the runs of marked indices into the given vector.
+         * The previous content of the vector is discarded.
+         *
+         * @param mergeThreshold runs separated by this amount of unmarked indices
+         * or less are merged into a single run.
+         * @param runs the vector where the runs are written.
+         */
+        void collectRuns(uint32_t mergeThreshold, std::vector<Range<uint32_t>>& runs) const
+        {
+            runs.clear();
+            forEachRun(mergeThreshold, [&runs](Range<uint32_t> run) { runs.push_back(run); });
+        }
+    };
+} // namespace neon
+
+#endif // NEON_DIRTYRANGES_H
@@ -0,0 +1,102 @@
+#ifndef NEON_FRAMEDIRTYRANGES_H
+#define NEON_FRAMEDIRTYRANGES_H
+
+#include <cstdint>
+#include <vector>
+
+#include <neon/util/DirtyRanges.h>
+#include <neon/util/Range.h>
+
+namespace neon
+{
+    /**
+     * Tracks the indices modified in a ring of buffers, one per frame in flight.
+     * <p>
+     * Data is only written into the buffer of the current frame.
+     * When the frame changes, the indices modified since the new frame's buffer
+     * was last used must be copied from the previous frame's buffer.
+     * This class tracks these indices for every buffer of the ring.
+     */
+    class FrameDirtyRanges
+    {
+        std::vector<DirtyRanges> _frames;
+        std::vector<Range<uint32_t>> _runs;
+        uint32_t _current;
+
+      public:
+        FrameDirtyRanges() :
+            FrameDirtyRanges(0, 0)
+        {
+        }
+
+        /**
+         * Creates the tracker.
+         *
+         * @param frames the amount of buffers of the ring.
+         * @param capacity the amount of indices of each buffer.
+         * @param current the frame whose buffer is being written.
+         */
+        FrameDirtyRanges(uint32_t frames, uint32_t capacity, uint32_t current = 0) :
+            _frames(frames, DirtyRanges(capacity)),
+            _current(current)
+        {
+        }
+
+        [[nodiscard]] uint32_t getCurrentFrame() const
+        {
+            return _current;
+        }
+
+        /**
+         * @return the indices the buffer of the given frame lacks.
+         */
+        [[nodiscard]] const DirtyRanges& getStale(uint32_t frame) const
+        {
+            return _frames[frame];
+        }
+
+        /**
+         * Marks the given indices as modified in the current frame's buffer.
+         * The buffers of the other frames become stale.
+         */
+        void mark(Range<uint32_t> range)
+        {
+            for (uint32_t frame = 0; frame < _frames.size(); ++frame) {
+                if (frame != _current) {
+                    _frames[frame].mark(range);
+                }
+            }
+        }
+
+        /**
+         * Changes the current frame.
+         * <p>
+         * The given function is invoked for each run of indices the new frame's buffer lacks.
+         * It must copy the run from the previous frame's buffer,
+         * which holds the latest version of every index.
+         *
+         * @param frame the new frame. Nothing is done if it is the current frame.
+         * @param mergeThreshold runs separated by this amount of unmarked indices
+         * or less are merged into a single run.
+         * @param copy the function. It receives a Range<uint32_t>.
+         */
+        template<typename Func>
+        void advance(uint32_t frame, uint32_t mergeThreshold, Func&& copy)
+        {
+            if (frame == _current) {
+                return;
+            }
+
+            auto& stale = _frames[frame];
+            stale.collectRuns(mergeThreshold, _runs);
+            for (auto run : _runs) {
+                copy(run);
+            }
+            stale.clear();
+
+            _current = frame;
+        }
+    };
+} // namespace neon
+
+#endif // NEON_FRAMEDIRTYRANGES_H
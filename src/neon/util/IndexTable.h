@@ -0,0 +1,135 @@
+#ifndef NEON_INDEXTABLE_H
+#define NEON_INDEXTABLE_H
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace neon
+{
+    /**
+     * Maps stable handles to the indices of a dense array.
+     * <p>
+     * Elements are stored contiguously in an external array.
+     * When an element is removed, the last element is moved into its place
+     * and the table updates the index of the moved element's handle.
+     * Handles remain valid until their element is removed.
+     * <p>
+     * Handles are recycled through a free list. Each handle has
+     * a generation that changes when the handle is freed,
+     * invalidating old copies of the handle.
+     * Creating and removing elements is O(1) and doesn't allocate memory
+     * once the table has grown to its working size.
+     */
+    class IndexTable
+    {
+      public:
+        static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+        struct Handle
+        {
+            uint32_t id;
+            uint32_t generation;
+
+            bool operator==(const Handle& other) const = default;
+        };
+
+      private:
+        // Indexed by handle id.
+        std::vector<uint32_t> _indices;
+        std::vector<uint32_t> _generations;
+
+        // Indexed by dense index.
+        std::vector<uint32_t> _handles;
+
+        std::vector<uint32_t> _freeHandles;
+
+      public:
+        /**
+         * @return the amount of elements inside the table.
+         */
+        [[nodiscard]] size_t size() const
+        {
+            return _handles.size();
+        }
+
+        /**
+         * Reserves memory for the given amount of elements.
+         */
+        void reserve(size_t amount)
+        {
+            _indices.reserve(amount);
+            _generations.reserve(amount);
+            _handles.reserve(amount);
+        }
+
+        /**
+         * Adds an element at the end of the dense array.
+         * @return the handle of the element.
+         */
+        Handle create()
+        {
+            uint32_t id;
+            if (_freeHandles.empty()) {
+                id = static_cast<uint32_t>(_indices.size());
+                _indices.push_back(0);
+                _generations.push_back(0);
+            } else {
+                id = _freeHandles.back();
+                _freeHandles.pop_back();
+            }
+
+            _indices[id] = static_cast<uint32_t>(_handles.size());
+            _handles.push_back(id);
+            return {id, _generations[id]};
+        }
+
+        /**
+         * Returns the dense index of the element of the given handle.
+         * @return the index or INVALID_INDEX if the handle is not valid.
+         */
+        [[nodiscard]] uint32_t getIndex(Handle handle) const
+        {
+            if (handle.id >= _indices.size() || _generations[handle.id] != handle.generation) {
+                return INVALID_INDEX;
+            }
+            return _indices[handle.id];
+        }
+
+        /**
+         * @return whether the given handle points to an element of this table.
+         */
+        [[nodiscard]] bool isValid(Handle handle) const
+        {
+            return getIndex(handle) != INVALID_INDEX;
+        }
+
+        /**
+         * Removes the element of the given handle.
+         * <p>
+         * If the removed element was not the last one, the last element
+         * is moved to the returned index: the caller must move its data,
+         * placed at index size(), to the returned index.
+         *
+         * @return the index of the removed element or INVALID_INDEX if the handle is not valid.
+         */
+        uint32_t remove(Handle handle)
+        {
+            uint32_t index = getIndex(handle);
+            if (index == INVALID_INDEX) {
+                return INVALID_INDEX;
+            }
+
+            uint32_t last = _handles.back();
+            _handles[index] = last;
+            _indices[last] = index;
+            _handles.pop_back();
+
+            ++_generations[handle.id];
+            _freeHandles.push_back(handle.id);
+            return index;
+        }
+    };
+} // namespace neon
+
+#endif // NEON_INDEXTABLE_H
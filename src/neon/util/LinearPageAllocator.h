@@ -0,0 +1,220 @@
+#ifndef NEON_LINEARPAGEALLOCATOR_H
+#define NEON_LINEARPAGEALLOCATOR_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <neon/render/buffer/CommandBufferRun.h>
+
+namespace neon
+{
+    /**
+     * Linear sub-allocator of memory read by command buffers.
+     * <p>
+     * Memory is sub-allocated from pages. When the current page is full,
+     * it is retired and a new page is used. Allocations bigger than a page use a dedicated page.
+     * Retired pages are recycled once all their allocations have been released
+     * and all command buffer runs reading them have finished.
+     * Up to a given amount of recycled pages are kept for future allocations;
+     * the rest, and all dedicated pages, are destroyed.
+     * <p>
+     * This class is not thread-safe.
+     *
+     * @tparam Memory the memory of a page. It must provide "char* data()" and "size_t size() const".
+     */
+    template<typename Memory>
+    class LinearPageAllocator
+    {
+      public:
+        static constexpr uint32_t ALIGNMENT = 16;
+
+        struct Page
+        {
+            std::unique_ptr<Memory> memory;
+            uint32_t used = 0;
+            uint32_t pending = 0;
+            std::vector<std::shared_ptr<CommandBufferRun>> runs;
+        };
+
+        /**
+         * A region of memory.
+         * The memory must be released using release() once
+         * the command reading it has been recorded.
+         */
+        struct Allocation
+        {
+            Page* page = nullptr;
+            char* data = nullptr;
+            uint32_t offset = 0;
+            uint32_t size = 0;
+        };
+
+        /**
+         * Creates the memory of a page of the given size.
+         */
+        using Factory = std::function<std::unique_ptr<Memory>(uint32_t size)>;
+
+      private:
+        static constexpr size_t MAX_TRACKED_RUNS = 32;
+
+        Factory _factory;
+        uint32_t _pageSize;
+        uint32_t _maxFreePages;
+
+        std::vector<std::unique_ptr<Page>> _pages;
+        Page* _current;
+        std::vector<Page*> _retired;
+        std::vector<Page*> _free;
+
+        static uint32_t align(uint32_t value)
+        {
+            return (value + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+        }
+
+        Page* createPage(uint32_t size)
+        {
+            auto page = std::make_unique<Page>();
+            page->memory = _factory(size);
+            return _pages.emplace_back(std::move(page)).get();
+        }
+
+        void recycle()
+        {
+            std::erase_if(_retired, [this](Page* page) {
+                if (page->pending > 0) {
+                    return false;
+                }
+                if (!std::ranges::all_of(page->runs, [](auto& run) { return run->hasFinished(); })) {
+                    return false;
+                }
+
+                page->runs.clear();
+                page->used = 0;
+
+                // Dedicated pages are not reused: they were created for a single big allocation.
+                if (page->memory->size() == _pageSize && _free.size() < _maxFreePages) {
+                    _free.push_back(page);
+                } else {
+                    std::erase_if(_pages, [page](const auto& it) { return it.get() == page; });
+                }
+                return true;
+            });
+        }
+
+        Page* fetchPage(uint32_t size)
+        {
+            if (size <= _pageSize && !_free.empty()) {
+                Page* page = _free.back();
+                _free.pop_back();
+                return page;
+            }
+            return createPage(std::max(size, _pageSize));
+        }
+
+      public:
+        LinearPageAllocator(const LinearPageAllocator& other) = delete;
+
+        /**
+         * Creates the allocator. No memory is allocated until the first allocation.
+         *
+         * @param factory the function creating the memory of the pages.
+         * @param pageSize the size of the pages. Bigger allocations use a dedicated page.
+         * @param maxFreePages the amount of recycled pages kept for future allocations.
+         */
+        LinearPageAllocator(Factory factory, uint32_t pageSize, uint32_t maxFreePages) :
+            _factory(std::move(factory)),
+            _pageSize(pageSize),
+            _maxFreePages(maxFreePages),
+            _current(nullptr)
+        {
+        }
+
+        /**
+         * Allocates a region of memory. Regions are aligned to ALIGNMENT bytes inside their page.
+         *
+         * @param size the size of the region in bytes.
+         * @return the region. Empty if the size is 0.
+         */
+        [[nodiscard]] Allocation allocate(uint32_t size)
+        {
+            if (size == 0) {
+                return {};
+            }
+
+            if (size > _pageSize) {
+                // Big allocations use a dedicated page, keeping the current page.
+                recycle();
+                Page* page = fetchPage(size);
+                page->used = size;
+                page->pending = 1;
+                _retired.push_back(page);
+                return {page, page->memory->data(), 0, size};
+            }
+
+            uint32_t offset = _current == nullptr ? 0 : align(_current->used);
+            if (_current == nullptr || offset + size > _current->memory->size()) {
+                if (_current != nullptr) {
+                    _retired.push_back(_current);
+                }
+                recycle();
+                _current = fetchPage(size);
+                offset = 0;
+            }
+
+            _current->used = offset + size;
+            ++_current->pending;
+            return {_current, _current->memory->data() + offset, offset, size};
+        }
+
+        /**
+         * Releases the given region. The region's memory may be reused
+         * once the given run has finished.
+         *
+         * @param allocation the region.
+         * @param run the run of the command buffer reading the region. It may be null.
+         */
+        void release(const Allocation& allocation, std::shared_ptr<CommandBufferRun> run)
+        {
+            if (allocation.page == nullptr) {
+                return;
+            }
+
+            Page* page = allocation.page;
+            --page->pending;
+
+            if (run == nullptr || (!page->runs.empty() && page->runs.back() == run)) {
+                return;
+            }
+
+            if (page->runs.size() >= MAX_TRACKED_RUNS) {
+                std::erase_if(page->runs, [](auto& it) { return it->hasFinished(); });
+            }
+            page->runs.push_back(std::move(run));
+        }
+
+        /**
+         * @return the amount of pages alive, including the free ones.
+         */
+        [[nodiscard]] size_t getPageAmount() const
+        {
+            return _pages.size();
+        }
+
+        /**
+         * @return the memory allocated by this allocator, in bytes.
+         */
+        [[nodiscard]] size_t getAllocatedMemory() const
+        {
+            size_t bytes = 0;
+            for (auto& page : _pages) {
+                bytes += page->memory->size();
+            }
+            return bytes;
+        }
+    };
+} // namespace neon
+
+#endif // NEON_LINEARPAGEALLOCATOR_H
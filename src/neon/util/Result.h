@@ -105,6 +105,9 @@ namespace neon
 
         ~Result()
         {
+            if (_data == nullptr) {
+                return; // Moved.
+            }
             if (_valid) {
                 std::destroy_at<Ok>(static_cast<Ok*>(_data));
             } else {
@@ -0,0 +1,113 @@
+#ifndef NEON_RINGDEQUE_H
+#define NEON_RINGDEQUE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace neon
+{
+    /**
+     * A double-ended queue backed by a growable ring buffer.
+     * <p>
+     * Unlike std::deque, this collection keeps its storage when
+     * elements are removed. Once the queue has reached its working
+     * size, pushing and popping elements never allocates memory.
+     * <p>
+     * Removed elements are moved out, leaving a moved-from instance
+     * inside the buffer until its slot is reused.
+     *
+     * @tparam T the type of the elements. It must be default-constructible and move-assignable.
+     */
+    template<typename T>
+    class RingDeque
+    {
+        std::vector<T> _buffer;
+        size_t _head;
+        size_t _size;
+
+        size_t physicalIndex(size_t index) const
+        {
+            return (_head + index) % _buffer.size();
+        }
+
+        void grow()
+        {
+            std::vector<T> buffer(std::max<size_t>(_buffer.size() * 2, 16));
+            for (size_t i = 0; i < _size; ++i) {
+                buffer[i] = std::move(_buffer[physicalIndex(i)]);
+            }
+            _buffer = std::move(buffer);
+            _head = 0;
+        }
+
+      public:
+        RingDeque() :
+            _head(0),
+            _size(0)
+        {
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            return _size == 0;
+        }
+
+        [[nodiscard]] size_t size() const
+        {
+            return _size;
+        }
+
+        [[nodiscard]] size_t capacity() const
+        {
+            return _buffer.size();
+        }
+
+        T& front()
+        {
+            return _buffer[_head];
+        }
+
+        T& back()
+        {
+            return _buffer[physicalIndex(_size - 1)];
+        }
+
+        void push_back(T&& value)
+        {
+            if (_size == _buffer.size()) {
+                grow();
+            }
+            _buffer[physicalIndex(_size)] = std::move(value);
+            ++_size;
+        }
+
+        void push_front(T&& value)
+        {
+            if (_size == _buffer.size()) {
+                grow();
+            }
+            _head = (_head + _buffer.size() - 1) % _buffer.size();
+            _buffer[_head] = std::move(value);
+            ++_size;
+        }
+
+        T pop_front()
+        {
+            T value = std::move(_buffer[_head]);
+            _head = (_head + 1) % _buffer.size();
+            --_size;
+            return value;
+        }
+
+        T pop_back()
+        {
+            T value = std::move(back());
+            --_size;
+            return value;
+        }
+    };
+} // namespace neon
+
+#endif // NEON_RINGDEQUE_H
@@ -6,6 +6,8 @@
 
     #include "CefTextureRenderHandler.h"
 
+    #include <algorithm>
+
 namespace neon
 {
 
@@ -25,13 +27,26 @@ namespace neon
     void CefTextureRenderHandler::OnPaint(CefRefPtr<CefBrowser> browser, PaintElementType type,
                                           const RectList& dirtyRects, const void* buffer, int width, int height)
     {
-        const std::byte* data = static_cast<const std::byte*>(buffer);
-
-        if (auto modifiable = _texture->asModifiable()) {
-            rush::Vec3ui size = rush::min(_texture->getDimensions(), rush::Vec3ui(width, height, 1));
+        auto modifiable = _texture->asModifiable();
+        if (!modifiable.has_value()) {
+            return;
+        }
 
-            modifiable.value()->updateData(data, rush::Vec3ui(0), size, 0, 1, nullptr);
+        // Only upload the rectangles CEF has repainted.
+        rush::Vec3ui size = rush::min(_texture->getDimensions(), rush::Vec3ui(width, height, 1));
+        _regions.clear();
+        for (const auto& rect : dirtyRects) {
+            uint32_t fromX = std::min(static_cast<uint32_t>(std::max(rect.x, 0)), size.x());
+            uint32_t fromY = std::min(static_cast<uint32_t>(std::max(rect.y, 0)), size.y());
+            uint32_t toX = std::min(static_cast<uint32_t>(std::max(rect.x + rect.width, 0)), size.x());
+            uint32_t toY = std::min(static_cast<uint32_t>(std::max(rect.y + rect.height, 0)), size.y());
+            if (fromX < toX && fromY < toY) {
+                _regions.push_back({rush::Vec3ui(fromX, fromY, 0), rush::Vec3ui(toX - fromX, toY - fromY, 1)});
+            }
         }
+
+        modifiable.value()->updateRegions(buffer, rush::Vec3ui(width, height, 1), _regions,
+                                          MipmapRegeneration::REGIONS, nullptr);
     }
 
     bool CefTextureRenderHandler::setSize(uint32_t width, uint32_t height)
@@ -17,6 +17,7 @@ namespace neon
     {
         uint32_t _width, _height;
         std::shared_ptr<Texture> _texture;
+        std::vector<TextureUpdateRegion> _regions;
 
     public:
         CefTextureRenderHandler(uint32_t width, uint32_t height, std::shared_ptr<Texture> texture);
@@ -5,9 +5,14 @@
 #ifndef ABSTRACTCOROUTINE_H
 #define ABSTRACTCOROUTINE_H
 
+#include <chrono>
+#include <memory>
+#include <optional>
+
 namespace neon
 {
     class TaskRunner;
+    struct TaskStatus;
 
     /**
      * Base declaration of a coroutine.
@@ -43,6 +48,33 @@ namespace neon
          */
         [[nodiscard]] virtual bool isValid() const = 0;
 
+        /**
+         * Returns the status of the task this coroutine is awaiting.
+         * <p>
+         * Coroutines awaiting a task are not polled by the TaskRunner:
+         * they are resumed once the awaited task finishes or is cancelled.
+         *
+         * @return the status of the awaited task, or nullptr if the coroutine is not awaiting a task.
+         */
+        [[nodiscard]] virtual std::shared_ptr<const TaskStatus> getAwaitedStatus() const
+        {
+            return nullptr;
+        }
+
+        /**
+         * Returns the moment this coroutine will be ready again if it is
+         * waiting for a reason that only depends on time, such as WaitForSeconds.
+         * <p>
+         * The TaskRunner keeps these coroutines in a min-heap and
+         * ignores them until their wake-up time is reached.
+         *
+         * @return the wake-up time, or an empty optional if the coroutine is not waiting for a deadline.
+         */
+        [[nodiscard]] virtual std::optional<std::chrono::steady_clock::time_point> getWakeUpTime() const
+        {
+            return {};
+        }
+
         /**
          * Executes this coroutine until the next breaking point.
          */
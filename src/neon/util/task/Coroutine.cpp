@@ -9,14 +9,19 @@ namespace neon
 
     WaitForSeconds::WaitForSeconds(float seconds)
     {
-        auto now = std::chrono::system_clock::now();
+        auto now = std::chrono::steady_clock::now();
 
         _wakeUpTime = now + std::chrono::microseconds(static_cast<uint64_t>(seconds * 1000000.0f));
     }
 
-    inline bool WaitForSeconds::isReady()
+    bool WaitForSeconds::isReady()
     {
-        return std::chrono::system_clock::now() >= _wakeUpTime;
+        return std::chrono::steady_clock::now() >= _wakeUpTime;
+    }
+
+    std::optional<std::chrono::steady_clock::time_point> WaitForSeconds::getWakeUpTime() const
+    {
+        return _wakeUpTime;
     }
 
     WaitForNextFrame::WaitForNextFrame() = default;
@@ -9,6 +9,7 @@
 #include <exception>
 #include <functional>
 #include <memory>
+#include <optional>
 
 #include <neon/util/task/AbstractCoroutine.h>
 #include <neon/util/task/TaskRunner.h>
@@ -32,6 +33,21 @@ namespace neon
          * @return whether the coroutine is ready to be launched again.
          */
         virtual bool isReady() = 0;
+
+        /**
+         * Returns the moment this wait finishes if it only depends on time.
+         * <p>
+         * Reasons returning a wake-up time are not polled by the TaskRunner:
+         * the coroutine is ignored until the deadline is reached.
+         * Reasons that depend on other conditions must return an empty optional,
+         * and they will be checked once per flushMainThreadTasks() call.
+         *
+         * @return the wake-up time, or an empty optional.
+         */
+        [[nodiscard]] virtual std::optional<std::chrono::steady_clock::time_point> getWakeUpTime() const
+        {
+            return {};
+        }
     };
 
     /**
@@ -45,6 +61,10 @@ namespace neon
      * Use co_yield with a class that extends CoroutineWaitReason to
      * make your coroutine wait for a specific condition.
      * <p>
+     * Use co_await with a std::shared_ptr<Task<T>> to suspend the coroutine
+     * until the task finishes or is cancelled. Awaiting coroutines are not polled:
+     * they are resumed when the task is resolved.
+     * <p>
      * You may use the TaskRunner instance inside Application
      * to launch this coroutine.
      *
@@ -59,6 +79,7 @@ namespace neon
         struct promise_type // required
         {
             std::unique_ptr<CoroutineWaitReason> _currentWaitReason;
+            std::shared_ptr<const TaskStatus> _awaitedStatus;
             std::exception_ptr _exception;
 
             std::shared_ptr<Task<Return>> _task;
@@ -138,7 +159,11 @@ namespace neon
             if (isDone()) {
                 return false;
             }
-            auto& reason = _handler.promise()._currentWaitReason;
+            auto& promise = _handler.promise();
+            if (promise._awaitedStatus != nullptr) {
+                return promise._awaitedStatus->finished || promise._awaitedStatus->cancelled;
+            }
+            auto& reason = promise._currentWaitReason;
             return reason == nullptr || reason->isReady();
         }
 
@@ -152,11 +177,28 @@ namespace neon
             return _valid;
         }
 
+        [[nodiscard]] std::shared_ptr<const TaskStatus> getAwaitedStatus() const override
+        {
+            return _valid ? _handler.promise()._awaitedStatus : nullptr;
+        }
+
+        [[nodiscard]] std::optional<std::chrono::steady_clock::time_point> getWakeUpTime() const override
+        {
+            if (!_valid) {
+                return {};
+            }
+            auto& reason = _handler.promise()._currentWaitReason;
+            return reason == nullptr ? std::nullopt : reason->getWakeUpTime();
+        }
+
         void launch() const override
         {
             if (isDone()) {
                 return;
             }
+            // The previous pause is over: the coroutine will set a new one if required.
+            _handler.promise()._currentWaitReason = nullptr;
+            _handler.promise()._awaitedStatus = nullptr;
             _handler();
         }
 
@@ -202,6 +244,10 @@ namespace neon
      * Use co_yield with a class that extends CoroutineWaitReason to
      * make your coroutine wait for a specific condition.
      * <p>
+     * Use co_await with a std::shared_ptr<Task<T>> to suspend the coroutine
+     * until the task finishes or is cancelled. Awaiting coroutines are not polled:
+     * they are resumed when the task is resolved.
+     * <p>
      * You may use the TaskRunner instance inside Application
      * to launch this coroutine.
      *
@@ -215,6 +261,7 @@ namespace neon
         struct promise_type // required
         {
             std::unique_ptr<CoroutineWaitReason> _currentWaitReason;
+            std::shared_ptr<const TaskStatus> _awaitedStatus;
             std::exception_ptr _exception;
 
             std::shared_ptr<Task<void>> _task;
@@ -292,7 +339,11 @@ namespace neon
             if (isDone()) {
                 return false;
             }
-            auto& reason = _handler.promise()._currentWaitReason;
+            auto& promise = _handler.promise();
+            if (promise._awaitedStatus != nullptr) {
+                return promise._awaitedStatus->finished || promise._awaitedStatus->cancelled;
+            }
+            auto& reason = promise._currentWaitReason;
             return reason == nullptr || reason->isReady();
         }
 
@@ -306,11 +357,28 @@ namespace neon
             return _valid;
         }
 
+        [[nodiscard]] std::shared_ptr<const TaskStatus> getAwaitedStatus() const override
+        {
+            return _valid ? _handler.promise()._awaitedStatus : nullptr;
+        }
+
+        [[nodiscard]] std::optional<std::chrono::steady_clock::time_point> getWakeUpTime() const override
+        {
+            if (!_valid) {
+                return {};
+            }
+            auto& reason = _handler.promise()._currentWaitReason;
+            return reason == nullptr ? std::nullopt : reason->getWakeUpTime();
+        }
+
         void launch() const override
         {
             if (isDone()) {
                 return;
             }
+            // The previous pause is over: the coroutine will set a new one if required.
+            _handler.promise()._currentWaitReason = nullptr;
+            _handler.promise()._awaitedStatus = nullptr;
             _handler();
         }
 
@@ -344,12 +412,67 @@ namespace neon
         }
     };
 
+    /**
+     * Awaiter returned when a neon::Coroutine uses co_await with a task.
+     * <p>
+     * The coroutine is suspended until the task finishes or is cancelled.
+     * Then, the TaskRunner resumes it on the thread the coroutine was launched on:
+     * the main thread for TaskRunner::launchCoroutine() and a worker for
+     * TaskRunner::launchCoroutineAsync().
+     * <p>
+     * The co_await expression returns a reference to the optional result of the task.
+     * The optional is empty if the task was cancelled. The reference is valid
+     * as long as the task is alive.
+     *
+     * @tparam Result the result type of the task.
+     */
+    template<typename Result>
+    class TaskAwaiter
+    {
+        std::shared_ptr<Task<Result>> _task;
+
+      public:
+        explicit TaskAwaiter(std::shared_ptr<Task<Result>> task) :
+            _task(std::move(task))
+        {
+        }
+
+        [[nodiscard]] bool await_ready() const
+        {
+            return _task->hasFinished() || _task->isCancelled();
+        }
+
+        template<typename Promise>
+        void await_suspend(std::coroutine_handle<Promise> handle) const
+        {
+            handle.promise()._awaitedStatus = _task->getStatus();
+        }
+
+        decltype(auto) await_resume() const
+        {
+            if constexpr (!std::is_void_v<Result>) {
+                return (_task->getResult());
+            }
+        }
+    };
+
+    /**
+     * Allows neon::Coroutine instances to use co_await with a task.
+     *
+     * @see TaskAwaiter
+     */
+    template<typename Result>
+    TaskAwaiter<Result> operator co_await(std::shared_ptr<Task<Result>> task)
+    {
+        return TaskAwaiter<Result>(std::move(task));
+    }
+
     /**
      * Suspends the coroutine for the given amount of seconds.
      */
     class WaitForSeconds : public CoroutineWaitReason
     {
-        std::chrono::system_clock::time_point _wakeUpTime;
+        std::chrono::steady_clock::time_point _wakeUpTime;
 
       public:
         /**
@@ -360,6 +483,8 @@ namespace neon
         ~WaitForSeconds() override = default;
 
         bool isReady() override;
+
+        [[nodiscard]] std::optional<std::chrono::steady_clock::time_point> getWakeUpTime() const override;
     };
 
     /**
@@ -4,45 +4,159 @@
 
 #include "TaskRunner.h"
 
+#include <iterator>
+
 #include <neon/logging/Logger.h>
 
 namespace neon
 {
+    namespace
+    {
+        // Continuations pending to be invoked or destroyed by the outermost
+        // resolution or release running on this thread. Null if there is none.
+        thread_local std::vector<std::function<void()>>* pendingContinuations = nullptr;
+        thread_local std::vector<std::function<void()>>* releasedContinuations = nullptr;
+
+        /**
+         * Runs the given action with the given list as the worklist of this thread.
+         * If the thread already has a worklist, the continuations are moved to it instead.
+         */
+        template<typename Action>
+        void processWorklist(std::vector<std::function<void()>>*& worklist,
+                             std::vector<std::function<void()>>&& continuations, Action action)
+        {
+            if (worklist != nullptr) {
+                std::ranges::move(continuations, std::back_inserter(*worklist));
+                return;
+            }
+
+            std::vector<std::function<void()>> list = std::move(continuations);
+            worklist = &list;
+            try {
+                while (!list.empty()) {
+                    std::function<void()> continuation = std::move(list.back());
+                    list.pop_back();
+                    action(continuation);
+                }
+            } catch (...) {
+                worklist = nullptr;
+                throw;
+            }
+            worklist = nullptr;
+        }
+    } // namespace
+
+    void TaskStatus::addContinuation(std::function<void()> continuation) const
+    {
+        {
+            std::lock_guard lock(continuationMutex);
+            if (released) {
+                return;
+            }
+            if (!resolved) {
+                continuations.push_back(std::move(continuation));
+                return;
+            }
+        }
+        continuation();
+    }
+
+    void TaskStatus::resolve()
+    {
+        std::vector<std::function<void()>> toInvoke;
+        {
+            std::lock_guard lock(continuationMutex);
+            if (resolved || released) {
+                return;
+            }
+            resolved = true;
+            toInvoke.swap(continuations);
+        }
+
+        // Continuations may resolve other statuses, such as when a cancellation is propagated.
+        // They are invoked iteratively: long chains of dependencies don't overflow the stack.
+        processWorklist(pendingContinuations, std::move(toInvoke), [](auto& continuation) { continuation(); });
+    }
+
+    void TaskStatus::release()
+    {
+        std::vector<std::function<void()>> toRelease;
+        {
+            std::lock_guard lock(continuationMutex);
+            if (resolved || released) {
+                return;
+            }
+            released = true;
+            toRelease.swap(continuations);
+        }
+
+        // Destroying a continuation may destroy a task that releases its own status.
+        processWorklist(releasedContinuations, std::move(toRelease), [](auto&) {});
+    }
+
+    TaskFramePool::TaskFramePool() :
+        _freeFrames(nullptr)
+    {
+    }
+
+    void* TaskFramePool::allocate()
+    {
+        std::lock_guard lock(_mutex);
+        if (_freeFrames == nullptr) {
+            auto chunk = std::make_unique<std::byte[]>(FRAME_SIZE * FRAMES_PER_CHUNK);
+            for (size_t i = 0; i < FRAMES_PER_CHUNK; ++i) {
+                auto* frame = reinterpret_cast<FreeFrame*>(chunk.get() + i * FRAME_SIZE);
+                frame->next = _freeFrames;
+                _freeFrames = frame;
+            }
+            _chunks.push_back(std::move(chunk));
+        }
+
+        FreeFrame* frame = _freeFrames;
+        _freeFrames = frame->next;
+        return frame;
+    }
+
+    void TaskFramePool::deallocate(void* frame)
+    {
+        std::lock_guard lock(_mutex);
+        auto* free = static_cast<FreeFrame*>(frame);
+        free->next = _freeFrames;
+        _freeFrames = free;
+    }
+
+    namespace
+    {
+        thread_local const TaskRunner* localRunner = nullptr;
+        thread_local size_t localWorkerIndex = 0;
+    } // namespace
+
     TaskRunner::TaskRunner() :
+        TaskRunner(TaskRunnerMode::SHARED_QUEUE)
+    {
+    }
+
+    TaskRunner::TaskRunner(TaskRunnerMode mode) :
+        _mode(mode),
+        _framePool(std::make_shared<TaskFramePool>()),
+        _blockedTasksPruneSize(MIN_BLOCKED_TASKS_PRUNE_SIZE),
+        _queuedTasks(0),
+        _sleepingWorkers(0),
+        _nextWorkerQueue(0),
         _stop(false)
     {
         uint32_t threads = std::max(std::thread::hardware_concurrency(), 2u) - 1u;
         _workers.reserve(threads);
 
+        if (_mode == TaskRunnerMode::WORK_STEALING) {
+            _workerQueues.reserve(threads);
+            for (uint32_t i = 0; i < threads; ++i) {
+                _workerQueues.push_back(std::make_unique<WorkerQueue>());
+            }
+        }
+
         for (uint32_t i = 0; i < threads; ++i) {
-            _workers.emplace_back([this] {
-                RunningTask task;
-                while (true) {
-                    {
-                        std::unique_lock lock(_mutex);
-                        _pendingTasksCondition.wait(lock, [this] { return !_pendingTasks.empty() || _stop; });
-
-                        if (_stop && _pendingTasks.empty()) {
-                            return;
-                        }
-
-                        task = std::move(_pendingTasks.front());
-                        _pendingTasks.pop();
-                    }
-
-                    try {
-                        task.function();
-                    } catch (std::exception& ex) {
-                        logger.error(MessageBuilder()
-                                         .print("Error while executing task: ")
-                                         .print(ex.what(), TextEffect::foreground4bits(1))
-                                         .print("."));
-                        task.task->cancel();
-                    }
-
-                    checkBlockedTasks();
-                }
-            });
+            _workers.emplace_back([this, i] { workerLoop(i); });
         }
     }
 
@@ -51,57 +165,219 @@ namespace neon
         shutdown();
     }
 
-    void TaskRunner::manageRunningTaskAddition(RunningTask&& task)
+    void TaskRunner::workerLoop(size_t index)
     {
-        if (task.task->isAnyDependencyCancelled() || task.task->isCancelled()) {
+        localRunner = this;
+        localWorkerIndex = index;
+
+        RunningTask task;
+        while (fetchTask(task)) {
+            runTask(task);
+        }
+    }
+
+    void TaskRunner::runTask(RunningTask& task)
+    {
+        try {
+            task.function();
+        } catch (std::exception& ex) {
+            logger.error(MessageBuilder()
+                             .print("Error while executing task: ")
+                             .print(ex.what(), TextEffect::foreground4bits(1))
+                             .print("."));
             task.task->cancel();
-            return;
         }
+    }
+
+    bool TaskRunner::fetchTask(RunningTask& task)
+    {
+        if (_mode == TaskRunnerMode::SHARED_QUEUE) {
+            std::unique_lock lock(_mutex);
+            _pendingTasksCondition.wait(lock, [this] { return !_pendingTasks.empty() || _stop; });
+
+            if (_stop && _pendingTasks.empty()) {
+                return false;
+            }
+
+            task = _pendingTasks.pop_front();
+            return true;
+        }
+
+        while (true) {
+            if (tryFetchTask(task)) {
+                return true;
+            }
+
+            std::unique_lock lock(_mutex);
+            ++_sleepingWorkers;
+            _pendingTasksCondition.wait(lock, [this] { return _queuedTasks > 0 || _stop; });
+            --_sleepingWorkers;
+
+            if (_stop && _queuedTasks == 0) {
+                return false;
+            }
+        }
+    }
+
+    bool TaskRunner::tryFetchTask(RunningTask& task)
+    {
+        if (_mode == TaskRunnerMode::SHARED_QUEUE) {
+            std::lock_guard lock(_mutex);
+            if (_pendingTasks.empty()) {
+                return false;
+            }
+            task = _pendingTasks.pop_front();
+            return true;
+        }
+
+        if (localRunner != this) {
+            return fetchStolenTask(_nextWorkerQueue.load(), _workerQueues.size(), task);
+        }
+
+        // Newest tasks first: they are the most likely to be hot in the cache.
+        {
+            auto& queue = *_workerQueues[localWorkerIndex];
+            std::lock_guard lock(queue.mutex);
+            if (!queue.tasks.empty()) {
+                task = queue.tasks.pop_back();
+                --_queuedTasks;
+                return true;
+            }
+        }
+
+        return fetchStolenTask(localWorkerIndex + 1, _workerQueues.size() - 1, task);
+    }
+
+    bool TaskRunner::fetchStolenTask(size_t first, size_t amount, RunningTask& task)
+    {
+        for (size_t i = 0; i < amount; ++i) {
+            auto& queue = *_workerQueues[(first + i) % _workerQueues.size()];
+            std::lock_guard lock(queue.mutex);
+            if (!queue.tasks.empty()) {
+                task = queue.tasks.pop_front();
+                --_queuedTasks;
+                return true;
+            }
+        }
+        return false;
+    }
 
-        if (!task.task->isUnlocked()) {
-            std::lock_guard lock(_blockedMutex);
-            _blockedTasks.push_back(std::move(task));
+    void TaskRunner::pushAsyncTask(RunningTask&& task)
+    {
+        if (_mode == TaskRunnerMode::SHARED_QUEUE) {
+            std::lock_guard lock(_mutex);
+            _pendingTasks.push_back(std::move(task));
+            _pendingTasksCondition.notify_one();
             return;
         }
 
+        // Tasks launched from a worker stay in its deque.
+        // Tasks launched from other threads are distributed in a round-robin fashion.
+        size_t index = localRunner == this ? localWorkerIndex : _nextWorkerQueue++ % _workerQueues.size();
+        {
+            auto& queue = *_workerQueues[index];
+            std::lock_guard lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+
+        ++_queuedTasks;
+        if (_sleepingWorkers > 0) {
+            std::lock_guard lock(_mutex);
+            _pendingTasksCondition.notify_one();
+        }
+    }
+
+    void TaskRunner::pushUnlockedTask(RunningTask&& task)
+    {
         if (task.runOnMainThread) {
             std::lock_guard lock(_mainThreadMutex);
-            _mainThreadTasks.push(std::move(task));
+            _mainThreadTasks.push_back(std::move(task));
             return;
         }
 
-        std::lock_guard lock(_mutex);
-        _pendingTasks.push(std::move(task));
-        _pendingTasksCondition.notify_one();
+        pushAsyncTask(std::move(task));
     }
 
-    void TaskRunner::checkBlockedTasks()
+    void TaskRunner::releaseBlockedTask(const std::shared_ptr<BlockedTask>& blocked)
     {
-        std::lock_guard lock(_blockedMutex);
+        if (--blocked->pendingDependencies > 0) {
+            return;
+        }
 
-        for (auto it = _blockedTasks.begin(); it != _blockedTasks.end();) {
-            auto& task = *it;
-            if (task.task->isCancelled() || task.task->isAnyDependencyCancelled()) {
-                task.task->cancel();
-                it = _blockedTasks.erase(it);
-                continue;
-            }
+        RunningTask task = std::move(blocked->running);
+        if (task.task->isCancelled() || task.task->isAnyDependencyCancelled()) {
+            task.task->cancel();
+            return;
+        }
 
-            if (task.task->isUnlocked()) {
-                if (task.runOnMainThread) {
-                    std::lock_guard pushLock(_mainThreadMutex);
-                    _mainThreadTasks.push(std::move(task));
-                } else {
-                    std::lock_guard pushLock(_mutex);
-                    _pendingTasks.push(std::move(task));
-                    _pendingTasksCondition.notify_one();
+        pushUnlockedTask(std::move(task));
+    }
+
+    void TaskRunner::manageRunningTaskAddition(RunningTask&& task)
+    {
+        if (task.task->isAnyDependencyCancelled() || task.task->isCancelled()) {
+            task.task->cancel();
+            return;
+        }
+
+        if (task.task->isUnlocked()) {
+            pushUnlockedTask(std::move(task));
+            return;
+        }
+
+        auto& dependencies = task.task->getDependencies();
+
+        // The extra pending dependency prevents the task from being
+        // released while the continuations are still being registered.
+        auto blocked = std::make_shared<BlockedTask>(std::move(task), dependencies.size() + 1);
+        trackBlockedTask(blocked);
+        for (auto& [ignoreCancellations, status] : dependencies) {
+            status->addContinuation([this, blocked, ignore = ignoreCancellations, dependency = status.get()] {
+                // The runner may have been destroyed after abandoning the task.
+                if (blocked->abandoned) {
+                    return;
+                }
+                // Cancel as soon as possible, propagating the cancellation to our dependents.
+                if (!ignore && dependency->cancelled) {
+                    blocked->running.task->cancel();
                 }
-                it = _blockedTasks.erase(it);
+                releaseBlockedTask(blocked);
+            });
+        }
+        releaseBlockedTask(blocked);
+    }
 
-                continue;
+    void TaskRunner::trackBlockedTask(const std::shared_ptr<BlockedTask>& blocked)
+    {
+        std::lock_guard lock(_blockedTasksMutex);
+        if (_blockedTasks.size() >= _blockedTasksPruneSize) {
+            std::erase_if(_blockedTasks, [](const auto& weak) { return weak.expired(); });
+            _blockedTasksPruneSize = std::max(MIN_BLOCKED_TASKS_PRUNE_SIZE, _blockedTasks.size() * 2);
+        }
+        _blockedTasks.push_back(blocked);
+    }
+
+    void TaskRunner::abandonBlockedTasks()
+    {
+        std::vector<std::shared_ptr<BlockedTask>> abandoned;
+        {
+            std::lock_guard lock(_blockedTasksMutex);
+            for (auto& weak : _blockedTasks) {
+                auto blocked = weak.lock();
+                // A task with no pending dependencies has already been released.
+                if (blocked != nullptr && blocked->pendingDependencies.exchange(0) > 0) {
+                    blocked->abandoned = true;
+                    abandoned.push_back(std::move(blocked));
+                }
             }
+            _blockedTasks.clear();
+        }
 
-            ++it;
+        // Cancelling a task resolves the continuations of its abandoned dependents, which do nothing.
+        // Dropping the task breaks the cycle between it and the statuses of its dependencies.
+        for (auto& blocked : abandoned) {
+            blocked->running.task->cancel();
+            blocked->running = RunningTask();
         }
     }
 
@@ -119,6 +395,91 @@ namespace neon
         for (auto& worker : _workers) {
             worker.join();
         }
+
+        abandonBlockedTasks();
+
+        // Main thread tasks are not flushed after the runner stops.
+        RingDeque<RunningTask> mainThreadTasks;
+        {
+            std::lock_guard lock(_mainThreadMutex);
+            std::swap(mainThreadTasks, _mainThreadTasks);
+        }
+        while (!mainThreadTasks.empty()) {
+            mainThreadTasks.pop_front().task->cancel();
+        }
+    }
+
+    void TaskRunner::waitAndHelp(const AbstractTask& task)
+    {
+        auto status = task.getStatus();
+        auto isDone = [&status] { return status->finished || status->cancelled; };
+
+        // Wakes this thread once the task is resolved, even if no new work arrives.
+        status->addContinuation([this] {
+            std::lock_guard lock(_mutex);
+            _pendingTasksCondition.notify_all();
+        });
+
+        RunningTask running;
+        while (!isDone()) {
+            if (tryFetchTask(running)) {
+                runTask(running);
+                running = RunningTask();
+                continue;
+            }
+
+            // Nothing to help with: sleep like an idle worker until work is queued or the task is resolved.
+            std::unique_lock lock(_mutex);
+            if (_mode == TaskRunnerMode::SHARED_QUEUE) {
+                _pendingTasksCondition.wait(lock, [&] { return isDone() || !_pendingTasks.empty(); });
+            } else {
+                ++_sleepingWorkers;
+                _pendingTasksCondition.wait(lock, [&] { return isDone() || _queuedTasks > 0; });
+                --_sleepingWorkers;
+            }
+        }
+    }
+
+    TaskRunnerMode TaskRunner::getMode() const
+    {
+        return _mode;
+    }
+
+    void TaskRunner::resumeCoroutine(const LaunchedCoroutine& coroutine)
+    {
+        if (coroutine.runOnMainThread) {
+            executeOnMainThread([this, coroutine] { stepCoroutine(coroutine); });
+        } else {
+            executeAsync([this, coroutine] { stepCoroutine(coroutine); });
+        }
+    }
+
+    void TaskRunner::stepCoroutine(const LaunchedCoroutine& coroutine)
+    {
+        coroutine.coroutine->launch();
+        if (coroutine.coroutine->isDone()) {
+            return;
+        }
+
+        if (auto status = coroutine.coroutine->getAwaitedStatus()) {
+            // The continuation owns the coroutine until the awaited task is resolved.
+            status->addContinuation([this, coroutine] { resumeCoroutine(coroutine); });
+            return;
+        }
+
+        parkCoroutine(coroutine);
+    }
+
+    void TaskRunner::parkCoroutine(LaunchedCoroutine coroutine)
+    {
+        auto wakeUpTime = coroutine.coroutine->getWakeUpTime();
+
+        std::lock_guard lock(_coroutineMutex);
+        if (wakeUpTime.has_value()) {
+            _sleepingCoroutines.push({*wakeUpTime, std::move(coroutine)});
+        } else {
+            _coroutines.push_back(std::move(coroutine));
+        }
     }
 
     void TaskRunner::flushMainThreadTasks()
@@ -126,33 +487,57 @@ namespace neon
         if (_stop) {
             return;
         }
+
+        // Coroutines parked while this flush runs will be checked on the next one.
         {
             std::lock_guard lock(_coroutineMutex);
-            std::erase_if(_coroutines, [](const auto& it) { return it->isDone(); });
+            _flushedCoroutines.swap(_coroutines);
 
-            for (auto& coroutine : _coroutines) {
-                if (coroutine->isReady()) {
-                    coroutine->launch();
+            auto now = std::chrono::steady_clock::now();
+            while (!_sleepingCoroutines.empty() && _sleepingCoroutines.top().wakeUpTime <= now) {
+                _flushedCoroutines.push_back(_sleepingCoroutines.top().coroutine);
+                _sleepingCoroutines.pop();
+            }
+        }
+
+        // Coroutines that are not ready are compacted at the beginning of the list.
+        size_t waiting = 0;
+        for (size_t i = 0; i < _flushedCoroutines.size(); ++i) {
+            auto& coroutine = _flushedCoroutines[i];
+            if (coroutine.coroutine->isDone()) {
+                continue;
+            }
+            if (!coroutine.coroutine->isReady()) {
+                if (waiting != i) {
+                    _flushedCoroutines[waiting] = std::move(coroutine);
                 }
+                ++waiting;
+            } else if (coroutine.runOnMainThread) {
+                stepCoroutine(coroutine);
+            } else {
+                resumeCoroutine(coroutine);
             }
         }
-        {
-            std::lock_guard lock(_mainThreadMutex);
-            while (!_mainThreadTasks.empty()) {
-                RunningTask task;
-                try {
-                    task = std::move(_mainThreadTasks.front());
-                    _mainThreadTasks.pop();
-                    task.function();
-                } catch (std::exception& ex) {
-                    logger.error(MessageBuilder()
-                                     .print("Error while executing task: ")
-                                     .print(ex.what(), TextEffect::foreground4bits(1))
-                                     .print("."));
-                    task.task->cancel();
+
+        if (waiting > 0) {
+            std::lock_guard lock(_coroutineMutex);
+            _coroutines.insert(_coroutines.end(), std::make_move_iterator(_flushedCoroutines.begin()),
+                               std::make_move_iterator(_flushedCoroutines.begin() + waiting));
+        }
+        _flushedCoroutines.clear();
+
+        // Tasks are executed without holding the lock:
+        // they may resolve other tasks that push new main thread tasks.
+        while (true) {
+            RunningTask task;
+            {
+                std::lock_guard lock(_mainThreadMutex);
+                if (_mainThreadTasks.empty()) {
+                    break;
                 }
+                task = _mainThreadTasks.pop_front();
             }
+            runTask(task);
         }
-        checkBlockedTasks();
     }
 } // namespace neon
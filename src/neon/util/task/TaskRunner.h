@@ -6,17 +6,21 @@
 #define TASKRUNNER_H
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <coroutine>
 #include <vector>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <queue>
 #include <thread>
+#include <tuple>
 #include <utility>
 #include <variant>
 #include <neon/logging/Logger.h>
+#include <neon/util/RingDeque.h>
 
 #include <neon/util/task/AbstractCoroutine.h>
 
@@ -30,13 +34,64 @@ namespace neon
      *
      * This structure is used by task implementations to indicate if a task has
      * finished execution or has been cancelled.
+     * <p>
+     * The status also stores the continuations of the task: functions that
+     * are invoked once when the task finishes or is cancelled.
+     * TaskRunner uses them to wake the tasks that depend on this one
+     * without rescanning all blocked tasks.
+     * <p>
+     * Continuations that resolve other statuses don't recurse:
+     * the continuations of those statuses are queued and invoked
+     * by the outermost resolution on the same thread.
      */
     struct TaskStatus
     {
-        std::atomic_bool finished;
-        std::atomic_bool cancelled;
+        std::atomic_bool finished = false;
+        std::atomic_bool cancelled = false;
+
+        mutable std::mutex continuationMutex;
+        mutable std::vector<std::function<void()>> continuations;
+        mutable bool resolved = false;
+        mutable bool released = false;
+
+        /**
+         * Registers a function to be invoked once the task finishes or is cancelled.
+         * <p>
+         * If the task has already been resolved, the function is invoked immediately
+         * on the calling thread. Otherwise, it will be invoked on the thread
+         * that resolves the task.
+         *
+         * @param continuation the function to invoke.
+         */
+        void addContinuation(std::function<void()> continuation) const;
+
+        /**
+         * Invokes all registered continuations.
+         * <p>
+         * Task implementations must call this method once,
+         * after setting the finished or cancelled flag.
+         */
+        void resolve();
+
+        /**
+         * Destroys all registered continuations without invoking them.
+         * Continuations registered afterward are destroyed immediately.
+         * <p>
+         * Tasks destroyed before being resolved call this method:
+         * the continuations own the tasks that depend on them,
+         * which would be kept alive forever.
+         * This method does nothing if the status has already been resolved.
+         */
+        void release();
     };
 
+    /**
+     * A dependency of a task.
+     * The first value represents whether the cancellation of the dependency
+     * should be ignored. The second value is the status of the dependency.
+     */
+    using TaskDependency = std::pair<bool, std::shared_ptr<const TaskStatus>>;
+
     /**
      * Abstract base class for all tasks.
      *
@@ -107,6 +162,13 @@ namespace neon
          */
         [[nodiscard]] virtual bool isAnyDependencyCancelled() const = 0;
 
+        /**
+         * Returns the dependencies of this task.
+         *
+         * @return the dependencies of this task.
+         */
+        [[nodiscard]] virtual const std::vector<TaskDependency>& getDependencies() const = 0;
+
         /**
          * Provides the task with its execution context.
          *
@@ -134,11 +196,28 @@ namespace neon
         std::mutex _valueMutex;
         std::condition_variable _valueCondition;
 
-        std::vector<std::pair<bool, std::shared_ptr<const TaskStatus>>> _dependencies;
+        std::vector<TaskDependency> _dependencies;
 
         std::shared_ptr<TaskStatus> _status;
         std::optional<HoldValue> _result;
 
+      protected:
+        /**
+         * Constructs a new Task instance that uses the given status.
+         * <p>
+         * The status is shared with the dependents of the task,
+         * which don't keep the task nor its result alive.
+         *
+         * @param runner Pointer to the TaskRunner managing the task.
+         * @param status the status of the task.
+         */
+        Task(TaskRunner* runner, std::shared_ptr<TaskStatus> status) :
+            _runner(runner),
+            _status(std::move(status)),
+            _result()
+        {
+        }
+
       public:
         /**
          * Constructs a new Task instance.
@@ -146,13 +225,14 @@ namespace neon
          * @param runner Pointer to the TaskRunner managing the task.
          */
         explicit Task(TaskRunner* runner) :
-            _runner(runner),
-            _status(std::make_shared<TaskStatus>(false, false)),
-            _result()
+            Task(runner, std::make_shared<TaskStatus>())
         {
         }
 
-        ~Task() override = default;
+        ~Task() override
+        {
+            _status->release();
+        }
 
         [[nodiscard]] std::shared_ptr<const TaskStatus> getStatus() const override
         {
@@ -172,20 +252,20 @@ namespace neon
         void wait() override
         {
             std::unique_lock lock(_valueMutex);
-            if (_status->finished || _status->cancelled) {
-                return;
-            }
-            _valueCondition.wait(lock);
+            _valueCondition.wait(lock, [this] { return _status->finished || _status->cancelled; });
         }
 
         void cancel() override
         {
-            std::lock_guard lock(_valueMutex);
-            if (_status->finished || _status->cancelled) {
-                return;
+            {
+                std::lock_guard lock(_valueMutex);
+                if (_status->finished || _status->cancelled) {
+                    return;
+                }
+                _status->cancelled = true;
+                _valueCondition.notify_all();
             }
-            _status->cancelled = true;
-            _valueCondition.notify_all();
+            _status->resolve();
         }
 
         void addDependency(bool ignoreCancellations, const AbstractTask* dependency) override
@@ -212,6 +292,11 @@ namespace neon
             });
         }
 
+        [[nodiscard]] const std::vector<TaskDependency>& getDependencies() const override
+        {
+            return _dependencies;
+        }
+
         /**
          * Sets the result of the task and marks it as finished.
          *
@@ -221,13 +306,16 @@ namespace neon
          */
         void setResult(HoldValue&& result)
         {
-            std::lock_guard lock(_valueMutex);
-            if (_status->finished || _status->cancelled) {
-                return;
+            {
+                std::lock_guard lock(_valueMutex);
+                if (_status->finished || _status->cancelled) {
+                    return;
+                }
+                _result = std::move(result);
+                _status->finished = true;
+                _valueCondition.notify_all();
             }
-            _result = std::move(result);
-            _status->finished = true;
-            _valueCondition.notify_all();
+            _status->resolve();
         }
 
         /**
@@ -293,6 +381,159 @@ namespace neon
             -> std::shared_ptr<Task<decltype(function(std::forward<Args>(args)...))>>;
     };
 
+    /**
+     * A thread-safe pool of fixed-size memory blocks used to store task frames.
+     * <p>
+     * Blocks are allocated in chunks and never returned to the system
+     * until the pool is destroyed. Once the pool has warmed up,
+     * allocating and releasing frames requires no heap allocation.
+     */
+    class TaskFramePool
+    {
+        struct FreeFrame
+        {
+            FreeFrame* next;
+        };
+
+        std::mutex _mutex;
+        FreeFrame* _freeFrames;
+        std::vector<std::unique_ptr<std::byte[]>> _chunks;
+
+      public:
+        /**
+         * The size in bytes of each block.
+         * Frames that don't fit in a block are allocated using the global allocator.
+         */
+        static constexpr size_t FRAME_SIZE = 512;
+
+        /**
+         * The amount of blocks allocated at once when the pool runs out of blocks.
+         */
+        static constexpr size_t FRAMES_PER_CHUNK = 64;
+
+        TaskFramePool();
+
+        TaskFramePool(const TaskFramePool& other) = delete;
+
+        /**
+         * @return a block of FRAME_SIZE bytes aligned to std::max_align_t.
+         */
+        void* allocate();
+
+        /**
+         * Returns a block to the pool.
+         *
+         * @param frame the block to return. It must have been allocated by this pool.
+         */
+        void deallocate(void* frame);
+    };
+
+    /**
+     * Standard allocator that takes its memory from a TaskFramePool.
+     * <p>
+     * This allocator is used by TaskRunner with std::allocate_shared:
+     * the task, its control block, its function and its arguments
+     * are stored inside a single pooled block. The status of the task uses its own block,
+     * so the dependents of a task don't keep the frame alive.
+     * The allocator keeps the pool alive, so tasks may outlive their TaskRunner.
+     *
+     * @tparam T the type to allocate.
+     */
+    template<typename T>
+    struct TaskFrameAllocator
+    {
+        using value_type = T;
+
+        std::shared_ptr<TaskFramePool> pool;
+
+        explicit TaskFrameAllocator(std::shared_ptr<TaskFramePool> pool) :
+            pool(std::move(pool))
+        {
+        }
+
+        template<typename U>
+        TaskFrameAllocator(const TaskFrameAllocator<U>& other) :
+            pool(other.pool)
+        {
+        }
+
+        static constexpr bool fitsInFrame()
+        {
+            return sizeof(T) <= TaskFramePool::FRAME_SIZE && alignof(T) <= alignof(std::max_align_t);
+        }
+
+        T* allocate(size_t n)
+        {
+            if constexpr (fitsInFrame()) {
+                if (n == 1) {
+                    return static_cast<T*>(pool->allocate());
+                }
+            }
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* pointer, size_t n)
+        {
+            if constexpr (fitsInFrame()) {
+                if (n == 1) {
+                    pool->deallocate(pointer);
+                    return;
+                }
+            }
+            std::allocator<T>().deallocate(pointer, n);
+        }
+
+        template<typename U>
+        bool operator==(const TaskFrameAllocator<U>& other) const
+        {
+            return pool == other.pool;
+        }
+    };
+
+    /**
+     * A task that stores the function to execute and its arguments inline.
+     * <p>
+     * TaskRunner allocates these tasks inside pooled blocks.
+     * The function and the arguments are released once the task has been executed.
+     *
+     * @tparam Return the result type of the function.
+     * @tparam Func the type of the function.
+     * @tparam Args the decayed types of the arguments.
+     */
+    template<typename Return, typename Func, typename... Args>
+    class TaskFrame final : public Task<Return>
+    {
+        std::optional<Func> _function;
+        std::optional<std::tuple<Args...>> _arguments;
+
+      public:
+        template<typename F, typename... A>
+        explicit TaskFrame(TaskRunner* runner, std::shared_ptr<TaskStatus> status, F&& function, A&&... args) :
+            Task<Return>(runner, std::move(status)),
+            _function(std::forward<F>(function)),
+            _arguments(std::in_place, std::forward<A>(args)...)
+        {
+        }
+
+        /**
+         * Executes the function and stores its result.
+         * The function is not executed if the task has been cancelled.
+         */
+        void run()
+        {
+            if (!this->isCancelled()) {
+                if constexpr (std::is_void_v<Return>) {
+                    std::apply(*_function, std::move(*_arguments));
+                    this->setResult(std::monostate());
+                } else {
+                    this->setResult(std::apply(*_function, std::move(*_arguments)));
+                }
+            }
+            _function.reset();
+            _arguments.reset();
+        }
+    };
+
     /**
      * Structure used by a TaskRunner representing a scheduled running task.
      *
@@ -306,6 +547,24 @@ namespace neon
         bool runOnMainThread;
     };
 
+    /**
+     * The strategy a TaskRunner uses to distribute asynchronous tasks among its workers.
+     */
+    enum class TaskRunnerMode
+    {
+        /**
+         * All workers pop tasks from a single queue guarded by one mutex.
+         */
+        SHARED_QUEUE,
+
+        /**
+         * Each worker owns a deque of tasks.
+         * Tasks launched from a worker are pushed into its own deque,
+         * and idle workers steal tasks from the deques of other workers.
+         */
+        WORK_STEALING
+    };
+
     /**
      * Manages and executes user-defined tasks.
      *
@@ -315,26 +574,209 @@ namespace neon
      */
     class TaskRunner
     {
+        /**
+         * A task waiting for its dependencies.
+         * The counter holds the amount of dependencies that have not been resolved yet.
+         */
+        struct BlockedTask
+        {
+            RunningTask running;
+            std::atomic_size_t pendingDependencies;
+            std::atomic_bool abandoned = false;
+        };
+
+        /**
+         * A coroutine launched by this runner.
+         * The flag indicates whether the coroutine must be resumed on the main thread or on a worker.
+         */
+        struct LaunchedCoroutine
+        {
+            std::shared_ptr<AbstractCoroutine> coroutine;
+            bool runOnMainThread;
+        };
+
+        /**
+         * A coroutine waiting for a deadline.
+         * These coroutines are stored in a min-heap sorted by their wake-up time.
+         */
+        struct SleepingCoroutine
+        {
+            std::chrono::steady_clock::time_point wakeUpTime;
+            LaunchedCoroutine coroutine;
+
+            bool operator>(const SleepingCoroutine& other) const
+            {
+                return wakeUpTime > other.wakeUpTime;
+            }
+        };
+
+        /**
+         * The deque owned by a worker when the runner uses TaskRunnerMode::WORK_STEALING.
+         * The owner pushes and pops from the back, while thieves pop from the front.
+         */
+        struct WorkerQueue
+        {
+            std::mutex mutex;
+            RingDeque<RunningTask> tasks;
+        };
+
+        /**
+         * The minimum size of the list of blocked tasks before expired entries are pruned.
+         */
+        static constexpr size_t MIN_BLOCKED_TASKS_PRUNE_SIZE = 64;
+
+        TaskRunnerMode _mode;
         std::vector<std::thread> _workers;
-        std::vector<RunningTask> _blockedTasks;
-        std::queue<RunningTask> _pendingTasks;
-        std::queue<RunningTask> _mainThreadTasks;
-        std::vector<std::unique_ptr<AbstractCoroutine>> _coroutines;
-        std::mutex _mutex, _blockedMutex, _coroutineMutex, _mainThreadMutex;
+        std::vector<std::unique_ptr<WorkerQueue>> _workerQueues;
+        RingDeque<RunningTask> _pendingTasks;
+        RingDeque<RunningTask> _mainThreadTasks;
+        std::shared_ptr<TaskFramePool> _framePool;
+        std::vector<LaunchedCoroutine> _coroutines;
+        std::vector<LaunchedCoroutine> _flushedCoroutines;
+        std::priority_queue<SleepingCoroutine, std::vector<SleepingCoroutine>, std::greater<>> _sleepingCoroutines;
+        std::vector<std::weak_ptr<BlockedTask>> _blockedTasks;
+        size_t _blockedTasksPruneSize;
+        std::mutex _mutex, _coroutineMutex, _mainThreadMutex, _blockedTasksMutex;
         std::condition_variable _pendingTasksCondition;
 
+        std::atomic_size_t _queuedTasks;
+        std::atomic_size_t _sleepingWorkers;
+        std::atomic_size_t _nextWorkerQueue;
+
         bool _stop;
 
+        void workerLoop(size_t index);
+
+        void runTask(RunningTask& task);
+
+        bool fetchTask(RunningTask& task);
+
+        bool tryFetchTask(RunningTask& task);
+
+        bool fetchStolenTask(size_t first, size_t amount, RunningTask& task);
+
+        void pushAsyncTask(RunningTask&& task);
+
+        void pushUnlockedTask(RunningTask&& task);
+
+        void releaseBlockedTask(const std::shared_ptr<BlockedTask>& blocked);
+
         void manageRunningTaskAddition(RunningTask&& task);
 
-        void checkBlockedTasks();
+        void trackBlockedTask(const std::shared_ptr<BlockedTask>& blocked);
+
+        void abandonBlockedTasks();
+
+        void resumeCoroutine(const LaunchedCoroutine& coroutine);
+
+        void stepCoroutine(const LaunchedCoroutine& coroutine);
+
+        void parkCoroutine(LaunchedCoroutine coroutine);
+
+        template<typename Func, typename... Args>
+        auto createFrame(bool runOnMainThread, Func&& function, Args&&... args)
+            -> std::shared_ptr<Task<decltype(function(std::forward<Args>(args)...))>>
+        {
+            using Return = decltype(function(std::forward<Args>(args)...));
+            using Frame = TaskFrame<Return, std::decay_t<Func>, std::decay_t<Args>...>;
+            if (_stop) {
+                return nullptr;
+            }
+
+            // The status is pooled too: dependents only keep the status alive, not the frame.
+            auto status = std::allocate_shared<TaskStatus>(TaskFrameAllocator<TaskStatus>(_framePool));
+            std::shared_ptr<Frame> frame =
+                std::allocate_shared<Frame>(TaskFrameAllocator<Frame>(_framePool), this, std::move(status),
+                                            std::forward<Func>(function), std::forward<Args>(args)...);
+
+            // The frame is kept alive by the running task, so a raw pointer is enough.
+            // This keeps the function inside std::function's small buffer.
+            RunningTask running{.task = frame, .runOnMainThread = runOnMainThread};
+            running.function = [raw = frame.get()] { raw->run(); };
+
+            manageRunningTaskAddition(std::move(running));
+
+            return frame;
+        }
+
+        template<typename Func>
+        void parallelForRange(size_t begin, size_t end, size_t grainSize, const Func& function)
+        {
+            if (end - begin <= grainSize) {
+                for (size_t i = begin; i < end; ++i) {
+                    function(i);
+                }
+                return;
+            }
+
+            size_t middle = begin + (end - begin) / 2;
+            auto right = executeAsync(
+                [this, middle, end, grainSize, &function] { parallelForRange(middle, end, grainSize, function); });
+
+            if (right == nullptr) {
+                parallelForRange(begin, middle, grainSize, function);
+                parallelForRange(middle, end, grainSize, function);
+                return;
+            }
+
+            try {
+                parallelForRange(begin, middle, grainSize, function);
+            } catch (...) {
+                // The right half references the function: it must finish before unwinding.
+                waitAndHelp(*right);
+                throw;
+            }
+            waitAndHelp(*right);
+        }
+
+        template<typename T, typename Map, typename Reduce>
+        T parallelReduceRange(size_t begin, size_t end, size_t grainSize, const T& identity, const Map& map,
+                              const Reduce& reduce)
+        {
+            if (end - begin <= grainSize) {
+                T value = identity;
+                for (size_t i = begin; i < end; ++i) {
+                    value = reduce(std::move(value), map(i));
+                }
+                return value;
+            }
+
+            size_t middle = begin + (end - begin) / 2;
+            auto right = executeAsync([this, middle, end, grainSize, &identity, &map, &reduce] {
+                return parallelReduceRange(middle, end, grainSize, identity, map, reduce);
+            });
+
+            if (right == nullptr) {
+                T left = parallelReduceRange(begin, middle, grainSize, identity, map, reduce);
+                return reduce(std::move(left), parallelReduceRange(middle, end, grainSize, identity, map, reduce));
+            }
+
+            T left = [&] {
+                try {
+                    return parallelReduceRange(begin, middle, grainSize, identity, map, reduce);
+                } catch (...) {
+                    waitAndHelp(*right);
+                    throw;
+                }
+            }();
+            waitAndHelp(*right);
+
+            return reduce(std::move(left), right->moveResult().value_or(identity));
+        }
 
       public:
         /**
-         * Creates a TaskRunner.
+         * Creates a TaskRunner that uses TaskRunnerMode::SHARED_QUEUE.
          */
         TaskRunner();
 
+        /**
+         * Creates a TaskRunner that uses the given scheduling mode.
+         *
+         * @param mode how asynchronous tasks are distributed among the workers.
+         */
+        explicit TaskRunner(TaskRunnerMode mode);
+
         /**
          * Destroys the TaskRunner.
          * <p>
@@ -347,14 +789,98 @@ namespace neon
          *
          * Stops accepting new tasks and waits for all asynchronous tasks to finish.
          * Note that tasks scheduled on the main thread (including coroutines) are not awaited.
+         * <p>
+         * Tasks that are still waiting for their dependencies and main thread tasks
+         * that have not been flushed are cancelled and released.
+         * Dependencies resolved later don't access this runner.
+         * This method must not run concurrently with the resolution of tasks on other threads.
          */
         void shutdown();
 
+        /**
+         * @return the scheduling mode of this runner.
+         */
+        [[nodiscard]] TaskRunnerMode getMode() const;
+
+        /**
+         * Blocks until the given task finishes or is cancelled.
+         * <p>
+         * Unlike Task::wait(), the calling thread executes other
+         * pending asynchronous tasks while it waits.
+         * When there is nothing to execute, the thread sleeps until
+         * new tasks are queued or the given task is resolved.
+         * A worker joining a task this way keeps its core busy and
+         * cannot deadlock the runner waiting for a task queued behind it.
+         * Tasks scheduled on the main thread are never executed by this method.
+         *
+         * @param task the task to wait for.
+         */
+        void waitAndHelp(const AbstractTask& task);
+
+        /**
+         * Invokes function(i) for every index i inside the range [begin, end).
+         * <p>
+         * The range is split recursively in halves until each subrange
+         * contains at most grainSize indices. One half of each split is
+         * launched as an asynchronous task and the other one is processed
+         * by the current thread, which then joins the launched half using waitAndHelp().
+         * This method returns once all indices have been processed.
+         * <p>
+         * If the function throws on a worker, the error is logged and the
+         * rest of its subrange is skipped, like with any other task.
+         *
+         * @tparam Func the type of the function. It must be invocable with a size_t.
+         * @param begin the first index of the range.
+         * @param end the index after the last index of the range.
+         * @param grainSize the maximum amount of indices processed by a single task.
+         * @param function the function to invoke. It may be invoked concurrently.
+         */
+        template<typename Func>
+        void parallelFor(size_t begin, size_t end, size_t grainSize, Func&& function)
+        {
+            if (begin >= end) {
+                return;
+            }
+            parallelForRange(begin, end, std::max<size_t>(grainSize, 1), function);
+        }
+
+        /**
+         * Maps every index i inside the range [begin, end) and reduces the results into a single value.
+         * <p>
+         * The range is split like in parallelFor().
+         * Each subrange starts its reduction with a copy of the identity value,
+         * and the partial results are combined using the reduce function.
+         * The reduce function must be associative and the identity
+         * value must be neutral for it.
+         *
+         * @tparam T the type of the result.
+         * @tparam Map the type of the map function. It must be invocable with a size_t.
+         * @tparam Reduce the type of the reduce function. It must be invocable with two values of type T.
+         * @param begin the first index of the range.
+         * @param end the index after the last index of the range.
+         * @param grainSize the maximum amount of indices processed by a single task.
+         * @param identity the neutral value of the reduction.
+         * @param map the function that transforms an index into a value.
+         * @param reduce the function that combines two values.
+         * @return the reduced value.
+         */
+        template<typename T, typename Map, typename Reduce>
+        T parallelReduce(size_t begin, size_t end, size_t grainSize, T identity, Map&& map, Reduce&& reduce)
+        {
+            if (begin >= end) {
+                return identity;
+            }
+            return parallelReduceRange(begin, end, std::max<size_t>(grainSize, 1), identity, map, reduce);
+        }
+
         /**
          * Launches all tasks scheduled to run on the main thread.
          *
          * This includes tasks and stored coroutines. It is intended to be called
          * from the main thread.
+         * <p>
+         * Coroutines waiting for a deadline are only touched once their wake-up time
+         * has been reached. Coroutines waiting for other reasons are checked once per call.
          */
         void flushMainThreadTasks();
 
@@ -363,6 +889,9 @@ namespace neon
          *
          * The coroutine is stored internally and will be executed the next time
          * flushMainThreadTasks() is called.
+         * <p>
+         * If the coroutine awaits a task, it is resumed during the first
+         * flushMainThreadTasks() invocation after the task is resolved.
          *
          * @tparam Coroutine The coroutine type.
          * @param coroutine The coroutine instance to schedule.
@@ -374,11 +903,33 @@ namespace neon
             if (_stop) {
                 return;
             }
-            std::unique_ptr<AbstractCoroutine> ptr = std::make_unique<Coroutine>(std::forward<Coroutine&&>(coroutine));
+            std::shared_ptr<AbstractCoroutine> ptr = std::make_shared<Coroutine>(std::forward<Coroutine&&>(coroutine));
             ptr->provideContext(this);
+            parkCoroutine({std::move(ptr), true});
+        }
 
-            std::lock_guard lock(_coroutineMutex);
-            _coroutines.push_back(std::move(ptr));
+        /**
+         * Stores and schedules a coroutine to be executed on the worker threads.
+         * <p>
+         * The coroutine is launched immediately. Each time it is resumed,
+         * it may run on a different worker. Coroutines awaiting a task are resumed
+         * by the thread that resolves the task, while coroutines paused
+         * by a CoroutineWaitReason are checked by flushMainThreadTasks()
+         * and resumed on a worker once they are ready.
+         *
+         * @tparam Coroutine The coroutine type.
+         * @param coroutine The coroutine instance to schedule.
+         */
+        template<typename Coroutine>
+            requires(!std::is_reference_v<Coroutine>)
+        void launchCoroutineAsync(Coroutine&& coroutine)
+        {
+            if (_stop) {
+                return;
+            }
+            std::shared_ptr<AbstractCoroutine> ptr = std::make_shared<Coroutine>(std::forward<Coroutine&&>(coroutine));
+            ptr->provideContext(this);
+            resumeCoroutine({std::move(ptr), false});
         }
 
         /**
@@ -386,6 +937,7 @@ namespace neon
          *
          * Executes the provided function on the main thread with the given arguments.
          * The execution result (if any) is stored in the returned Task instance.
+         * Like executeAsync(), the task is stored inside a pooled TaskFrame.
          *
          * @tparam Return The return type of the function.
          * @tparam FParams The parameter types of the function.
@@ -397,32 +949,7 @@ namespace neon
         auto executeOnMainThread(Func&& function, Args&&... args)
             -> std::shared_ptr<Task<decltype(function(std::forward<Args>(args)...))>>
         {
-            using Return = decltype(function(std::forward<Args>(args)...));
-            using Tu = std::tuple<std::decay_t<Args>...>;
-            if (_stop) {
-                return nullptr;
-            }
-            std::shared_ptr task = std::make_shared<Task<Return>>(this);
-            std::shared_ptr tuple = std::make_shared<Tu>(std::forward<Args>(args)...);
-
-            RunningTask running{.task = task, .runOnMainThread = true};
-
-            running.function = [task, function, t = std::move(tuple)] {
-                if (task->isCancelled()) {
-                    return;
-                }
-                Tu tu = std::move(*t);
-                if constexpr (std::is_void_v<Return>) {
-                    function(std::move(std::get<std::decay_t<Args>>(tu))...);
-                    task->setResult(std::monostate());
-                } else {
-                    task->setResult(function(std::move(std::get<std::decay_t<Args>>(tu))...));
-                }
-            };
-
-            manageRunningTaskAddition(std::move(running));
-
-            return task;
+            return createFrame(true, std::forward<Func>(function), std::forward<Args>(args)...);
         }
 
         /**
@@ -469,6 +996,11 @@ namespace neon
          *
          * The provided function is executed on a worker thread. Its result
          * is stored in the Task returned.
+         * <p>
+         * The task, the function and the arguments are stored inline inside
+         * a pooled TaskFrame, and the status of the task is stored inside another pooled block.
+         * Once the runner has warmed up, launching a task
+         * whose frame fits in TaskFramePool::FRAME_SIZE bytes requires no heap allocation.
          *
          * @tparam Func The type of the function.
          * @tparam Args The types of the function parameters.
@@ -480,32 +1012,7 @@ namespace neon
         auto executeAsync(Func&& function, Args&&... args)
             -> std::shared_ptr<Task<decltype(function(std::forward<Args>(args)...))>>
         {
-            using Return = decltype(function(std::forward<Args>(args)...));
-            using Tu = std::tuple<std::decay_t<Args>...>;
-            if (_stop) {
-                return nullptr;
-            }
-            std::shared_ptr task = std::make_shared<Task<Return>>(this);
-            std::shared_ptr tuple = std::make_shared<Tu>(std::forward<Args>(args)...);
-
-            RunningTask running{.task = task, .runOnMainThread = false};
-
-            running.function = [task, fun = std::forward<Func>(function), t = std::move(tuple)] {
-                if (task->isCancelled()) {
-                    return;
-                }
-                Tu tu = std::move(*t);
-                if constexpr (std::is_void_v<Return>) {
-                    fun(std::move(std::get<std::decay_t<Args>>(tu))...);
-                    task->setResult(std::monostate());
-                } else {
-                    task->setResult(fun(std::move(std::get<std::decay_t<Args>>(tu))...));
-                }
-            };
-
-            manageRunningTaskAddition(std::move(running));
-
-            return task;
+            return createFrame(false, std::forward<Func>(function), std::forward<Args>(args)...);
         }
 
         /**
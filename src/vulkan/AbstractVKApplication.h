@@ -19,6 +19,10 @@ namespace neon
 
 namespace neon::vulkan
 {
+    class StagingAllocator;
+
+    class StreamingUploader;
+
     class AbstractVKApplication : public ApplicationImplementation
     {
       public:
@@ -42,6 +46,20 @@ namespace neon::vulkan
 
         [[nodiscard]] virtual VKResourceBin* getBin() = 0;
 
+        /**
+         * Returns the allocator that provides the host-visible memory
+         * used to upload data to device-local buffers.
+         * @return the staging allocator.
+         */
+        [[nodiscard]] virtual StagingAllocator* getStagingAllocator() = 0;
+
+        /**
+         * Returns the uploader used to stream data to device-local resources
+         * without recording the copies on the frame's command buffers.
+         * @return the streaming uploader.
+         */
+        [[nodiscard]] virtual StreamingUploader* getStreamingUploader() = 0;
+
         [[nodiscard]] virtual VkSwapchainKHR getSwapChain() const = 0;
 
         [[nodiscard]] virtual uint32_t getMaxFramesInFlight() const = 0;
@@ -288,6 +288,7 @@ namespace neon::vulkan
         _application->getRender()->checkFrameBufferRecreationConditions();
 
         _bin.flush();
+        _streamingUploader->flush();
         if (room != nullptr) {
             room->update(_currentFrameInformation.currentDeltaTime);
             room->preDraw();
@@ -458,6 +459,7 @@ namespace neon::vulkan
         _device = std::make_unique<VKDevice>(_handler->vulkanInstance()->vkInstance(), _handler->physicalDevice(),
                                              _handler->device(), *_queueFamilies, _physicalDevice.getFeatures(),
                                              _presentQueues);
+        _stagingAllocator = std::make_unique<StagingAllocator>(this);
 
         neon::debug() << "Family: " << _handler->graphicsQueueFamilyIndex();
 
@@ -476,6 +478,7 @@ namespace neon::vulkan
 
         _device->getQueueProvider()->markUsed(std::this_thread::get_id(), _handler->graphicsQueueFamilyIndex(), index);
         _commandPool = _commandManager->fetchCommandPool();
+        _streamingUploader = std::make_unique<StreamingUploader>(this, getMaxFramesInFlight() + 1);
 
         initImGui();
         if (_onInit) {
@@ -497,6 +500,8 @@ namespace neon::vulkan
         _application->getAssets().clear();
         _application->setRoom(nullptr);
         _application->setRender(nullptr);
+        _streamingUploader = nullptr;
+        _stagingAllocator = nullptr;
         _bin.waitAndFlush();
 
         if (ImGui::GetIO().BackendRendererUserData != nullptr) {
@@ -565,6 +570,16 @@ namespace neon::vulkan
         return &_bin;
     }
 
+    StagingAllocator* QTApplication::getStagingAllocator()
+    {
+        return _stagingAllocator.get();
+    }
+
+    StreamingUploader* QTApplication::getStreamingUploader()
+    {
+        return _streamingUploader.get();
+    }
+
     void QTApplication::setInitializationFunction(std::function<void(QTApplication*)> func)
     {
         _onInit = std::move(func);
@@ -33,6 +33,8 @@
     #include <QPointer>
 
     #include <vulkan/AbstractVKApplication.h>
+    #include <vulkan/render/buffer/StagingAllocator.h>
+    #include <vulkan/render/buffer/StreamingUploader.h>
 
 namespace neon::vulkan
 {
@@ -118,6 +120,8 @@ namespace neon::vulkan
         std::unique_ptr<CommandManager> _commandManager;
         CommandPoolHolder _commandPool;
         VKResourceBin _bin;
+        std::unique_ptr<StagingAllocator> _stagingAllocator;
+        std::unique_ptr<StreamingUploader> _streamingUploader;
 
         FrameInformation _currentFrameInformation;
         TimeStamp _lastFrameTime;
@@ -244,6 +248,10 @@ namespace neon::vulkan
 
         [[nodiscard]] VKResourceBin* getBin() override;
 
+        [[nodiscard]] StagingAllocator* getStagingAllocator() override;
+
+        [[nodiscard]] StreamingUploader* getStreamingUploader() override;
+
         // region Event handlers
         // These methods are called by the QTApplicationHandler's event filter.
 
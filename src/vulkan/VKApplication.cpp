@@ -327,6 +327,8 @@ namespace neon::vulkan
         createSwapChain();
         createCommandPool();
         createSyncObjects();
+        _stagingAllocator = std::make_unique<StagingAllocator>(this);
+        _streamingUploader = std::make_unique<StreamingUploader>(this, getMaxFramesInFlight() + 1);
         initImGui();
     }
 
@@ -346,6 +348,11 @@ namespace neon::vulkan
             _bin.flush();
         }
 
+        {
+            DEBUG_PROFILE_ID(profiler, streaming, "Streaming uploads");
+            _streamingUploader->flush();
+        }
+
         auto& render = _application->getRender();
         // Check recreation
         {
@@ -829,6 +836,8 @@ namespace neon::vulkan
     VKApplication::~VKApplication()
     {
         _imageAvailableSemaphore = nullptr;
+        _streamingUploader = nullptr;
+        _stagingAllocator = nullptr;
 
         _bin.waitAndFlush();
 
@@ -913,6 +922,16 @@ namespace neon::vulkan
         return &_bin;
     }
 
+    StagingAllocator* VKApplication::getStagingAllocator()
+    {
+        return _stagingAllocator.get();
+    }
+
+    StreamingUploader* VKApplication::getStreamingUploader()
+    {
+        return _streamingUploader.get();
+    }
+
     VkDescriptorPool VKApplication::getImGuiPool() const
     {
         return _imGuiPool;
@@ -21,6 +21,8 @@
 #include <vulkan/AbstractVKApplication.h>
 #include <vulkan/device/VKDevice.h>
 #include <vulkan/VKApplicationCreateInfo.h>
+#include <vulkan/render/buffer/StagingAllocator.h>
+#include <vulkan/render/buffer/StreamingUploader.h>
 
 namespace neon
 {
@@ -66,6 +68,8 @@ namespace neon::vulkan
         std::unique_ptr<CommandManager> _commandManager;
         CommandPoolHolder _commandPool;
         VKResourceBin _bin;
+        std::unique_ptr<StagingAllocator> _stagingAllocator;
+        std::unique_ptr<StreamingUploader> _streamingUploader;
 
         CommandBuffer* _currentCommandBuffer;
         bool _recording;
@@ -201,6 +205,10 @@ namespace neon::vulkan
 
         [[nodiscard]] VKResourceBin* getBin() override;
 
+        [[nodiscard]] StagingAllocator* getStagingAllocator() override;
+
+        [[nodiscard]] StreamingUploader* getStreamingUploader() override;
+
         [[nodiscard]] VkDescriptorPool getImGuiPool() const override;
 
         [[nodiscard]] bool isRecordingCommandBuffer() const override;
@@ -0,0 +1,196 @@
+#include "VKBindStateTracker.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+namespace neon::vulkan
+{
+    bool VKBindStateTracker::count(VKBindType type, bool redundant)
+    {
+        auto index = static_cast<size_t>(type);
+        if (redundant) {
+            ++_elided[index];
+        } else {
+            ++_issued[index];
+        }
+        return !redundant;
+    }
+
+    VKBindStateTracker::VKBindStateTracker() :
+        _pipeline(VK_NULL_HANDLE),
+        _indexBuffer(VK_NULL_HANDLE),
+        _indexOffset(0),
+        _indexType(VK_INDEX_TYPE_UINT32),
+        _pushConstantLayout(VK_NULL_HANDLE),
+        _pushConstantStages(0),
+        _descriptorLayout(VK_NULL_HANDLE),
+        _descriptorSets(),
+        _issued(),
+        _elided()
+    {
+    }
+
+    void VKBindStateTracker::invalidate()
+    {
+        _pipeline = VK_NULL_HANDLE;
+        _vertexBuffers.clear();
+        _vertexOffsets.clear();
+        _indexBuffer = VK_NULL_HANDLE;
+        _pushConstantLayout = VK_NULL_HANDLE;
+        _pushConstants.clear();
+        _descriptorLayout = VK_NULL_HANDLE;
+        _descriptorSets.fill(VK_NULL_HANDLE);
+    }
+
+    bool VKBindStateTracker::trackPipeline(VkPipeline pipeline)
+    {
+        if (!count(VKBindType::PIPELINE, pipeline == _pipeline)) {
+            return false;
+        }
+        _pipeline = pipeline;
+        return true;
+    }
+
+    bool VKBindStateTracker::trackVertexBuffers(uint32_t amount, const VkBuffer* buffers, const VkDeviceSize* offsets)
+    {
+        // Bindings after the given amount are not used by the draw. They may keep any value.
+        bool redundant = _vertexBuffers.size() >= amount &&
+                         std::equal(buffers, buffers + amount, _vertexBuffers.begin()) &&
+                         std::equal(offsets, offsets + amount, _vertexOffsets.begin());
+        if (!count(VKBindType::VERTEX_BUFFERS, redundant)) {
+            return false;
+        }
+
+        if (_vertexBuffers.size() < amount) {
+            _vertexBuffers.resize(amount);
+            _vertexOffsets.resize(amount);
+        }
+        std::copy_n(buffers, amount, _vertexBuffers.begin());
+        std::copy_n(offsets, amount, _vertexOffsets.begin());
+        return true;
+    }
+
+    bool VKBindStateTracker::trackIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType type)
+    {
+        bool redundant = buffer == _indexBuffer && offset == _indexOffset && type == _indexType;
+        if (!count(VKBindType::INDEX_BUFFER, redundant)) {
+            return false;
+        }
+
+        _indexBuffer = buffer;
+        _indexOffset = offset;
+        _indexType = type;
+        return true;
+    }
+
+    bool VKBindStateTracker::trackPushConstants(VkPipelineLayout layout, VkShaderStageFlags stages, const void* data,
+                                                uint32_t size)
+    {
+        bool redundant = layout == _pushConstantLayout && stages == _pushConstantStages &&
+                         size == _pushConstants.size() && memcmp(data, _pushConstants.data(), size) == 0;
+        if (!count(VKBindType::PUSH_CONSTANTS, redundant)) {
+            return false;
+        }
+
+        _pushConstantLayout = layout;
+        _pushConstantStages = stages;
+        _pushConstants.assign(static_cast<const char*>(data), static_cast<const char*>(data) + size);
+        return true;
+    }
+
+    bool VKBindStateTracker::trackDescriptorSet(VkPipelineLayout layout, uint32_t set, VkDescriptorSet descriptorSet)
+    {
+        if (layout != _descriptorLayout) {
+            _descriptorLayout = layout;
+            _descriptorSets.fill(VK_NULL_HANDLE);
+        }
+
+        bool tracked = set < MAX_DESCRIPTOR_SETS;
+        bool redundant = tracked && _descriptorSets[set] == descriptorSet;
+        if (!count(VKBindType::DESCRIPTOR_SET, redundant)) {
+            return false;
+        }
+
+        if (tracked) {
+            _descriptorSets[set] = descriptorSet;
+        }
+        return true;
+    }
+
+    bool VKBindStateTracker::bindPipeline(VkCommandBuffer commandBuffer, VkPipeline pipeline)
+    {
+        if (!trackPipeline(pipeline)) {
+            return false;
+        }
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+        return true;
+    }
+
+    bool VKBindStateTracker::bindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t amount, const VkBuffer* buffers,
+                                               const VkDeviceSize* offsets)
+    {
+        if (!trackVertexBuffers(amount, buffers, offsets)) {
+            return false;
+        }
+        vkCmdBindVertexBuffers(commandBuffer, 0, amount, buffers, offsets);
+        return true;
+    }
+
+    bool VKBindStateTracker::bindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                             VkIndexType type)
+    {
+        if (!trackIndexBuffer(buffer, offset, type)) {
+            return false;
+        }
+        vkCmdBindIndexBuffer(commandBuffer, buffer, offset, type);
+        return true;
+    }
+
+    bool VKBindStateTracker::pushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout,
+                                           VkShaderStageFlags stages, const void* data, uint32_t size)
+    {
+        if (!trackPushConstants(layout, stages, data, size)) {
+            return false;
+        }
+        vkCmdPushConstants(commandBuffer, layout, stages, 0, size, data);
+        return true;
+    }
+
+    bool VKBindStateTracker::bindDescriptorSet(VkCommandBuffer commandBuffer, VkPipelineLayout layout, uint32_t set,
+                                               VkDescriptorSet descriptorSet)
+    {
+        if (!trackDescriptorSet(layout, set, descriptorSet)) {
+            return false;
+        }
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, set, 1, &descriptorSet, 0,
+                                nullptr);
+        return true;
+    }
+
+    uint64_t VKBindStateTracker::getIssuedBinds(VKBindType type) const
+    {
+        return _issued[static_cast<size_t>(type)];
+    }
+
+    uint64_t VKBindStateTracker::getElidedBinds(VKBindType type) const
+    {
+        return _elided[static_cast<size_t>(type)];
+    }
+
+    uint64_t VKBindStateTracker::getIssuedBinds() const
+    {
+        return std::accumulate(_issued.begin(), _issued.end(), uint64_t(0));
+    }
+
+    uint64_t VKBindStateTracker::getElidedBinds() const
+    {
+        return std::accumulate(_elided.begin(), _elided.end(), uint64_t(0));
+    }
+
+    void VKBindStateTracker::resetStatistics()
+    {
+        _issued.fill(0);
+        _elided.fill(0);
+    }
+} // namespace neon::vulkan
@@ -0,0 +1,168 @@
+#ifndef NEON_VKBINDSTATETRACKER_H
+#define NEON_VKBINDSTATETRACKER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+namespace neon::vulkan
+{
+    enum class VKBindType
+    {
+        PIPELINE,
+        VERTEX_BUFFERS,
+        INDEX_BUFFER,
+        PUSH_CONSTANTS,
+        DESCRIPTOR_SET
+    };
+
+    /**
+     * Tracks the state bound to a command buffer while it is being recorded.
+     * <p>
+     * Binds that repeat the current state are not recorded.
+     * When draws are sorted by material, consecutive draws share
+     * most of their state and most binds are elided.
+     * <p>
+     * The state is invalidated when the command buffer begins.
+     * Code recording bind commands without using this tracker
+     * must invalidate it using invalidate().
+     */
+    class VKBindStateTracker
+    {
+        static constexpr size_t BIND_TYPES = 5;
+        static constexpr size_t MAX_DESCRIPTOR_SETS = 8;
+
+        VkPipeline _pipeline;
+
+        std::vector<VkBuffer> _vertexBuffers;
+        std::vector<VkDeviceSize> _vertexOffsets;
+
+        VkBuffer _indexBuffer;
+        VkDeviceSize _indexOffset;
+        VkIndexType _indexType;
+
+        VkPipelineLayout _pushConstantLayout;
+        VkShaderStageFlags _pushConstantStages;
+        std::vector<char> _pushConstants;
+
+        VkPipelineLayout _descriptorLayout;
+        std::array<VkDescriptorSet, MAX_DESCRIPTOR_SETS> _descriptorSets;
+
+        std::array<uint64_t, BIND_TYPES> _issued;
+        std::array<uint64_t, BIND_TYPES> _elided;
+
+        bool count(VKBindType type, bool redundant);
+
+      public:
+        VKBindStateTracker();
+
+        /**
+         * Forgets the tracked state. The next binds will be recorded.
+         */
+        void invalidate();
+
+        /**
+         * Registers a bind of the given graphics pipeline without recording it.
+         *
+         * @return whether the bind changes the tracked state and must be recorded.
+         */
+        bool trackPipeline(VkPipeline pipeline);
+
+        /**
+         * Registers a bind of the given vertex buffers, starting at binding 0, without recording it.
+         *
+         * @return whether the bind changes the tracked state and must be recorded.
+         */
+        bool trackVertexBuffers(uint32_t amount, const VkBuffer* buffers, const VkDeviceSize* offsets);
+
+        /**
+         * Registers a bind of the given index buffer without recording it.
+         *
+         * @return whether the bind changes the tracked state and must be recorded.
+         */
+        bool trackIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType type);
+
+        /**
+         * Registers a push of the given constants, starting at offset 0, without recording it.
+         *
+         * @return whether the push changes the tracked state and must be recorded.
+         */
+        bool trackPushConstants(VkPipelineLayout layout, VkShaderStageFlags stages, const void* data, uint32_t size);
+
+        /**
+         * Registers a bind of the given graphics descriptor set without recording it.
+         *
+         * @return whether the bind changes the tracked state and must be recorded.
+         */
+        bool trackDescriptorSet(VkPipelineLayout layout, uint32_t set, VkDescriptorSet descriptorSet);
+
+        /**
+         * Binds the given graphics pipeline.
+         *
+         * @return whether the bind was recorded.
+         */
+        bool bindPipeline(VkCommandBuffer commandBuffer, VkPipeline pipeline);
+
+        /**
+         * Binds the given vertex buffers, starting at binding 0.
+         *
+         * @return whether the bind was recorded.
+         */
+        bool bindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t amount, const VkBuffer* buffers,
+                               const VkDeviceSize* offsets);
+
+        /**
+         * Binds the given index buffer.
+         *
+         * @return whether the bind was recorded.
+         */
+        bool bindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType type);
+
+        /**
+         * Pushes the given constants, starting at offset 0.
+         * The push is elided if the same data was pushed using the same layout and stages.
+         *
+         * @return whether the push was recorded.
+         */
+        bool pushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stages,
+                           const void* data, uint32_t size);
+
+        /**
+         * Binds the given graphics descriptor set.
+         * <p>
+         * Sets bound using a different layout are considered disturbed,
+         * even if the layouts are compatible.
+         *
+         * @return whether the bind was recorded.
+         */
+        bool bindDescriptorSet(VkCommandBuffer commandBuffer, VkPipelineLayout layout, uint32_t set,
+                               VkDescriptorSet descriptorSet);
+
+        /**
+         * @return the amount of binds of the given type recorded since the last statistics reset.
+         */
+        [[nodiscard]] uint64_t getIssuedBinds(VKBindType type) const;
+
+        /**
+         * @return the amount of binds of the given type elided since the last statistics reset.
+         */
+        [[nodiscard]] uint64_t getElidedBinds(VKBindType type) const;
+
+        /**
+         * @return the amount of binds recorded since the last statistics reset.
+         */
+        [[nodiscard]] uint64_t getIssuedBinds() const;
+
+        /**
+         * @return the amount of binds elided since the last statistics reset.
+         */
+        [[nodiscard]] uint64_t getElidedBinds() const;
+
+        void resetStatistics();
+    };
+} // namespace neon::vulkan
+
+#endif // NEON_VKBINDSTATETRACKER_H
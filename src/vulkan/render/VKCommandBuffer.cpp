@@ -26,6 +26,7 @@ namespace neon::vulkan
         _status(move._status),
         _fences(std::move(move._fences)),
         _freedFences(std::move(move._freedFences)),
+        _bindState(std::move(move._bindState)),
         _external(move._external)
     {
         move._pool = VK_NULL_HANDLE;
@@ -117,6 +118,16 @@ namespace neon::vulkan
         return _currentRun;
     }
 
+    VKBindStateTracker& VKCommandBuffer::getBindState()
+    {
+        return _bindState;
+    }
+
+    const VKBindStateTracker& VKCommandBuffer::getBindState() const
+    {
+        return _bindState;
+    }
+
     bool VKCommandBuffer::begin(bool onlyOneSubmit)
     {
         refreshStatus();
@@ -138,6 +149,7 @@ namespace neon::vulkan
             return false;
         }
         _status = VKCommandBufferStatus::RECORDING;
+        _bindState.invalidate();
         _currentRun = std::make_shared<VKCommandBufferRun>(this);
         return true;
     }
@@ -342,6 +354,7 @@ namespace neon::vulkan
         _status = move._status;
         _fences = std::move(move._fences);
         _freedFences = std::move(move._freedFences);
+        _bindState = std::move(move._bindState);
         move._pool = VK_NULL_HANDLE;
         move._commandBuffer = VK_NULL_HANDLE;
         return *this;
@@ -5,6 +5,7 @@
 #ifndef NEON_VKCOMMANDBUFFER_H
 #define NEON_VKCOMMANDBUFFER_H
 
+#include "VKBindStateTracker.h"
 #include "VKCommandBufferRun.h"
 
 #include <vector>
@@ -44,6 +45,8 @@ namespace neon::vulkan
 
         std::shared_ptr<VKCommandBufferRun> _currentRun;
 
+        VKBindStateTracker _bindState;
+
         bool _external;
 
         void refreshStatus();
@@ -73,6 +76,17 @@ namespace neon::vulkan
 
         [[nodiscard]] std::shared_ptr<CommandBufferRun> getCurrentRun() const;
 
+        /**
+         * Returns the tracker of the state bound to this command buffer.
+         * Draw commands should bind their state using this tracker,
+         * skipping the binds that repeat the current state.
+         * <p>
+         * The state is invalidated every time this command buffer begins.
+         */
+        [[nodiscard]] VKBindStateTracker& getBindState();
+
+        [[nodiscard]] const VKBindStateTracker& getBindState() const;
+
         void waitForFences();
 
         bool begin(bool onlyOneSubmit = false);
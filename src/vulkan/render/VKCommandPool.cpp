@@ -11,6 +11,18 @@
 
 namespace neon::vulkan
 {
+    void VKCommandPool::create()
+    {
+        VkCommandPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        poolInfo.queueFamilyIndex = _queueFamilyIndex;
+
+        if (vkCreateCommandPool(_vkApplication->getDevice()->hold(), &poolInfo, nullptr, &_raw) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create command pool!");
+        }
+    }
+
     VKCommandPool::VKCommandPool(VKCommandPool&& move) noexcept :
         _application(move._application),
         _vkApplication(move._vkApplication),
@@ -40,15 +52,17 @@ namespace neon::vulkan
             throw std::runtime_error(ss.str());
         }
         _queueFamilyIndex = optional.value()->getIndex();
+        create();
+    }
 
-        VkCommandPoolCreateInfo poolInfo{};
-        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-        poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-        poolInfo.queueFamilyIndex = _queueFamilyIndex;
-
-        if (vkCreateCommandPool(_vkApplication->getDevice()->hold(), &poolInfo, nullptr, &_raw) != VK_SUCCESS) {
-            throw std::runtime_error("Failed to create command pool!");
-        }
+    VKCommandPool::VKCommandPool(Application* application, uint32_t queueFamilyIndex) :
+        _application(application),
+        _vkApplication(dynamic_cast<AbstractVKApplication*>(application->getImplementation())),
+        _raw(),
+        _queueFamilyIndex(queueFamilyIndex),
+        _external(false)
+    {
+        create();
     }
 
     VKCommandPool::VKCommandPool(Application* application, VkCommandPool external, uint32_t externalQueueFamilyIndex) :
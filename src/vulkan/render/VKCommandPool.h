@@ -29,6 +29,8 @@ namespace neon::vulkan
 
         bool _external;
 
+        void create();
+
       public:
         VKCommandPool(const VKCommandPool& other) = delete;
 
@@ -37,6 +39,12 @@ namespace neon::vulkan
         explicit VKCommandPool(Application* application,
                                VKQueueFamily::Capabilities capabilities = VKQueueFamily::Capabilities::withGraphics());
 
+        /**
+         * Creates a command pool whose command buffers are submitted
+         * to queues of the given family.
+         */
+        VKCommandPool(Application* application, uint32_t queueFamilyIndex);
+
         explicit VKCommandPool(Application* application, VkCommandPool external, uint32_t externalQueueFamilyIndex);
 
         ~VKCommandPool();
@@ -41,13 +41,17 @@ namespace neon::vulkan
 
     void VKRender::endRenderPass() const
     {
-        auto cb = _vkApplication->getCurrentCommandBuffer()->getImplementation().getCommandBuffer();
+        auto& commandBuffer = _vkApplication->getCurrentCommandBuffer()->getImplementation();
+        auto cb = commandBuffer.getCommandBuffer();
 
         if (_drawImGui) {
             ImGui::Render();
             ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), cb);
             _drawImGui = false;
 
+            // ImGui binds its own state without using the tracker.
+            commandBuffer.getBindState().invalidate();
+
             if (ImGui::GetIO().ConfigFlags & ImGuiConfigFlags_ViewportsEnable) {
                 ImGui::UpdatePlatformWindows();
                 ImGui::RenderPlatformWindowsDefault();
@@ -0,0 +1,65 @@
+#include "MappedRingBuffer.h"
+
+#include <vulkan/AbstractVKApplication.h>
+
+namespace neon::vulkan
+{
+    std::optional<std::shared_ptr<BufferMap<char>>> MappedRingBuffer::rawMap(const CommandBuffer* commandBuffer)
+    {
+        return _buffers[_application->getCurrentFrame()]->map<char>(commandBuffer);
+    }
+
+    std::optional<std::shared_ptr<BufferMap<char>>> MappedRingBuffer::rawMap(Range<uint32_t> range,
+                                                                             const CommandBuffer* commandBuffer)
+    {
+        return _buffers[_application->getCurrentFrame()]->map<char>(range, commandBuffer);
+    }
+
+    MappedRingBuffer::MappedRingBuffer(AbstractVKApplication* application, VkBufferUsageFlags usage,
+                                       uint32_t sizeInBytes) :
+        _application(application),
+        _size(sizeInBytes)
+    {
+        _buffers.reserve(_application->getMaxFramesInFlight());
+        _maps.reserve(_application->getMaxFramesInFlight());
+        for (uint32_t i = 0; i < _application->getMaxFramesInFlight(); ++i) {
+            auto& buffer = _buffers.emplace_back(std::make_unique<SimpleBuffer>(
+                _application, usage, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                sizeInBytes));
+            _maps.push_back(buffer->map<char>().value());
+        }
+    }
+
+    MappedRingBuffer::~MappedRingBuffer()
+    {
+        // Unmap the memory before the buffers are sent to the bin.
+        for (auto& map : _maps) {
+            map->dispose();
+        }
+    }
+
+    size_t MappedRingBuffer::size() const
+    {
+        return _size;
+    }
+
+    bool MappedRingBuffer::canBeWrittenOn() const
+    {
+        return true;
+    }
+
+    VkBuffer MappedRingBuffer::getRaw(std::shared_ptr<CommandBufferRun> run)
+    {
+        return _buffers[_application->getCurrentFrame()]->getRaw(std::move(run));
+    }
+
+    uint32_t MappedRingBuffer::getFrameAmount() const
+    {
+        return static_cast<uint32_t>(_buffers.size());
+    }
+
+    char* MappedRingBuffer::getFrameData(uint32_t frame) const
+    {
+        return _maps[frame]->raw();
+    }
+} // namespace neon::vulkan
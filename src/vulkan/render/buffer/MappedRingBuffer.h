@@ -0,0 +1,66 @@
+#ifndef NEON_MAPPEDRINGBUFFER_H
+#define NEON_MAPPEDRINGBUFFER_H
+
+#include <memory>
+#include <vector>
+
+#include <vulkan/render/buffer/Buffer.h>
+#include <vulkan/render/buffer/SimpleBuffer.h>
+
+namespace neon::vulkan
+{
+    class AbstractVKApplication;
+
+    /**
+     * Buffer composed of one host-visible buffer per frame in flight.
+     * <p>
+     * All buffers are mapped persistently: their memory can be written
+     * directly without mapping them or recording transfer commands.
+     * The GPU reads the buffer of the current frame, so the buffers
+     * of the other frames can be written while they are being rendered.
+     */
+    class MappedRingBuffer : public Buffer
+    {
+        AbstractVKApplication* _application;
+        std::vector<std::unique_ptr<SimpleBuffer>> _buffers;
+        std::vector<std::shared_ptr<BufferMap<char>>> _maps;
+        size_t _size;
+
+        std::optional<std::shared_ptr<BufferMap<char>>> rawMap(const CommandBuffer* commandBuffer = nullptr) override;
+
+        std::optional<std::shared_ptr<BufferMap<char>>> rawMap(Range<uint32_t> range,
+                                                               const CommandBuffer* commandBuffer = nullptr) override;
+
+      public:
+        MappedRingBuffer(const MappedRingBuffer& other) = delete;
+
+        MappedRingBuffer(AbstractVKApplication* application, VkBufferUsageFlags usage, uint32_t sizeInBytes);
+
+        ~MappedRingBuffer() override;
+
+        [[nodiscard]] size_t size() const override;
+
+        [[nodiscard]] bool canBeWrittenOn() const override;
+
+        /**
+         * @return the buffer of the current frame.
+         */
+        VkBuffer getRaw(std::shared_ptr<CommandBufferRun> run) override;
+
+        /**
+         * @return the amount of buffers inside the ring.
+         */
+        [[nodiscard]] uint32_t getFrameAmount() const;
+
+        /**
+         * Returns the mapped memory of the buffer of the given frame.
+         * The pointer is valid while this buffer exists.
+         *
+         * @param frame the frame, in the range [0, getFrameAmount()).
+         * @return the mapped memory.
+         */
+        [[nodiscard]] char* getFrameData(uint32_t frame) const;
+    };
+} // namespace neon::vulkan
+
+#endif // NEON_MAPPEDRINGBUFFER_H
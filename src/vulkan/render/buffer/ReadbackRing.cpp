@@ -0,0 +1,37 @@
+#include "ReadbackRing.h"
+
+#include <vulkan/AbstractVKApplication.h>
+
+namespace neon::vulkan
+{
+    std::shared_ptr<SimpleBuffer> ReadbackRing::createBuffer(AbstractVKApplication* application, size_t size)
+    {
+        // Cached memory makes reading from the host fast, but not every device has it.
+        // Any host-visible memory is accepted: non-coherent memory is invalidated before being read.
+        VmaAllocationCreateInfo allocationInfo{};
+        allocationInfo.usage = VMA_MEMORY_USAGE_AUTO;
+        allocationInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT;
+        allocationInfo.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+        allocationInfo.preferredFlags = VK_MEMORY_PROPERTY_HOST_CACHED_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+        return std::make_shared<SimpleBuffer>(application, VK_BUFFER_USAGE_TRANSFER_DST_BIT, allocationInfo,
+                                              static_cast<uint32_t>(size));
+    }
+
+    ReadbackRing::ReadbackRing(AbstractVKApplication* application, uint32_t maxBuffers) :
+        _buffers([application](size_t size) { return createBuffer(application, size); }, maxBuffers)
+    {
+    }
+
+    std::shared_ptr<SimpleBuffer> ReadbackRing::acquire(size_t size)
+    {
+        std::lock_guard lock(_mutex);
+        return _buffers.acquire(size);
+    }
+
+    size_t ReadbackRing::getAllocatedMemory() const
+    {
+        std::lock_guard lock(_mutex);
+        return _buffers.getAllocatedMemory();
+    }
+} // namespace neon::vulkan
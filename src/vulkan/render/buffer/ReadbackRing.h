@@ -0,0 +1,57 @@
+#ifndef NEON_READBACKRING_H
+#define NEON_READBACKRING_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include <neon/util/BufferRing.h>
+#include <vulkan/render/buffer/SimpleBuffer.h>
+
+namespace neon::vulkan
+{
+    class AbstractVKApplication;
+
+    /**
+     * Pool of host-visible buffers used to read data back from the GPU.
+     * <p>
+     * See BufferRing for the reuse policy.
+     * <p>
+     * This class is thread-safe.
+     */
+    class ReadbackRing
+    {
+        BufferRing<SimpleBuffer> _buffers;
+        mutable std::mutex _mutex;
+
+        [[nodiscard]] static std::shared_ptr<SimpleBuffer> createBuffer(AbstractVKApplication* application,
+                                                                        size_t size);
+
+      public:
+        ReadbackRing(const ReadbackRing& other) = delete;
+
+        /**
+         * Creates the ring. No memory is allocated until the first readback.
+         *
+         * @param application the application.
+         * @param maxBuffers the maximum amount of pooled buffers.
+         */
+        ReadbackRing(AbstractVKApplication* application, uint32_t maxBuffers);
+
+        /**
+         * Returns a buffer able to hold the given amount of bytes.
+         * The buffer is returned to the ring when the returned reference is destroyed.
+         *
+         * @param size the size in bytes.
+         * @return the buffer.
+         */
+        [[nodiscard]] std::shared_ptr<SimpleBuffer> acquire(size_t size);
+
+        /**
+         * @return the host-visible memory pooled by this ring, in bytes.
+         */
+        [[nodiscard]] size_t getAllocatedMemory() const;
+    };
+} // namespace neon::vulkan
+
+#endif // NEON_READBACKRING_H
@@ -57,6 +57,29 @@ namespace neon::vulkan
         }
     }
 
+    SimpleBuffer::SimpleBuffer(AbstractVKApplication* application, VkBufferUsageFlags usage,
+                               const VmaAllocationCreateInfo& allocationInfo, uint32_t sizeInBytes) :
+        VKResource(application),
+        Buffer(),
+        _size(sizeInBytes),
+        _buffer(VK_NULL_HANDLE),
+        _allocator(application->getDevice()->getAllocator()),
+        _allocation(VK_NULL_HANDLE),
+        _modifiable(false)
+    {
+        VkBufferCreateInfo bufferInfo{};
+        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferInfo.size = _size;
+        bufferInfo.usage = usage;
+        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        vmaCreateBuffer(_allocator, &bufferInfo, &allocationInfo, &_buffer, &_allocation, nullptr);
+
+        VkMemoryPropertyFlags properties = 0;
+        vmaGetAllocationMemoryProperties(_allocator, _allocation, &properties);
+        _modifiable = properties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+    }
+
     SimpleBuffer::~SimpleBuffer()
     {
         auto bin = getApplication()->getBin();
@@ -65,6 +88,11 @@ namespace neon::vulkan
         });
     }
 
+    void SimpleBuffer::invalidate() const
+    {
+        vmaInvalidateAllocation(_allocator, _allocation, 0, VK_WHOLE_SIZE);
+    }
+
     size_t SimpleBuffer::size() const
     {
         return _size;
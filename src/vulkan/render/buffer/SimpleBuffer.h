@@ -140,8 +140,27 @@ namespace neon::vulkan
         SimpleBuffer(AbstractVKApplication* application, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties,
                      const void* data, uint32_t sizeInBytes);
 
+        /**
+         * Creates a buffer using the given allocation parameters.
+         * The buffer can be written on if the chosen memory type is host-visible.
+         *
+         * @param application the application.
+         * @param usage the usage of the buffer.
+         * @param allocationInfo the allocation parameters.
+         * @param sizeInBytes the size of the buffer.
+         */
+        SimpleBuffer(AbstractVKApplication* application, VkBufferUsageFlags usage,
+                     const VmaAllocationCreateInfo& allocationInfo, uint32_t sizeInBytes);
+
         ~SimpleBuffer() override;
 
+        /**
+         * Makes the writes performed by the device visible to the host.
+         * This must be called before reading the buffer from the host
+         * if its memory is not host-coherent. It does nothing otherwise.
+         */
+        void invalidate() const;
+
         [[nodiscard]] size_t size() const override;
 
         [[nodiscard]] bool canBeWrittenOn() const override;
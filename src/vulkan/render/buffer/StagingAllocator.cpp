@@ -0,0 +1,54 @@
+#include "StagingAllocator.h"
+
+#include <vulkan/AbstractVKApplication.h>
+
+namespace neon::vulkan
+{
+    StagingAllocator::PageMemory::PageMemory(AbstractVKApplication* application, uint32_t size) :
+        buffer(std::make_unique<SimpleBuffer>(application, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                                  VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                              size)),
+        map(buffer->map<char>().value())
+    {
+    }
+
+    StagingAllocator::PageMemory::~PageMemory()
+    {
+        map->dispose();
+    }
+
+    char* StagingAllocator::PageMemory::data() const
+    {
+        return map->raw();
+    }
+
+    size_t StagingAllocator::PageMemory::size() const
+    {
+        return buffer->size();
+    }
+
+    StagingAllocator::StagingAllocator(AbstractVKApplication* application, uint32_t pageSize, uint32_t maxFreePages) :
+        _pages([application](uint32_t size) { return std::make_unique<PageMemory>(application, size); }, pageSize,
+               maxFreePages)
+    {
+    }
+
+    StagingAllocator::Allocation StagingAllocator::allocate(uint32_t size)
+    {
+        std::lock_guard lock(_mutex);
+        return {_pages.allocate(size)};
+    }
+
+    void StagingAllocator::release(const Allocation& allocation, std::shared_ptr<CommandBufferRun> run)
+    {
+        std::lock_guard lock(_mutex);
+        _pages.release(allocation, std::move(run));
+    }
+
+    size_t StagingAllocator::getAllocatedMemory() const
+    {
+        std::lock_guard lock(_mutex);
+        return _pages.getAllocatedMemory();
+    }
+} // namespace neon::vulkan
@@ -0,0 +1,110 @@
+#ifndef NEON_STAGINGALLOCATOR_H
+#define NEON_STAGINGALLOCATOR_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include <neon/render/buffer/CommandBufferRun.h>
+#include <neon/util/LinearPageAllocator.h>
+#include <vulkan/render/buffer/SimpleBuffer.h>
+
+namespace neon::vulkan
+{
+    class AbstractVKApplication;
+
+    /**
+     * Linear allocator of host-visible memory used to upload data to device-local buffers.
+     * <p>
+     * Memory is sub-allocated from persistently mapped pages.
+     * When the current page is full, it is retired and a new page is used.
+     * Retired pages are recycled once all command buffer runs that read them
+     * have finished, so the memory used by this allocator scales
+     * with the amount of data uploaded per frame instead of the size of the
+     * uploaded buffers.
+     * <p>
+     * This class is thread-safe.
+     */
+    class StagingAllocator
+    {
+      public:
+        static constexpr uint32_t DEFAULT_PAGE_SIZE = 4 * 1024 * 1024;
+        static constexpr uint32_t ALIGNMENT = 16;
+
+      private:
+        struct PageMemory
+        {
+            std::unique_ptr<SimpleBuffer> buffer;
+            std::shared_ptr<BufferMap<char>> map;
+
+            PageMemory(AbstractVKApplication* application, uint32_t size);
+
+            // The buffer is sent to the resource bin: the GPU may still be using it.
+            ~PageMemory();
+
+            [[nodiscard]] char* data() const;
+
+            [[nodiscard]] size_t size() const;
+        };
+
+        using Pages = LinearPageAllocator<PageMemory>;
+        static_assert(ALIGNMENT == Pages::ALIGNMENT);
+
+      public:
+        /**
+         * A region of staging memory.
+         * The memory must be released using release() once
+         * the copy command reading it has been recorded.
+         */
+        struct Allocation : Pages::Allocation
+        {
+            /**
+             * @return the buffer containing the region.
+             */
+            [[nodiscard]] SimpleBuffer* getBuffer() const
+            {
+                return page->memory->buffer.get();
+            }
+        };
+
+      private:
+        Pages _pages;
+        mutable std::mutex _mutex;
+
+      public:
+        StagingAllocator(const StagingAllocator& other) = delete;
+
+        /**
+         * Creates the allocator. No memory is allocated until the first allocation.
+         *
+         * @param application the application.
+         * @param pageSize the size of the pages. Bigger allocations use a dedicated page.
+         * @param maxFreePages the amount of recycled pages kept for future allocations.
+         */
+        explicit StagingAllocator(AbstractVKApplication* application, uint32_t pageSize = DEFAULT_PAGE_SIZE,
+                                  uint32_t maxFreePages = 4);
+
+        /**
+         * Allocates a region of staging memory.
+         * @param size the size of the region in bytes.
+         * @return the region.
+         */
+        [[nodiscard]] Allocation allocate(uint32_t size);
+
+        /**
+         * Releases the given region. The region's memory may be reused
+         * once the given run has finished.
+         *
+         * @param allocation the region.
+         * @param run the run of the command buffer reading the region. It may be null.
+         */
+        void release(const Allocation& allocation, std::shared_ptr<CommandBufferRun> run);
+
+        /**
+         * @return the host-visible memory allocated by this allocator, in bytes.
+         */
+        [[nodiscard]] size_t getAllocatedMemory() const;
+    };
+} // namespace neon::vulkan
+
+#endif // NEON_STAGINGALLOCATOR_H
@@ -23,17 +23,14 @@ namespace neon::vulkan
 
     std::optional<std::shared_ptr<BufferMap<char>>> StagingBuffer::rawMap(const CommandBuffer* commandBuffer)
     {
-        auto& buffer = _stagingBuffers[_application->getCurrentFrame()];
-        return std::make_shared<StagingBufferMap<char>>(_application->getApplication(), commandBuffer, buffer,
-                                                        _deviceBuffer);
+        return rawMap(Range<uint32_t>(0, static_cast<uint32_t>(_deviceBuffer.size())), commandBuffer);
     }
 
     std::optional<std::shared_ptr<BufferMap<char>>> StagingBuffer::rawMap(Range<uint32_t> range,
                                                                           const CommandBuffer* commandBuffer)
     {
-        auto& buffer = _stagingBuffers[_application->getCurrentFrame()];
-        return std::make_shared<StagingBufferMap<char>>(_application->getApplication(), commandBuffer, buffer,
-                                                        _deviceBuffer, range);
+        return std::make_shared<StagingBufferMap<char>>(_application->getApplication(), commandBuffer,
+                                                        _application->getStagingAllocator(), _deviceBuffer, range);
     }
 
     StagingBuffer::StagingBuffer(AbstractVKApplication* application, VkBufferUsageFlags usage, uint32_t sizeInBytes) :
@@ -41,12 +38,6 @@ namespace neon::vulkan
         _deviceBuffer(_application, VK_BUFFER_USAGE_TRANSFER_DST_BIT | usage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
                       sizeInBytes)
     {
-        _stagingBuffers.reserve(_application->getMaxFramesInFlight());
-        for (size_t i = 0; i < _application->getMaxFramesInFlight(); ++i) {
-            _stagingBuffers.push_back(std::make_shared<SimpleBuffer>(
-                _application, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, sizeInBytes));
-        }
     }
 
     SimpleBuffer& StagingBuffer::getDeviceBuffer()
@@ -59,4 +50,68 @@ namespace neon::vulkan
         return _deviceBuffer;
     }
 
+
+    StagingAllocator::Allocation StagingBuffer::stageRanges(const void* data,
+                                                            const std::vector<Range<uint32_t>>& ranges,
+                                                            std::vector<VkBufferCopy>& regions)
+    {
+        // All regions are packed into a single staging allocation.
+        uint32_t total = 0;
+        for (auto range : ranges) {
+            total += range.size();
+        }
+        if (total == 0) {
+            return {};
+        }
+
+        auto allocation = _application->getStagingAllocator()->allocate(total);
+        regions.reserve(ranges.size());
+
+        uint32_t offset = 0;
+        for (auto range : ranges) {
+            if (range.size() == 0) {
+                continue;
+            }
+            memcpy(allocation.data + offset, static_cast<const char*>(data) + range.getFrom(), range.size());
+            regions.push_back({allocation.offset + offset, range.getFrom(), range.size()});
+            offset += range.size();
+        }
+        return allocation;
+    }
+
+    void StagingBuffer::uploadRanges(const void* data, const std::vector<Range<uint32_t>>& ranges,
+                                     const CommandBuffer* commandBuffer)
+    {
+        std::vector<VkBufferCopy> regions;
+        auto allocation = stageRanges(data, ranges, regions);
+        if (allocation.size == 0) {
+            return;
+        }
+
+        CommandPoolHolder poolHolder;
+        CommandBuffer* internal = nullptr;
+        if (commandBuffer == nullptr) {
+            poolHolder = _application->getApplication()->getCommandManager().fetchCommandPool();
+            internal = poolHolder.getPool().beginCommandBuffer(true);
+            commandBuffer = internal;
+        }
+
+        auto run = commandBuffer->getCurrentRun();
+        vulkan_util::copyBuffer(commandBuffer->getImplementation().getCommandBuffer(),
+                                allocation.getBuffer()->getRaw(run), _deviceBuffer.getRaw(run), regions);
+        _application->getStagingAllocator()->release(allocation, run);
+
+        if (internal != nullptr) {
+            internal->end();
+            internal->submit();
+        }
+    }
+
+    std::shared_ptr<Task<void>> StagingBuffer::uploadRangesAsync(const void* data,
+                                                                 const std::vector<Range<uint32_t>>& ranges)
+    {
+        std::vector<VkBufferCopy> regions;
+        auto allocation = stageRanges(data, ranges, regions);
+        return _application->getStreamingUploader()->uploadBuffer(_deviceBuffer, allocation, regions);
+    }
 } // namespace neon::vulkan
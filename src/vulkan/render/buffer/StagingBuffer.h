@@ -5,10 +5,13 @@
 #ifndef VULKANTEST_STAGINGBUFFER_H
 #define VULKANTEST_STAGINGBUFFER_H
 
+#include <cstring>
 #include <utility>
 #include <vector>
 #include "Buffer.h"
 #include "SimpleBuffer.h"
+#include "StagingAllocator.h"
+#include "StreamingUploader.h"
 
 #include <neon/render/buffer/CommandBuffer.h>
 #include <neon/logging/Logger.h>
@@ -28,11 +31,10 @@ namespace neon::vulkan
         const CommandBuffer* _externalCommandBuffer;
         CommandBuffer* _internalCommandBuffer;
 
-        std::shared_ptr<SimpleBuffer> _stagingBuffer;
+        StagingAllocator* _allocator;
+        StagingAllocator::Allocation _allocation;
         SimpleBuffer& _deviceBuffer;
-
-        std::shared_ptr<BufferMap<T>> _map;
-        std::optional<Range<uint32_t>> _range;
+        uint32_t _deviceOffset;
 
         bool _disposed = false;
 
@@ -43,40 +45,28 @@ namespace neon::vulkan
             _poolHolder(std::move(other._poolHolder)),
             _externalCommandBuffer(other._externalCommandBuffer),
             _internalCommandBuffer(other._internalCommandBuffer),
-            _stagingBuffer(std::move(other._stagingBuffer)),
+            _allocator(other._allocator),
+            _allocation(other._allocation),
             _deviceBuffer(other._deviceBuffer),
-            _map(std::move(other._map)),
-            _range(other._range),
+            _deviceOffset(other._deviceOffset),
             _disposed(other._disposed)
         {
             other._disposed = true;
         }
 
-        StagingBufferMap(Application* application, const CommandBuffer* commandBuffer,
-                         std::shared_ptr<SimpleBuffer> stagingBuffer, SimpleBuffer& deviceBuffer) :
-            BufferMap<T>(),
-            _externalCommandBuffer(commandBuffer),
-            _internalCommandBuffer(nullptr),
-            _stagingBuffer(std::move(stagingBuffer)),
-            _deviceBuffer(deviceBuffer),
-            _map(_stagingBuffer->map<T>().value())
-        {
-            if (_externalCommandBuffer == nullptr) {
-                _poolHolder = application->getCommandManager().fetchCommandPool();
-                _internalCommandBuffer = _poolHolder.getPool().beginCommandBuffer(true);
-            }
-        }
-
-        StagingBufferMap(Application* application, const CommandBuffer* commandBuffer,
-                         std::shared_ptr<SimpleBuffer> stagingBuffer, SimpleBuffer& deviceBuffer,
-                         Range<uint32_t> range) :
+        /**
+         * Maps the region of the device buffer starting at the given offset.
+         * The staging memory is allocated from the given allocator.
+         */
+        StagingBufferMap(Application* application, const CommandBuffer* commandBuffer, StagingAllocator* allocator,
+                         SimpleBuffer& deviceBuffer, Range<uint32_t> range) :
             BufferMap<T>(),
             _externalCommandBuffer(commandBuffer),
             _internalCommandBuffer(nullptr),
-            _stagingBuffer(std::move(stagingBuffer)),
+            _allocator(allocator),
+            _allocation(allocator->allocate(range.size())),
             _deviceBuffer(deviceBuffer),
-            _map(_stagingBuffer->map<T>(range).value()),
-            _range(range)
+            _deviceOffset(range.getFrom())
         {
             if (_externalCommandBuffer == nullptr) {
                 _poolHolder = application->getCommandManager().fetchCommandPool();
@@ -86,22 +76,24 @@ namespace neon::vulkan
 
         ~StagingBufferMap() override
         {
-            disposeStagingBuffer();
+            if (!_disposed) {
+                disposeStagingBuffer();
+            }
         };
 
         T& operator[](size_t index) override
         {
-            return _map->raw()[index];
+            return raw()[index];
         }
 
         T operator[](size_t index) const override
         {
-            return _map->raw()[index];
+            return reinterpret_cast<T*>(_allocation.data)[index];
         }
 
         T* raw() override
         {
-            return _map->raw();
+            return reinterpret_cast<T*>(_allocation.data);
         }
 
         void disposeStagingBuffer()
@@ -110,27 +102,19 @@ namespace neon::vulkan
                 logger.warning(MessageBuilder().group("vulkan").print("Buffer map already disposed"));
                 return;
             }
-            if (_map->raw() == nullptr) {
-                return;
-            }
-            _map->dispose();
 
             bool internal = _internalCommandBuffer != nullptr;
             auto buffer = internal ? _internalCommandBuffer : _externalCommandBuffer;
-
-            auto cmd = buffer->getImplementation().getCommandBuffer();
             auto run = buffer->getCurrentRun();
-            if (_range.has_value()) {
-                if (_range->size() > 0) {
-                    vulkan_util::copyBuffer(cmd, _stagingBuffer->getRaw(run), _deviceBuffer.getRaw(run),
-                                            _range.value().getFrom(), _range.value().getFrom(), _range.value().size());
-                }
-            } else {
-                if (_deviceBuffer.size() > 0) {
-                    vulkan_util::copyBuffer(cmd, _stagingBuffer->getRaw(run), _deviceBuffer.getRaw(run),
-                                            _deviceBuffer.size());
-                }
+
+            if (_allocation.size > 0) {
+                auto cmd = buffer->getImplementation().getCommandBuffer();
+                vulkan_util::copyBuffer(cmd, _allocation.getBuffer()->getRaw(run), _deviceBuffer.getRaw(run),
+                                        _allocation.offset, _deviceOffset, _allocation.size);
             }
+
+            _allocator->release(_allocation, run);
+
             if (internal) {
                 // Command buffer is not external.
                 // End and submit.
@@ -152,11 +136,15 @@ namespace neon::vulkan
         }
     };
 
+    /**
+     * Device-local buffer written through staging memory.
+     * <p>
+     * The staging memory is sub-allocated from the application's StagingAllocator
+     * every time the buffer is mapped, and recycled once the copy has been executed.
+     */
     class StagingBuffer : public Buffer
     {
         AbstractVKApplication* _application;
-
-        std::vector<std::shared_ptr<SimpleBuffer>> _stagingBuffers;
         SimpleBuffer _deviceBuffer;
 
         std::optional<std::shared_ptr<BufferMap<char>>> rawMap(const CommandBuffer* commandBuffer = nullptr) override;
@@ -164,24 +152,23 @@ namespace neon::vulkan
         std::optional<std::shared_ptr<BufferMap<char>>> rawMap(Range<uint32_t> range,
                                                                const CommandBuffer* commandBuffer = nullptr) override;
 
+        StagingAllocator::Allocation stageRanges(const void* data, const std::vector<Range<uint32_t>>& ranges,
+                                                 std::vector<VkBufferCopy>& regions);
+
       public:
         StagingBuffer(const StagingBuffer& other) = delete;
 
         template<class T>
         StagingBuffer(AbstractVKApplication* application, VkBufferUsageFlags usage, const std::vector<T>& data) :
             _application(application),
-            _stagingBuffers(),
             _deviceBuffer(_application, VK_BUFFER_USAGE_TRANSFER_DST_BIT | usage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-                          data)
+                          static_cast<uint32_t>(data.size() * sizeof(T)))
         {
-            for (uint32_t i = 0; i < _application->getMaxFramesInFlight(); ++i) {
-                _stagingBuffers.push_back(std::make_shared<SimpleBuffer>(
-                    _application, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, data));
+            // Transfers all data from the staging memory to the device buffer.
+            if (!data.empty()) {
+                auto map = this->map<char>().value();
+                memcpy(map->raw(), data.data(), data.size() * sizeof(T));
             }
-
-            map<T>();
-            // Transfers all data from the staging buffer to the device buffer.
         }
 
         StagingBuffer(AbstractVKApplication* application, VkBufferUsageFlags usage, uint32_t sizeInBytes);
@@ -197,6 +184,33 @@ namespace neon::vulkan
         SimpleBuffer& getDeviceBuffer();
 
         const SimpleBuffer& getDeviceBuffer() const;
+
+        /**
+         * Uploads several regions of the given data to the device buffer.
+         * <p>
+         * The staging buffer is mapped once and all regions are
+         * transferred with a single copy command.
+         *
+         * @param data the data to upload. Offsets in the data match offsets in the buffer.
+         * @param ranges the regions to upload, in bytes.
+         * @param commandBuffer the command buffer where the copy is recorded.
+         * If null, an internal command buffer is submitted.
+         */
+        void uploadRanges(const void* data, const std::vector<Range<uint32_t>>& ranges,
+                          const CommandBuffer* commandBuffer = nullptr);
+
+        /**
+         * Uploads several regions of the given data to the device buffer
+         * using the application's StreamingUploader.
+         * <p>
+         * The copies are not recorded on any frame command buffer.
+         * The buffer must not be used by the graphics queue until the returned task finishes.
+         *
+         * @param data the data to upload. Offsets in the data match offsets in the buffer.
+         * @param ranges the regions to upload, in bytes.
+         * @return the task that finishes when the buffer can be used.
+         */
+        std::shared_ptr<Task<void>> uploadRangesAsync(const void* data, const std::vector<Range<uint32_t>>& ranges);
     };
 } // namespace neon::vulkan
 
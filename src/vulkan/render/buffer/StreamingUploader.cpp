@@ -0,0 +1,410 @@
+#include "StreamingUploader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+
+#include <vulkan/AbstractVKApplication.h>
+#include <vulkan/sync/VKSemaphore.h>
+
+namespace neon::vulkan
+{
+    namespace
+    {
+        std::shared_ptr<Task<void>> finishedTask(TaskRunner* runner)
+        {
+            auto task = std::make_shared<Task<void>>(runner);
+            task->setResult(std::monostate());
+            return task;
+        }
+    } // namespace
+
+    std::optional<uint32_t> StreamingUploader::findTransferFamily(const std::vector<VKQueueFamily>& families)
+    {
+        // Prefer families that only transfer: they are usually backed by DMA engines.
+        std::optional<uint32_t> found;
+        for (const auto& family : families) {
+            const auto& capabilities = family.getCapabilities();
+            if (!capabilities.transfer || capabilities.graphics || family.getCount() == 0) {
+                continue;
+            }
+            if (!capabilities.compute) {
+                return family.getIndex();
+            }
+            if (!found.has_value()) {
+                found = family.getIndex();
+            }
+        }
+        return found;
+    }
+
+    bool StreamingUploader::usesOwnershipTransfer() const
+    {
+        return _transferFamily != _graphicsFamily;
+    }
+
+    void StreamingUploader::completeFinished()
+    {
+        std::erase_if(_submitted, [this](Batch* batch) {
+            auto& last = batch->graphics != nullptr ? batch->graphics : batch->transfer;
+            if (last->isBeingUsed()) {
+                return false;
+            }
+            batch->task->setResult(std::monostate());
+            batch->task = nullptr;
+            _free.push_back(batch);
+            return true;
+        });
+    }
+
+    StreamingUploader::Batch* StreamingUploader::fetchBatch()
+    {
+        if (_current != nullptr) {
+            return _current;
+        }
+
+        completeFinished();
+        if (_free.empty()) {
+            // All batches are in flight. Wait for the oldest one.
+            Batch* oldest = _submitted.front();
+            (oldest->graphics != nullptr ? oldest->graphics : oldest->transfer)->wait();
+            completeFinished();
+        }
+
+        _current = _free.back();
+        _free.pop_back();
+
+        _current->transfer->begin(true);
+        if (_current->graphics != nullptr) {
+            _current->release->begin(true);
+            _current->graphics->begin(true);
+        }
+        _current->task = std::make_shared<Task<void>>(&_application->getApplication()->getTaskRunner());
+        return _current;
+    }
+
+    void StreamingUploader::submit(Batch* batch)
+    {
+        VkCommandBuffer transferCmd = batch->transfer->getImplementation().getCommandBuffer();
+
+        if (!usesOwnershipTransfer()) {
+            // The barriers make the uploaded data visible to the commands submitted afterward.
+            for (auto& barrier : batch->bufferBarriers) {
+                barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            }
+            for (auto& barrier : batch->imageBarriers) {
+                barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            }
+            vkCmdPipelineBarrier(transferCmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0,
+                                 0, nullptr, static_cast<uint32_t>(batch->bufferBarriers.size()),
+                                 batch->bufferBarriers.data(), static_cast<uint32_t>(batch->imageBarriers.size()),
+                                 batch->imageBarriers.data());
+            for (auto& work : batch->graphicsWork) {
+                work(transferCmd);
+            }
+            batch->transfer->end();
+            batch->transfer->submit();
+        } else {
+            // Release on the transfer family. The destination access masks are ignored.
+            std::vector<VkBufferMemoryBarrier> bufferReleases = batch->bufferBarriers;
+            std::vector<VkImageMemoryBarrier> imageReleases = batch->imageBarriers;
+            for (auto& barrier : bufferReleases) {
+                barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                barrier.dstAccessMask = 0;
+            }
+            for (auto& barrier : imageReleases) {
+                barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                barrier.dstAccessMask = 0;
+            }
+            vkCmdPipelineBarrier(transferCmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0,
+                                 0, nullptr, static_cast<uint32_t>(bufferReleases.size()), bufferReleases.data(),
+                                 static_cast<uint32_t>(imageReleases.size()), imageReleases.data());
+
+            // Acquire on the graphics family, once the transfer has finished.
+            // The source stage matches the stage waiting for the transfer semaphore.
+            VkCommandBuffer graphicsCmd = batch->graphics->getImplementation().getCommandBuffer();
+            vkCmdPipelineBarrier(graphicsCmd, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                 0, 0, nullptr, static_cast<uint32_t>(batch->bufferBarriers.size()),
+                                 batch->bufferBarriers.data(), static_cast<uint32_t>(batch->imageBarriers.size()),
+                                 batch->imageBarriers.data());
+            for (auto& work : batch->graphicsWork) {
+                work(graphicsCmd);
+            }
+
+            // The signal of a semaphore waits for all the commands submitted before it to the same queue.
+            // Waiting for the release semaphore orders the copies after all the graphics work
+            // submitted before this batch, including the work reading the uploaded resources.
+            auto released = std::make_shared<VKSemaphore>(_application->getApplication());
+            auto transferred = std::make_shared<VKSemaphore>(_application->getApplication());
+            VkPipelineStageFlags transferWaitStages[] = {VK_PIPELINE_STAGE_TRANSFER_BIT};
+            VkPipelineStageFlags graphicsWaitStages[] = {VK_PIPELINE_STAGE_ALL_COMMANDS_BIT};
+
+            batch->release->end();
+            batch->release->getImplementation().submit(nullptr, released);
+            batch->transfer->end();
+            batch->transfer->getImplementation().submit(released, transferred, transferWaitStages);
+            batch->graphics->end();
+            batch->graphics->getImplementation().submit(transferred, nullptr, graphicsWaitStages);
+        }
+
+        batch->bufferBarriers.clear();
+        batch->imageBarriers.clear();
+        batch->graphicsWork.clear();
+        batch->uploads = 0;
+        _submitted.push_back(batch);
+    }
+
+    StreamingUploader::StreamingUploader(AbstractVKApplication* application, uint32_t batches) :
+        _application(application),
+        _current(nullptr)
+    {
+        Application* app = application->getApplication();
+        _graphicsFamily = application->getCommandPool()->getImplementation().getQueueFamilyIndex();
+        auto& families = application->getDevice()->getQueueProvider()->getFamilies().getFamilies();
+        _transferFamily = findTransferFamily(families).value_or(_graphicsFamily);
+
+        _transferPool = std::make_unique<VKCommandPool>(app, _transferFamily);
+        if (usesOwnershipTransfer()) {
+            _graphicsPool = std::make_unique<VKCommandPool>(app, _graphicsFamily);
+        }
+
+        // The command buffers fetch their queues in the thread that creates them: the main thread.
+        _batches.reserve(batches);
+        _free.reserve(batches);
+        for (uint32_t i = 0; i < std::max(batches, 1u); ++i) {
+            auto batch = std::make_unique<Batch>();
+            batch->transfer = _transferPool->newCommandBuffer(true);
+            if (_graphicsPool != nullptr) {
+                batch->release = _graphicsPool->newCommandBuffer(true);
+                batch->graphics = _graphicsPool->newCommandBuffer(true);
+            }
+            _free.push_back(batch.get());
+            _batches.push_back(std::move(batch));
+        }
+    }
+
+    StreamingUploader::~StreamingUploader()
+    {
+        std::lock_guard lock(_mutex);
+        if (_current != nullptr) {
+            submit(_current);
+            _current = nullptr;
+        }
+        for (Batch* batch : _submitted) {
+            (batch->graphics != nullptr ? batch->graphics : batch->transfer)->wait();
+        }
+        completeFinished();
+    }
+
+    bool StreamingUploader::hasDedicatedTransferQueue() const
+    {
+        return usesOwnershipTransfer();
+    }
+
+    std::shared_ptr<Task<void>> StreamingUploader::uploadBuffer(SimpleBuffer& buffer, uint32_t offset,
+                                                                const void* data, uint32_t size)
+    {
+        if (size == 0) {
+            return finishedTask(&_application->getApplication()->getTaskRunner());
+        }
+
+        auto allocation = _application->getStagingAllocator()->allocate(size);
+        memcpy(allocation.data, data, size);
+        return uploadBuffer(buffer, allocation, {{allocation.offset, offset, size}});
+    }
+
+    std::shared_ptr<Task<void>> StreamingUploader::uploadBuffer(SimpleBuffer& buffer,
+                                                                const StagingAllocator::Allocation& allocation,
+                                                                const std::vector<VkBufferCopy>& copies)
+    {
+        auto* allocator = _application->getStagingAllocator();
+        if (copies.empty()) {
+            allocator->release(allocation, nullptr);
+            return finishedTask(&_application->getApplication()->getTaskRunner());
+        }
+
+        std::lock_guard lock(_mutex);
+        Batch* batch = fetchBatch();
+
+        auto run = batch->transfer->getCurrentRun();
+        VkBuffer raw = buffer.getRaw(run);
+        if (batch->graphics != nullptr) {
+            buffer.getRaw(batch->release->getCurrentRun());
+            buffer.getRaw(batch->graphics->getCurrentRun());
+        }
+
+        VkCommandBuffer cmd = batch->transfer->getImplementation().getCommandBuffer();
+        bool pending = std::ranges::any_of(batch->bufferBarriers, [raw](auto& it) { return it.buffer == raw; });
+        if (pending) {
+            // The buffer was already written by this batch. The copies may overlap.
+            VkMemoryBarrier barrier{};
+            barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0,
+                                 nullptr, 0, nullptr);
+        } else if (usesOwnershipTransfer()) {
+            // The copies only write some regions: the buffer is acquired as a whole to keep the rest of its data.
+            VkBufferMemoryBarrier barrier{};
+            barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+            barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+            barrier.srcQueueFamilyIndex = _graphicsFamily;
+            barrier.dstQueueFamilyIndex = _transferFamily;
+            barrier.buffer = raw;
+            barrier.offset = 0;
+            barrier.size = VK_WHOLE_SIZE;
+            vkCmdPipelineBarrier(batch->release->getImplementation().getCommandBuffer(),
+                                 VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0,
+                                 nullptr, 1, &barrier, 0, nullptr);
+
+            barrier.srcAccessMask = 0;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1,
+                                 &barrier, 0, nullptr);
+
+            // Released to the graphics family on submission.
+            barrier.srcAccessMask = 0;
+            barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+            barrier.srcQueueFamilyIndex = _transferFamily;
+            barrier.dstQueueFamilyIndex = _graphicsFamily;
+            batch->bufferBarriers.push_back(barrier);
+        } else {
+            // Earlier commands of the graphics queue may still be using the buffer.
+            VkBufferMemoryBarrier barrier{};
+            barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+            barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.buffer = raw;
+            barrier.offset = 0;
+            barrier.size = VK_WHOLE_SIZE;
+            vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr,
+                                 1, &barrier, 0, nullptr);
+        }
+
+        vkCmdCopyBuffer(cmd, allocation.getBuffer()->getRaw(run), raw, static_cast<uint32_t>(copies.size()),
+                        copies.data());
+        allocator->release(allocation, run);
+
+        if (!usesOwnershipTransfer()) {
+            for (const auto& copy : copies) {
+                VkBufferMemoryBarrier barrier{};
+                barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+                barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+                barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                barrier.buffer = raw;
+                barrier.offset = copy.dstOffset;
+                barrier.size = copy.size;
+                batch->bufferBarriers.push_back(barrier);
+            }
+        }
+
+        ++batch->uploads;
+        return batch->task;
+    }
+
+    std::shared_ptr<Task<void>> StreamingUploader::uploadImage(VKResource& resource, ImageUpload upload,
+                                                               const StagingAllocator::Allocation& allocation)
+    {
+        std::lock_guard lock(_mutex);
+        Batch* batch = fetchBatch();
+
+        auto run = batch->transfer->getCurrentRun();
+        resource.registerRun(run);
+        if (batch->graphics != nullptr) {
+            resource.registerRun(batch->release->getCurrentRun());
+            resource.registerRun(batch->graphics->getCurrentRun());
+        }
+
+        VkCommandBuffer cmd = batch->transfer->getImplementation().getCommandBuffer();
+
+        // The image is already in the transfer layout if it is pending in this batch.
+        auto pending =
+            std::ranges::find_if(batch->imageBarriers, [&upload](auto& it) { return it.image == upload.image; });
+        if (pending != batch->imageBarriers.end()) {
+            if (!upload.copies.empty()) {
+                VkMemoryBarrier barrier{};
+                barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+                barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1,
+                                     &barrier, 0, nullptr, 0, nullptr);
+                vkCmdCopyBufferToImage(cmd, allocation.getBuffer()->getRaw(run), upload.image,
+                                       VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                       static_cast<uint32_t>(upload.copies.size()), upload.copies.data());
+            }
+            _application->getStagingAllocator()->release(allocation, run);
+            ++batch->uploads;
+            return batch->task;
+        }
+
+        VkImageMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.oldLayout = upload.oldLayout;
+        barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = upload.image;
+        barrier.subresourceRange = upload.range;
+
+        if (usesOwnershipTransfer() && upload.oldLayout != VK_IMAGE_LAYOUT_UNDEFINED) {
+            // The contents of the image are kept: the graphics family must release it first.
+            barrier.srcQueueFamilyIndex = _graphicsFamily;
+            barrier.dstQueueFamilyIndex = _transferFamily;
+            barrier.dstAccessMask = 0;
+            vkCmdPipelineBarrier(batch->release->getImplementation().getCommandBuffer(),
+                                 VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0,
+                                 nullptr, 0, nullptr, 1, &barrier);
+
+            // The source stage matches the stage waiting for the release semaphore.
+            barrier.srcAccessMask = 0;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0,
+                                 nullptr, 1, &barrier);
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        } else {
+            // Earlier commands may still be using the image.
+            // On a dedicated family, they are waited for by the release semaphore instead.
+            vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                                 nullptr, 0, nullptr, 1, &barrier);
+        }
+
+        if (!upload.copies.empty()) {
+            vkCmdCopyBufferToImage(cmd, allocation.getBuffer()->getRaw(run), upload.image,
+                                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32_t>(upload.copies.size()),
+                                   upload.copies.data());
+        }
+        _application->getStagingAllocator()->release(allocation, run);
+
+        barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.newLayout = upload.finalLayout;
+        if (usesOwnershipTransfer()) {
+            barrier.srcQueueFamilyIndex = _transferFamily;
+            barrier.dstQueueFamilyIndex = _graphicsFamily;
+        }
+        batch->imageBarriers.push_back(barrier);
+
+        if (upload.graphicsWork != nullptr) {
+            batch->graphicsWork.push_back(std::move(upload.graphicsWork));
+        }
+
+        ++batch->uploads;
+        return batch->task;
+    }
+
+    void StreamingUploader::flush()
+    {
+        std::lock_guard lock(_mutex);
+        if (_current != nullptr && _current->uploads > 0) {
+            submit(_current);
+            _current = nullptr;
+        }
+        completeFinished();
+    }
+} // namespace neon::vulkan
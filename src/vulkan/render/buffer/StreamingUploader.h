@@ -0,0 +1,189 @@
+#ifndef NEON_STREAMINGUPLOADER_H
+#define NEON_STREAMINGUPLOADER_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <neon/render/buffer/CommandBuffer.h>
+#include <neon/util/task/TaskRunner.h>
+#include <vulkan/VKResource.h>
+#include <vulkan/queue/VKQueueFamily.h>
+#include <vulkan/render/VKCommandPool.h>
+#include <vulkan/render/buffer/SimpleBuffer.h>
+#include <vulkan/render/buffer/StagingAllocator.h>
+
+namespace neon::vulkan
+{
+    class AbstractVKApplication;
+
+    /**
+     * Uploads data to device-local buffers and images outside the frame's command buffers.
+     * <p>
+     * Uploads are recorded into a batch. Once per frame, the application invokes flush(),
+     * submitting all the uploads of the batch at once.
+     * If the device has a queue family with transfer capabilities but without graphics capabilities,
+     * the copies are executed on that family. The uploaded resources are released by the graphics family
+     * before the copies, and their ownership is transferred back to the graphics family afterward.
+     * Otherwise, the copies are submitted to the graphics family.
+     * <p>
+     * In both cases, the copies wait for the graphics work submitted before the batch,
+     * so resources can be uploaded while previous frames are still reading them.
+     * <p>
+     * Each upload returns the task of its batch. The task finishes once the uploaded
+     * resources can be used by the graphics queue. Resources must not be used
+     * by the graphics queue while their upload is pending, and only the uploaded
+     * regions of a resource are guaranteed to be defined afterward.
+     * <p>
+     * This class is thread-safe. The uploader must be created and flushed by the main thread.
+     */
+    class StreamingUploader
+    {
+      public:
+        /**
+         * Describes an upload to an image.
+         */
+        struct ImageUpload
+        {
+            VkImage image = VK_NULL_HANDLE;
+
+            /**
+             * The subresources affected by the upload.
+             * Their layout is changed from oldLayout to finalLayout.
+             */
+            VkImageSubresourceRange range{};
+
+            VkImageLayout oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+            VkImageLayout finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+            /**
+             * The copies to execute. Buffer offsets are relative to the staging buffer.
+             */
+            std::vector<VkBufferImageCopy> copies;
+
+            /**
+             * Optional commands recorded on the graphics family once the image is available,
+             * such as the generation of mipmaps.
+             * <p>
+             * If the image is already pending in the current batch, only the copies of this upload are used:
+             * the range, the layouts and the graphics work of the pending upload are kept.
+             */
+            std::function<void(VkCommandBuffer)> graphicsWork;
+        };
+
+      private:
+        struct Batch
+        {
+            std::unique_ptr<CommandBuffer> transfer;
+            // Graphics family. Submitted before the transfer command buffer.
+            std::unique_ptr<CommandBuffer> release;
+            // Graphics family. Submitted after the transfer command buffer.
+            std::unique_ptr<CommandBuffer> graphics;
+            std::vector<VkBufferMemoryBarrier> bufferBarriers;
+            std::vector<VkImageMemoryBarrier> imageBarriers;
+            std::vector<std::function<void(VkCommandBuffer)>> graphicsWork;
+            std::shared_ptr<Task<void>> task;
+            size_t uploads = 0;
+        };
+
+        AbstractVKApplication* _application;
+        uint32_t _graphicsFamily;
+        uint32_t _transferFamily;
+
+        std::unique_ptr<VKCommandPool> _transferPool;
+        std::unique_ptr<VKCommandPool> _graphicsPool;
+
+        std::vector<std::unique_ptr<Batch>> _batches;
+        std::vector<Batch*> _free;
+        std::vector<Batch*> _submitted;
+        Batch* _current;
+
+        mutable std::mutex _mutex;
+
+        [[nodiscard]] bool usesOwnershipTransfer() const;
+
+        void completeFinished();
+
+        Batch* fetchBatch();
+
+        void submit(Batch* batch);
+
+      public:
+        StreamingUploader(const StreamingUploader& other) = delete;
+
+        /**
+         * Creates the uploader.
+         *
+         * @param application the application.
+         * @param batches the amount of batches that may be recorded or in flight at the same time.
+         * If all batches are in flight, uploads wait for the oldest one to finish.
+         */
+        explicit StreamingUploader(AbstractVKApplication* application, uint32_t batches);
+
+        ~StreamingUploader();
+
+        /**
+         * Finds the queue family used to execute the uploads.
+         * <p>
+         * Only families with transfer capabilities but without graphics capabilities are considered.
+         * Families without compute capabilities are preferred.
+         *
+         * @param families the queue families of the device.
+         * @return the index of the family, or empty if the uploads must be executed on the graphics family.
+         */
+        [[nodiscard]] static std::optional<uint32_t> findTransferFamily(const std::vector<VKQueueFamily>& families);
+
+        /**
+         * @return whether uploads are executed on a queue family different from the graphics family.
+         */
+        [[nodiscard]] bool hasDedicatedTransferQueue() const;
+
+        /**
+         * Uploads the given data to the given buffer.
+         *
+         * @param buffer the device buffer. It must have been created with VK_BUFFER_USAGE_TRANSFER_DST_BIT.
+         * @param offset the offset in the buffer, in bytes.
+         * @param data the data to upload.
+         * @param size the size of the data, in bytes.
+         * @return the task that finishes when the buffer can be used by the graphics queue.
+         */
+        std::shared_ptr<Task<void>> uploadBuffer(SimpleBuffer& buffer, uint32_t offset, const void* data,
+                                                 uint32_t size);
+
+        /**
+         * Uploads the given staging memory to the given buffer.
+         * The allocation is released by this uploader.
+         *
+         * @param buffer the device buffer. It must have been created with VK_BUFFER_USAGE_TRANSFER_DST_BIT.
+         * @param allocation the staging memory.
+         * @param copies the copies to execute. Source offsets are relative to the staging buffer.
+         * @return the task that finishes when the buffer can be used by the graphics queue.
+         */
+        std::shared_ptr<Task<void>> uploadBuffer(SimpleBuffer& buffer, const StagingAllocator::Allocation& allocation,
+                                                 const std::vector<VkBufferCopy>& copies);
+
+        /**
+         * Uploads the given staging memory to an image.
+         * The allocation is released by this uploader.
+         *
+         * @param resource the resource owning the image. The runs of the upload are registered on it.
+         * @param upload the description of the upload.
+         * @param allocation the staging memory.
+         * @return the task that finishes when the image can be used by the graphics queue.
+         */
+        std::shared_ptr<Task<void>> uploadImage(VKResource& resource, ImageUpload upload,
+                                                const StagingAllocator::Allocation& allocation);
+
+        /**
+         * Submits the pending uploads and completes the tasks of the finished batches.
+         * The application invokes this method once per frame.
+         */
+        void flush();
+    };
+} // namespace neon::vulkan
+
+#endif // NEON_STREAMINGUPLOADER_H
@@ -13,24 +13,58 @@
 namespace neon::vulkan
 {
     VKBasicInstanceData::VKBasicInstanceData(Application* application, const ModelCreateInfo& info) :
-        _vkApplication(dynamic_cast<AbstractVKApplication*>(application->getImplementation()))
+        VKBasicInstanceData(application, info, info.maximumInstances)
     {
-        _buffers.reserve(info.instanceTypes.size());
+    }
+
+    VKBasicInstanceData::VKBasicInstanceData(Application* application, const ModelCreateInfo& info,
+                                             uint32_t capacity) :
+        _vkApplication(dynamic_cast<AbstractVKApplication*>(application->getImplementation())),
+        _instanceSizes(info.instanceSizes),
+        _capacity(0)
+    {
+        resize(capacity);
+    }
+
+    const std::vector<std::unique_ptr<Buffer>>& VKBasicInstanceData::getBuffers() const
+    {
+        return _buffers;
+    }
+
+    uint32_t VKBasicInstanceData::getCapacity() const
+    {
+        return _capacity;
+    }
+
+    size_t VKBasicInstanceData::getAllocatedMemory() const
+    {
+        // Staging memory is shared by all buffers: it's owned by the application's StagingAllocator.
+        size_t bytes = 0;
+        for (auto& buffer : _buffers) {
+            if (buffer != nullptr) {
+                bytes += buffer->size();
+            }
+        }
+        return bytes;
+    }
 
-        for (const auto& size : info.instanceSizes) {
-            uint32_t bufferSize = static_cast<uint32_t>(size) * info.maximumInstances;
-            if (size == 0) {
+    void VKBasicInstanceData::resize(uint32_t capacity)
+    {
+        // Old buffers are kept alive by the resource bin until the GPU stops using them.
+        _buffers.clear();
+        _buffers.reserve(_instanceSizes.size());
+
+        for (const auto& size : _instanceSizes) {
+            uint32_t bufferSize = static_cast<uint32_t>(size) * capacity;
+            if (size == 0 || bufferSize == 0) {
                 _buffers.push_back(nullptr);
             } else {
                 _buffers.push_back(
                     std::make_unique<StagingBuffer>(_vkApplication, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, bufferSize));
             }
         }
-    }
 
-    const std::vector<std::unique_ptr<Buffer>>& VKBasicInstanceData::getBuffers() const
-    {
-        return _buffers;
+        _capacity = capacity;
     }
 
     void VKBasicInstanceData::flush(const CommandBuffer* command, size_t index, size_t instanceSize, void* data,
@@ -52,4 +86,30 @@ namespace neon::vulkan
 
         memcpy(map.value()->raw(), static_cast<char*>(data) + changeRange.getFrom(), changeRange.size());
     }
+
+    void VKBasicInstanceData::flush(const CommandBuffer* command, size_t index, size_t instanceSize, void* data,
+                       const std::vector<Range<uint32_t>>& changeRanges) const
+    {
+        if (changeRanges.empty()) {
+            return;
+        }
+        auto& buffer = _buffers[index];
+        if (buffer == nullptr) {
+            return;
+        }
+
+        if (changeRanges.size() == 1) {
+            flush(command, index, instanceSize, data, changeRanges.front());
+            return;
+        }
+
+        std::vector<Range<uint32_t>> byteRanges;
+        byteRanges.reserve(changeRanges.size());
+        for (auto range : changeRanges) {
+            byteRanges.push_back(range * static_cast<uint32_t>(instanceSize));
+        }
+
+        // Instance buffers are always staging buffers. See the constructor.
+        static_cast<StagingBuffer*>(buffer.get())->uploadRanges(data, byteRanges, command);
+    }
 } // namespace neon::vulkan
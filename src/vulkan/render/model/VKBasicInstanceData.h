@@ -27,14 +27,48 @@ namespace neon::vulkan
     {
         AbstractVKApplication* _vkApplication;
         std::vector<std::unique_ptr<Buffer>> _buffers;
+        std::vector<size_t> _instanceSizes;
+        uint32_t _capacity;
 
       public:
         VKBasicInstanceData(Application* application, const ModelCreateInfo& info);
 
+        /**
+         * Creates the instance buffers with room for the given amount of instances.
+         */
+        VKBasicInstanceData(Application* application, const ModelCreateInfo& info, uint32_t capacity);
+
         [[nodiscard]] const std::vector<std::unique_ptr<Buffer>>& getBuffers() const override;
 
+        /**
+         * @return the amount of instances the buffers can hold.
+         */
+        [[nodiscard]] uint32_t getCapacity() const;
+
+        /**
+         * @return the GPU memory used by the device buffers, in bytes.
+         */
+        [[nodiscard]] size_t getAllocatedMemory() const;
+
+        /**
+         * Replaces the buffers with new buffers that can hold the given amount of instances.
+         * <p>
+         * The new buffers are empty: the caller must upload the live instances again.
+         * The old buffers are destroyed once the GPU has finished using them.
+         *
+         * @param capacity the new amount of instances.
+         */
+        void resize(uint32_t capacity);
+
         void flush(const CommandBuffer* command, size_t index, size_t instanceSize, void* data,
                    Range<uint32_t> changeRange) const;
+
+        /**
+         * Uploads several ranges of instances using a single copy command.
+         * @param changeRanges the ranges of modified instances, in ascending order.
+         */
+        void flush(const CommandBuffer* command, size_t index, size_t instanceSize, void* data,
+                   const std::vector<Range<uint32_t>>& changeRanges) const;
     };
 } // namespace neon::vulkan
 
@@ -52,4 +52,30 @@ namespace neon::vulkan
 
         memcpy(map.value()->raw(), static_cast<char*>(data) + changeRange.getFrom(), changeRange.size());
     }
+
+    void VKConcurrentInstanceData::flush(const CommandBuffer* command, size_t index, size_t instanceSize, void* data,
+                       const std::vector<Range<uint32_t>>& changeRanges) const
+    {
+        if (changeRanges.empty()) {
+            return;
+        }
+        auto& buffer = _buffers[index];
+        if (buffer == nullptr) {
+            return;
+        }
+
+        if (changeRanges.size() == 1) {
+            flush(command, index, instanceSize, data, changeRanges.front());
+            return;
+        }
+
+        std::vector<Range<uint32_t>> byteRanges;
+        byteRanges.reserve(changeRanges.size());
+        for (auto range : changeRanges) {
+            byteRanges.push_back(range * static_cast<uint32_t>(instanceSize));
+        }
+
+        // Instance buffers are always staging buffers. See the constructor.
+        static_cast<StagingBuffer*>(buffer.get())->uploadRanges(data, byteRanges, command);
+    }
 } // namespace neon::vulkan
@@ -35,6 +35,13 @@ namespace neon::vulkan
 
         void flush(const CommandBuffer* command, size_t index, size_t instanceSize, void* data,
                    Range<uint32_t> changeRange) const;
+
+        /**
+         * Uploads several ranges of instances using a single copy command.
+         * @param changeRanges the ranges of modified instances, in ascending order.
+         */
+        void flush(const CommandBuffer* command, size_t index, size_t instanceSize, void* data,
+                   const std::vector<Range<uint32_t>>& changeRanges) const;
     };
 } // namespace neon::vulkan
 
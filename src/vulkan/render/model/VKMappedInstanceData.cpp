@@ -0,0 +1,59 @@
+#include "VKMappedInstanceData.h"
+
+#include <neon/structure/Application.h>
+#include <neon/render/model/ModelCreateInfo.h>
+#include <vulkan/AbstractVKApplication.h>
+#include <vulkan/render/buffer/MappedRingBuffer.h>
+
+namespace neon::vulkan
+{
+    VKMappedInstanceData::VKMappedInstanceData(Application* application, const ModelCreateInfo& info) :
+        _vkApplication(dynamic_cast<AbstractVKApplication*>(application->getImplementation()))
+    {
+        _buffers.reserve(info.instanceSizes.size());
+        for (const auto& size : info.instanceSizes) {
+            uint32_t bufferSize = static_cast<uint32_t>(size) * info.maximumInstances;
+            if (bufferSize == 0) {
+                _buffers.push_back(nullptr);
+            } else {
+                _buffers.push_back(
+                    std::make_unique<MappedRingBuffer>(_vkApplication, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, bufferSize));
+            }
+        }
+    }
+
+    const std::vector<std::unique_ptr<Buffer>>& VKMappedInstanceData::getBuffers() const
+    {
+        return _buffers;
+    }
+
+    uint32_t VKMappedInstanceData::getCurrentFrame() const
+    {
+        return _vkApplication->getCurrentFrame();
+    }
+
+    uint32_t VKMappedInstanceData::getFrameAmount() const
+    {
+        return _vkApplication->getMaxFramesInFlight();
+    }
+
+    char* VKMappedInstanceData::getData(size_t index, uint32_t frame) const
+    {
+        auto& buffer = _buffers[index];
+        if (buffer == nullptr) {
+            return nullptr;
+        }
+        return static_cast<MappedRingBuffer*>(buffer.get())->getFrameData(frame);
+    }
+
+    size_t VKMappedInstanceData::getAllocatedMemory() const
+    {
+        size_t bytes = 0;
+        for (auto& buffer : _buffers) {
+            if (buffer != nullptr) {
+                bytes += buffer->size() * _vkApplication->getMaxFramesInFlight();
+            }
+        }
+        return bytes;
+    }
+} // namespace neon::vulkan
@@ -0,0 +1,56 @@
+#ifndef NEON_VKMAPPEDINSTANCEDATA_H
+#define NEON_VKMAPPEDINSTANCEDATA_H
+
+#include <vector>
+#include <vulkan/render/buffer/Buffer.h>
+#include <vulkan/render/model/VKInstanceData.h>
+
+namespace neon
+{
+    class Application;
+
+    struct ModelCreateInfo;
+} // namespace neon
+
+namespace neon::vulkan
+{
+    class AbstractVKApplication;
+
+    /**
+     * Vulkan implementation of MappedInstanceData.
+     * Each instancing slot is stored in a MappedRingBuffer.
+     */
+    class VKMappedInstanceData : public VKInstanceData
+    {
+        AbstractVKApplication* _vkApplication;
+        std::vector<std::unique_ptr<Buffer>> _buffers;
+
+      public:
+        VKMappedInstanceData(Application* application, const ModelCreateInfo& info);
+
+        [[nodiscard]] const std::vector<std::unique_ptr<Buffer>>& getBuffers() const override;
+
+        /**
+         * @return the frame whose buffers are read by the GPU in the current frame.
+         */
+        [[nodiscard]] uint32_t getCurrentFrame() const;
+
+        /**
+         * @return the amount of buffers per slot.
+         */
+        [[nodiscard]] uint32_t getFrameAmount() const;
+
+        /**
+         * Returns the mapped memory of the given slot for the given frame.
+         * @return the memory or nullptr if the slot has no memory.
+         */
+        [[nodiscard]] char* getData(size_t index, uint32_t frame) const;
+
+        /**
+         * @return the host-visible memory used by all buffers, in bytes.
+         */
+        [[nodiscard]] size_t getAllocatedMemory() const;
+    };
+} // namespace neon::vulkan
+
+#endif // NEON_VKMAPPEDINSTANCEDATA_H
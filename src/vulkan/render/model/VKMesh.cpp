@@ -41,7 +41,7 @@ namespace neon::vulkan
             offsets[i] = 0;
         }
 
-        size_t instances = model.getInstanceDatas().empty() ? 1 : model.getInstanceData(0)->getInstanceAmount();
+        size_t instances = model.getInstanceDatas().empty() ? 1 : model.getInstanceData(0)->getDrawnInstanceAmount();
         for (auto& data : model.getInstanceDatas()) {
             auto& instancingBuffers = data->getImplementation().getBuffers();
             for (size_t j = 0; j < instancingBuffers.size() && i < MAX_BUFFERS; ++j, ++i) {
@@ -49,18 +49,18 @@ namespace neon::vulkan
                 buffers[i] = buffer == nullptr ? VK_NULL_HANDLE : buffer->getRaw(run);
                 offsets[i] = 0;
             }
-            instances = std::min(instances, data->getInstanceAmount());
+            instances = std::min(instances, data->getDrawnInstanceAmount());
         }
 
-        vkCmdBindVertexBuffers(rawCmd, 0, i, buffers, offsets);
-
-        vkCmdBindIndexBuffer(rawCmd, _indexBuffer.value()->getRaw(std::move(run)), 0, VK_INDEX_TYPE_UINT32);
+        auto& state = commandBuffer->getBindState();
+        state.bindVertexBuffers(rawCmd, i, buffers, offsets);
+        state.bindIndexBuffer(rawCmd, _indexBuffer.value()->getRaw(std::move(run)), 0, VK_INDEX_TYPE_UINT32);
 
         auto& mat = material->getImplementation();
 
-        vkCmdBindPipeline(rawCmd, VK_PIPELINE_BIND_POINT_GRAPHICS, mat.getPipeline());
+        state.bindPipeline(rawCmd, mat.getPipeline());
 
-        mat.uploadConstants(rawCmd);
+        mat.uploadConstants(commandBuffer);
         mat.useMaterial(commandBuffer->getCurrentRun());
 
         auto layout = mat.getPipelineLayout();
@@ -74,12 +74,12 @@ namespace neon::vulkan
                     break;
                 case ModelBufferLocation::MATERIAL:
                     if (auto& buffer = material->getUniformBuffer(); buffer != nullptr) {
-                        material->getUniformBuffer()->getImplementation().bind(commandBuffer, layout, binding);
+                        buffer->getImplementation().bind(commandBuffer, layout, binding);
                     }
                     break;
                 case ModelBufferLocation::MODEL:
                     if (auto buffer = model.getUniformBuffer(); buffer != nullptr) {
-                        material->getUniformBuffer()->getImplementation().bind(commandBuffer, layout, binding);
+                        buffer->getImplementation().bind(commandBuffer, layout, binding);
                     }
                     break;
                 case ModelBufferLocation::EXTRA:
@@ -37,10 +37,10 @@ void neon::vulkan::VKMeshShaderDrawable::draw(Material* material, VKCommandBuffe
     auto rawCmd = commandBuffer->getCommandBuffer();
     auto& mat = material->getImplementation();
 
-    vkCmdBindPipeline(rawCmd, VK_PIPELINE_BIND_POINT_GRAPHICS, mat.getPipeline());
+    commandBuffer->getBindState().bindPipeline(rawCmd, mat.getPipeline());
 
     mat.useMaterial(commandBuffer->getCurrentRun());
-    mat.uploadConstants(rawCmd);
+    mat.uploadConstants(commandBuffer);
 
     auto layout = mat.getPipelineLayout();
 
@@ -4,6 +4,9 @@
 
 #include "VKModel.h"
 
+#include <algorithm>
+#include <utility>
+
 #include <neon/structure/Application.h>
 #include <neon/render/Render.h>
 #include <neon/render/shader/Material.h>
@@ -20,10 +23,9 @@ namespace neon::vulkan
 
     void VKModel::draw(Material* material) const
     {
-        auto sp = std::shared_ptr<Material>(const_cast<Material*>(material), [](Material*) {});
-
         for (const auto& mesh : _model->getMeshes()) {
-            if (!mesh->getMaterials().contains(sp)) {
+            const auto& materials = std::as_const(*mesh).getMaterials();
+            if (!std::ranges::any_of(materials, [material](const auto& it) { return it.get() == material; })) {
                 continue;
             }
             auto* vk = dynamic_cast<AbstractVKApplication*>(_application->getImplementation());
@@ -33,6 +35,13 @@ namespace neon::vulkan
         }
     }
 
+    void VKModel::draw(Material* material, Drawable* drawable) const
+    {
+        auto* vk = dynamic_cast<AbstractVKApplication*>(_application->getImplementation());
+        drawable->getImplementation().draw(material, &vk->getCurrentCommandBuffer()->getImplementation(), *_model,
+                                           &_application->getRender()->getGlobalUniformBuffer());
+    }
+
     void VKModel::drawOutside(Material* material, CommandBuffer* commandBuffer) const
     {
         auto& buffer = commandBuffer->getImplementation();
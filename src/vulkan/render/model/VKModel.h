@@ -16,6 +16,8 @@ namespace neon
 
     class Material;
 
+    class Drawable;
+
     class CommandBuffer;
 
     class ShaderUniformBuffer;
@@ -37,6 +39,8 @@ namespace neon::vulkan
 
         void draw(Material* material) const;
 
+        void draw(Material* material, Drawable* drawable) const;
+
         void drawOutside(Material* material, CommandBuffer* commandBuffer) const;
     };
 } // namespace neon::vulkan
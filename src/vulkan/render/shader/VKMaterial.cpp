@@ -10,6 +10,7 @@
 #include <neon/render/shader/Material.h>
 
 #include <utility>
+#include <vulkan/render/VKCommandBuffer.h>
 #include <vulkan/render/VKRenderPass.h>
 
 #include <vulkan/util/VKUtil.h>
@@ -337,13 +338,14 @@ namespace neon::vulkan
         memcpy(_pushConstants.data() + from, data, to - from);
     }
 
-    void VKMaterial::uploadConstants(VkCommandBuffer buffer) const
+    void VKMaterial::uploadConstants(VKCommandBuffer* commandBuffer) const
     {
         if (_pushConstantStages == 0) {
             return;
         }
-        vkCmdPushConstants(buffer, _pipelineLayout, _pushConstantStages, 0,
-                           static_cast<uint32_t>(_pushConstants.size()), _pushConstants.data());
+        commandBuffer->getBindState().pushConstants(commandBuffer->getCommandBuffer(), _pipelineLayout,
+                                                    _pushConstantStages, _pushConstants.data(),
+                                                    static_cast<uint32_t>(_pushConstants.size()));
     }
 
     void VKMaterial::setTexture(const std::string& name, std::shared_ptr<SampledTexture> texture)
@@ -25,6 +25,8 @@ namespace neon::vulkan
 {
     class AbstractVKApplication;
 
+    class VKCommandBuffer;
+
     class VKMaterial : public VKResource
     {
         Material* _material;
@@ -52,7 +54,13 @@ namespace neon::vulkan
 
         void pushConstant(const std::string& name, const void* data, uint32_t size);
 
-        void uploadConstants(VkCommandBuffer buffer) const;
+        /**
+         * Pushes the constants of this material.
+         * The push is skipped if the command buffer already holds the same constants.
+         *
+         * @param commandBuffer the command buffer.
+         */
+        void uploadConstants(VKCommandBuffer* commandBuffer) const;
 
         void setTexture(const std::string& name, std::shared_ptr<SampledTexture> texture);
 
@@ -4,6 +4,10 @@
 
 #include "VKShaderProgram.h"
 
+#include <algorithm>
+
+#include <neon/filesystem/FileSystem.h>
+#include <neon/logging/Logger.h>
 #include <neon/structure/Application.h>
 #include <vulkan/render/spirv/SPIRVCompiler.h>
 
@@ -50,37 +54,17 @@ namespace neon::vulkan
         deleteShaders();
     }
 
-    std::optional<std::string> VKShaderProgram::compile(const std::unordered_map<ShaderType, std::string>& raw,
-                                                        IncluderCreateInfo includerCreateInfo)
+    std::optional<std::string> VKShaderProgram::createShaders(SPIRVCache::Entry entry)
     {
-        deleteShaders();
-
-        SPIRVCompiler compiler(getApplication()->getPhysicalDevice(), std::move(includerCreateInfo));
-
-        for (const auto& [type, code] : raw) {
-            auto error = compiler.addShader(getStage(type), code);
-            if (error.has_value()) {
-                return "Error compiling shader:\n" + code + "\n" + error.value();
-            }
-        }
-
-        auto error = compiler.compile();
-        if (error.has_value()) {
-            return error;
-        }
-
-        for (const auto& [type, _] : raw) {
-            auto stage = getStage(type);
-            auto result = compiler.getStage(stage).getResult(); // Always OK.
-
+        auto holder = holdRawDevice();
+        for (const auto& [stage, code] : entry.stages) {
             VkShaderModuleCreateInfo moduleInfo{};
             moduleInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-            moduleInfo.codeSize = result.size() * sizeof(uint32_t);
-            moduleInfo.pCode = result.data();
+            moduleInfo.codeSize = code.size() * sizeof(uint32_t);
+            moduleInfo.pCode = code.data();
 
             VkShaderModule shaderModule;
 
-            auto holder = holdRawDevice();
             if (vkCreateShaderModule(holder, &moduleInfo, nullptr, &shaderModule) != VK_SUCCESS) {
                 return "Failed to create shader module.";
             }
@@ -94,12 +78,63 @@ namespace neon::vulkan
             _shaders.push_back(stageInfo);
         }
 
-        _uniformBlocks = compiler.getUniformBlocks();
-        _samplers = compiler.getSamplers();
+        _uniformBlocks = std::move(entry.uniformBlocks);
+        _samplers = std::move(entry.samplers);
 
         return {};
     }
 
+    std::optional<std::string> VKShaderProgram::compile(const std::unordered_map<ShaderType, std::string>& raw,
+                                                        IncluderCreateInfo includerCreateInfo)
+    {
+        deleteShaders();
+
+        // Sorted, so the cache key doesn't depend on the iteration order of the map.
+        std::vector<std::pair<VkShaderStageFlagBits, std::string_view>> sources;
+        sources.reserve(raw.size());
+        for (const auto& [type, code] : raw) {
+            sources.emplace_back(getStage(type), code);
+        }
+        std::sort(sources.begin(), sources.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        SPIRVCompiler compiler(getApplication()->getPhysicalDevice(), std::move(includerCreateInfo));
+
+        std::optional<SPIRVCache> cache;
+        std::string key;
+        if (auto& fileSystem = getApplication()->getApplication()->getShaderCache()) {
+            cache.emplace(fileSystem.get());
+            key = compiler.computeCacheKey(sources);
+            if (auto entry = cache->load(key)) {
+                return createShaders(std::move(entry.value()));
+            }
+        }
+
+        for (const auto& [stage, code] : sources) {
+            auto error = compiler.addShader(stage, std::string(code));
+            if (error.has_value()) {
+                return "Error compiling shader:\n" + std::string(code) + "\n" + error.value();
+            }
+        }
+
+        auto error = compiler.compile();
+        if (error.has_value()) {
+            return error;
+        }
+
+        SPIRVCache::Entry entry;
+        for (const auto& [stage, _] : sources) {
+            entry.stages.push_back({stage, compiler.getStage(stage).getResult()}); // Always OK.
+        }
+        entry.uniformBlocks = compiler.getUniformBlocks();
+        entry.samplers = compiler.getSamplers();
+
+        if (cache.has_value() && !cache->store(key, entry)) {
+            neon::debug() << "Couldn't store compiled shader " << key << " in the shader cache.";
+        }
+
+        return createShaders(std::move(entry));
+    }
+
     const std::vector<VkPipelineShaderStageCreateInfo>& VKShaderProgram::getShaders() const
     {
         return _shaders;
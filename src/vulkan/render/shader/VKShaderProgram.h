@@ -14,6 +14,7 @@
 #include <neon/render/shader/ShaderType.h>
 #include <neon/render/shader/ShaderUniform.h>
 #include <vulkan/VKResource.h>
+#include <vulkan/render/spirv/SPIRVCache.h>
 
 namespace neon
 {
@@ -35,6 +36,8 @@ namespace neon::vulkan
 
         void deleteShaders();
 
+        std::optional<std::string> createShaders(SPIRVCache::Entry entry);
+
       public:
         VKShaderProgram(const VKShaderProgram& other) = delete;
 
@@ -42,6 +45,17 @@ namespace neon::vulkan
 
         ~VKShaderProgram();
 
+        /**
+         * Compiles the given sources and creates the shader modules.
+         * <p>
+         * If the application has a shader cache, the compiled code is looked up in it first.
+         * Programs found in the cache are created without invoking the shader compiler.
+         * Otherwise, the compiled code is stored in the cache.
+         *
+         * @param raw the sources of each stage.
+         * @param includerCreateInfo the information used to resolve include directives.
+         * @return the error, if the compilation failed.
+         */
         std::optional<std::string> compile(const std::unordered_map<ShaderType, std::string>& raw,
                                            IncluderCreateInfo includerCreateInfo);
 
@@ -306,7 +306,7 @@ namespace neon::vulkan
                 }
             }
         }
-        vkCmdBindDescriptorSets(commandBuffer->getCommandBuffer(), VK_PIPELINE_BIND_POINT_GRAPHICS, layout,
-                                bindingPoint, 1, &_descriptorSets[_vkApplication->getCurrentFrame()], 0, nullptr);
+        commandBuffer->getBindState().bindDescriptorSet(commandBuffer->getCommandBuffer(), layout, bindingPoint,
+                                                        _descriptorSets[_vkApplication->getCurrentFrame()]);
     }
 } // namespace neon::vulkan
@@ -0,0 +1,233 @@
+#include "SPIRVCache.h"
+
+#include <cstring>
+
+namespace neon::vulkan
+{
+    namespace
+    {
+        constexpr uint32_t MAGIC = 0x4E535043; // NSPC
+        constexpr uint32_t FORMAT_VERSION = 1;
+
+        class Writer
+        {
+            std::vector<std::byte> _data;
+
+          public:
+            void raw(const void* data, size_t size)
+            {
+                auto* bytes = static_cast<const std::byte*>(data);
+                _data.insert(_data.end(), bytes, bytes + size);
+            }
+
+            void u32(uint32_t value)
+            {
+                raw(&value, sizeof(uint32_t));
+            }
+
+            void string(const std::string& value)
+            {
+                u32(static_cast<uint32_t>(value.size()));
+                raw(value.data(), value.size());
+            }
+
+            void optional(const std::optional<uint32_t>& value)
+            {
+                u32(value.has_value() ? 1 : 0);
+                u32(value.value_or(0));
+            }
+
+            void uniform(const ShaderUniform& uniform)
+            {
+                string(uniform.name);
+                optional(uniform.set);
+                optional(uniform.binding);
+                u32(uniform.stages);
+            }
+
+            std::vector<std::byte> take()
+            {
+                return std::move(_data);
+            }
+        };
+
+        class Reader
+        {
+            const std::byte* _data;
+            size_t _size;
+            bool _valid;
+
+          public:
+            Reader(const std::byte* data, size_t size) :
+                _data(data),
+                _size(size),
+                _valid(true)
+            {
+            }
+
+            [[nodiscard]] bool isValid() const
+            {
+                return _valid;
+            }
+
+            [[nodiscard]] bool isFinished() const
+            {
+                return _size == 0;
+            }
+
+            bool raw(void* data, size_t size)
+            {
+                if (!_valid || size > _size) {
+                    _valid = false;
+                    return false;
+                }
+                memcpy(data, _data, size);
+                _data += size;
+                _size -= size;
+                return true;
+            }
+
+            uint32_t u32()
+            {
+                uint32_t value = 0;
+                raw(&value, sizeof(uint32_t));
+                return value;
+            }
+
+            /**
+             * Reads an amount of elements, checking that the remaining data
+             * can contain them. This prevents huge allocations on corrupted files.
+             */
+            uint32_t count(size_t minElementSize)
+            {
+                uint32_t value = u32();
+                if (static_cast<size_t>(value) * minElementSize > _size) {
+                    _valid = false;
+                    return 0;
+                }
+                return value;
+            }
+
+            std::string string()
+            {
+                std::string value(count(1), '\0');
+                raw(value.data(), value.size());
+                return value;
+            }
+
+            std::optional<uint32_t> optional()
+            {
+                bool present = u32() != 0;
+                uint32_t value = u32();
+                return present ? std::optional(value) : std::nullopt;
+            }
+
+            void uniform(ShaderUniform& uniform)
+            {
+                uniform.name = string();
+                uniform.set = optional();
+                uniform.binding = optional();
+                uniform.stages = u32();
+            }
+        };
+    } // namespace
+
+    SPIRVCache::SPIRVCache(FileSystem* fileSystem) :
+        _fileSystem(fileSystem)
+    {
+    }
+
+    std::optional<SPIRVCache::Entry> SPIRVCache::load(const std::string& key) const
+    {
+        auto file = _fileSystem->readFile(getPath(key));
+        if (!file.has_value()) {
+            return {};
+        }
+        return deserialize(key, file->getData(), file->getSize());
+    }
+
+    bool SPIRVCache::store(const std::string& key, const Entry& entry)
+    {
+        auto data = serialize(key, entry);
+        return _fileSystem->writeFile(getPath(key), data.data(), data.size());
+    }
+
+    std::filesystem::path SPIRVCache::getPath(const std::string& key)
+    {
+        return key + ".spvc";
+    }
+
+    std::vector<std::byte> SPIRVCache::serialize(const std::string& key, const Entry& entry)
+    {
+        Writer writer;
+        writer.u32(MAGIC);
+        writer.u32(FORMAT_VERSION);
+        writer.string(key);
+
+        writer.u32(static_cast<uint32_t>(entry.stages.size()));
+        for (const auto& stage : entry.stages) {
+            writer.u32(static_cast<uint32_t>(stage.stage));
+            writer.u32(static_cast<uint32_t>(stage.code.size()));
+            writer.raw(stage.code.data(), stage.code.size() * sizeof(uint32_t));
+        }
+
+        writer.u32(static_cast<uint32_t>(entry.uniformBlocks.size()));
+        for (const auto& block : entry.uniformBlocks) {
+            writer.uniform(block);
+            writer.u32(block.sizeInBytes);
+            writer.optional(block.offset);
+            writer.u32(static_cast<uint32_t>(block.memberNames.size()));
+            for (const auto& name : block.memberNames) {
+                writer.string(name);
+            }
+        }
+
+        writer.u32(static_cast<uint32_t>(entry.samplers.size()));
+        for (const auto& sampler : entry.samplers) {
+            writer.uniform(sampler);
+            writer.u32(static_cast<uint32_t>(sampler.type));
+        }
+
+        return writer.take();
+    }
+
+    std::optional<SPIRVCache::Entry> SPIRVCache::deserialize(const std::string& key, const std::byte* data,
+                                                              size_t size)
+    {
+        Reader reader(data, size);
+        if (reader.u32() != MAGIC || reader.u32() != FORMAT_VERSION || reader.string() != key) {
+            return {};
+        }
+
+        Entry entry;
+
+        entry.stages.resize(reader.count(2 * sizeof(uint32_t)));
+        for (auto& stage : entry.stages) {
+            stage.stage = static_cast<VkShaderStageFlagBits>(reader.u32());
+            stage.code.resize(reader.count(sizeof(uint32_t)));
+            reader.raw(stage.code.data(), stage.code.size() * sizeof(uint32_t));
+        }
+
+        entry.uniformBlocks.resize(reader.count(sizeof(uint32_t)));
+        for (auto& block : entry.uniformBlocks) {
+            reader.uniform(block);
+            block.sizeInBytes = reader.u32();
+            block.offset = reader.optional();
+            block.memberNames.resize(reader.count(sizeof(uint32_t)));
+            for (auto& name : block.memberNames) {
+                name = reader.string();
+            }
+        }
+
+        entry.samplers.resize(reader.count(sizeof(uint32_t)));
+        for (auto& sampler : entry.samplers) {
+            reader.uniform(sampler);
+            sampler.type = static_cast<TextureViewType>(reader.u32());
+        }
+
+        if (!reader.isValid() || !reader.isFinished()) {
+            return {};
+        }
+        return entry;
+    }
+} // namespace neon::vulkan
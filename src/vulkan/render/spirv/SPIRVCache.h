@@ -0,0 +1,78 @@
+#ifndef NEON_SPIRVCACHE_H
+#define NEON_SPIRVCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+#include <neon/filesystem/FileSystem.h>
+#include <neon/render/shader/ShaderUniform.h>
+
+namespace neon::vulkan
+{
+    /**
+     * Content-addressed storage of compiled shader programs.
+     * <p>
+     * Each entry contains the SPIR-V code of all stages of a program
+     * and the reflected uniform blocks and samplers, so programs found
+     * in the cache are created without invoking the shader compiler.
+     * <p>
+     * Entries are identified by a key that covers everything the compilation depends on.
+     * Keys are generated by SPIRVCompiler::computeCacheKey().
+     * The key is stored inside the entry too: entries with a different key are ignored.
+     */
+    class SPIRVCache
+    {
+      public:
+        struct Stage
+        {
+            VkShaderStageFlagBits stage;
+            std::vector<uint32_t> code;
+        };
+
+        struct Entry
+        {
+            std::vector<Stage> stages;
+            std::vector<ShaderUniformBlock> uniformBlocks;
+            std::vector<ShaderUniformSampler> samplers;
+        };
+
+      private:
+        FileSystem* _fileSystem;
+
+      public:
+        explicit SPIRVCache(FileSystem* fileSystem);
+
+        /**
+         * Returns the entry with the given key.
+         *
+         * @param key the key of the entry.
+         * @return the entry, or empty if the entry is not present or is corrupted.
+         */
+        [[nodiscard]] std::optional<Entry> load(const std::string& key) const;
+
+        /**
+         * Stores the given entry.
+         *
+         * @param key the key of the entry.
+         * @param entry the entry.
+         * @return whether the entry was stored. Read-only file systems never store entries.
+         */
+        bool store(const std::string& key, const Entry& entry);
+
+        /**
+         * @return the path of the entry with the given key inside the file system.
+         */
+        [[nodiscard]] static std::filesystem::path getPath(const std::string& key);
+
+        [[nodiscard]] static std::vector<std::byte> serialize(const std::string& key, const Entry& entry);
+
+        [[nodiscard]] static std::optional<Entry> deserialize(const std::string& key, const std::byte* data,
+                                                              size_t size);
+    };
+} // namespace neon::vulkan
+
+#endif // NEON_SPIRVCACHE_H
@@ -11,11 +11,115 @@
 
 #include <neon/logging/Logger.h>
 
+#include <functional>
+#include <mutex>
+#include <unordered_set>
+
 namespace neon::vulkan
 {
     constexpr int DEFAULT_VERSION = 450;
+    constexpr auto TARGET_VULKAN = glslang::EShTargetVulkan_1_2;
+    constexpr auto TARGET_SPV = glslang::EShTargetSpv_1_5;
+    constexpr auto PARSE_MESSAGES = static_cast<EShMessages>(EShMsgSpvRules | EShMsgVulkanRules | EShMsgDebugInfo);
+    constexpr auto LINK_MESSAGES = static_cast<EShMessages>(EShMsgSpvRules | EShMsgVulkanRules);
+
+    /**
+     * Increase this value when the compilation changes in a way not covered
+     * by the settings above, invalidating all cached shaders.
+     */
+    constexpr uint32_t CACHE_VERSION = 1;
+
+    static std::once_flag GLSLANG_INITIALIZED;
+
+    namespace
+    {
+        /**
+         * 128-bit hash used to build cache keys.
+         * Two independent 64-bit lanes make accidental collisions negligible.
+         */
+        class CacheKeyHasher
+        {
+            uint64_t _first = 0xCBF29CE484222325;
+            uint64_t _second = 0x9E3779B97F4A7C15;
+
+          public:
+            void bytes(const void* data, size_t size)
+            {
+                auto* bytes = static_cast<const uint8_t*>(data);
+                for (size_t i = 0; i < size; ++i) {
+                    _first = (_first ^ bytes[i]) * 0x100000001B3;
+                    _second = (_second ^ bytes[i]) * 0xFF51AFD7ED558CCD;
+                    _second ^= _second >> 29;
+                }
+            }
+
+            void u32(uint32_t value)
+            {
+                bytes(&value, sizeof(uint32_t));
+            }
 
-    static bool GLSLANG_INITIALIZED = false;
+            void string(std::string_view value)
+            {
+                u32(static_cast<uint32_t>(value.size()));
+                bytes(value.data(), value.size());
+            }
+
+            [[nodiscard]] std::string hex() const
+            {
+                constexpr auto DIGITS = "0123456789abcdef";
+                std::string result;
+                result.reserve(32);
+                for (uint64_t lane : {_first, _second}) {
+                    for (int shift = 60; shift >= 0; shift -= 4) {
+                        result.push_back(DIGITS[(lane >> shift) & 0xF]);
+                    }
+                }
+                return result;
+            }
+        };
+
+        /**
+         * Invokes the given function for each include directive of the given source.
+         * Directives inside comments or disabled blocks are reported too:
+         * hashing more files than the ones used only makes the key stricter.
+         */
+        template<typename Consumer>
+        void forEachInclude(std::string_view source, Consumer consumer)
+        {
+            constexpr std::string_view INCLUDE = "include";
+            constexpr std::string_view SPACES = " \t";
+
+            size_t lineStart = 0;
+            while (lineStart < source.size()) {
+                size_t lineEnd = source.find('\n', lineStart);
+                if (lineEnd == std::string_view::npos) {
+                    lineEnd = source.size();
+                }
+                auto line = source.substr(lineStart, lineEnd - lineStart);
+                lineStart = lineEnd + 1;
+
+                size_t i = line.find_first_not_of(SPACES);
+                if (i == std::string_view::npos || line[i] != '#') {
+                    continue;
+                }
+                i = line.find_first_not_of(SPACES, i + 1);
+                if (i == std::string_view::npos || line.substr(i, INCLUDE.size()) != INCLUDE) {
+                    continue;
+                }
+                i = line.find_first_not_of(SPACES, i + INCLUDE.size());
+                if (i == std::string_view::npos || (line[i] != '"' && line[i] != '<')) {
+                    continue;
+                }
+
+                bool local = line[i] == '"';
+                size_t end = line.find(local ? '"' : '>', i + 1);
+                if (end == std::string_view::npos) {
+                    continue;
+                }
+                consumer(std::string(line.substr(i + 1, end - i - 1)), local);
+            }
+        }
+    } // namespace
 
     std::string* SPIRVIncluder::fetch(std::filesystem::path path)
     {
@@ -45,10 +149,24 @@ namespace neon::vulkan
     {
     }
 
+    std::filesystem::path SPIRVIncluder::resolveLocal(const char* headerName, const char* includerName) const
+    {
+        // glslang names the root snippets using an empty string.
+        if (includerName && includerName[0] != '\0') {
+            return std::filesystem::path(includerName).parent_path() / headerName;
+        }
+        return _rootPath / headerName;
+    }
+
+    std::filesystem::path SPIRVIncluder::resolveSystem(const char* headerName)
+    {
+        return {headerName};
+    }
+
     glslang::TShader::Includer::IncludeResult* SPIRVIncluder::includeSystem(const char* headerName,
                                                                             const char* includerName, size_t depth)
     {
-        auto path = std::filesystem::path(headerName);
+        auto path = resolveSystem(headerName);
 
         neon::debug() << "Fetching system include file: " << path;
 
@@ -63,12 +181,7 @@ namespace neon::vulkan
     glslang::TShader::Includer::IncludeResult* SPIRVIncluder::includeLocal(const char* headerName,
                                                                            const char* includerName, size_t depth)
     {
-        std::filesystem::path path;
-        if (includerName) {
-            path = std::filesystem::path(includerName).parent_path() / headerName;
-        } else {
-            path = _rootPath / headerName;
-        }
+        auto path = resolveLocal(headerName, includerName);
 
         neon::debug() << "Fetching local include file: " << headerName << " (" << path << ")";
 
@@ -252,14 +365,13 @@ namespace neon::vulkan
     }
 
     SPIRVCompiler::SPIRVCompiler(const VKPhysicalDevice& device, IncluderCreateInfo includerCreateInfo) :
+        _device(&device),
         _compiled(false),
         _resources(generateDefaultResources(device)),
         _includer(std::move(includerCreateInfo))
     {
-        if (!GLSLANG_INITIALIZED) {
-            glslang::InitializeProcess();
-            GLSLANG_INITIALIZED = true;
-        }
+        // Compilers may be created concurrently by several threads.
+        std::call_once(GLSLANG_INITIALIZED, [] { glslang::InitializeProcess(); });
     }
 
     SPIRVCompiler::~SPIRVCompiler()
@@ -277,16 +389,14 @@ namespace neon::vulkan
         auto language = getLanguage(shaderType);
         auto* shader = new glslang::TShader(language);
 
-        auto messages = static_cast<EShMessages>(EShMsgSpvRules | EShMsgVulkanRules | EShMsgDebugInfo);
-
         const char* value = source.data();
         shader->setStrings(&value, 1);
         shader->setPreamble(preamble);
         shader->setEnvInput(glslang::EShSourceGlsl, language, glslang::EShClientVulkan, DEFAULT_VERSION);
-        shader->setEnvClient(glslang::EShClientVulkan, glslang::EShTargetVulkan_1_2);
-        shader->setEnvTarget(glslang::EShTargetSpv, glslang::EShTargetSpv_1_5);
+        shader->setEnvClient(glslang::EShClientVulkan, TARGET_VULKAN);
+        shader->setEnvTarget(glslang::EShTargetSpv, TARGET_SPV);
 
-        if (!shader->parse(&_resources, DEFAULT_VERSION, false, messages, _includer)) {
+        if (!shader->parse(&_resources, DEFAULT_VERSION, false, PARSE_MESSAGES, _includer)) {
             std::string infoLog(shader->getInfoLog());
             std::string infoDebugLog(shader->getInfoDebugLog());
             delete shader;
@@ -297,10 +407,65 @@ namespace neon::vulkan
         return {};
     }
 
+    std::string SPIRVCompiler::computeCacheKey(
+        const std::vector<std::pair<VkShaderStageFlagBits, std::string_view>>& sources)
+    {
+        CacheKeyHasher hasher;
+        hasher.u32(CACHE_VERSION);
+        hasher.u32(DEFAULT_VERSION);
+        hasher.u32(TARGET_VULKAN);
+        hasher.u32(TARGET_SPV);
+        hasher.u32(PARSE_MESSAGES);
+        hasher.u32(LINK_MESSAGES);
+
+        // The resources given to the compiler depend on the limits of the device.
+        auto& properties = _device->getProperties();
+        hasher.u32(properties.vendorID);
+        hasher.u32(properties.deviceID);
+        hasher.u32(properties.driverVersion);
+        hasher.u32(properties.apiVersion);
+
+        std::unordered_set<std::string> visited;
+        std::function<void(std::string_view, const std::string&)> hashIncludes;
+        hashIncludes = [&](std::string_view source, const std::string& includerName) {
+            forEachInclude(source, [&](const std::string& header, bool local) {
+                // Same lookup order as glslang: local includes fall back to system includes.
+                std::filesystem::path path;
+                std::string* data = nullptr;
+                if (local) {
+                    path = _includer.resolveLocal(header.c_str(), includerName.c_str());
+                    data = _includer.fetch(path);
+                }
+                if (!data) {
+                    path = SPIRVIncluder::resolveSystem(header.c_str());
+                    data = _includer.fetch(path);
+                }
+
+                auto name = path.generic_string();
+                hasher.string(name);
+                if (!data) {
+                    hasher.u32(UINT32_MAX);
+                    return;
+                }
+                hasher.string(*data);
+                if (visited.insert(name).second) {
+                    hashIncludes(*data, name);
+                }
+            });
+        };
+
+        for (const auto& [stage, source] : sources) {
+            hasher.u32(stage);
+            hasher.string(source);
+            hashIncludes(source, "");
+        }
+
+        return hasher.hex();
+    }
+
     std::optional<std::string> SPIRVCompiler::compile()
     {
-        auto messages = static_cast<EShMessages>(EShMsgSpvRules | EShMsgVulkanRules);
-        if (!_program.link(messages)) {
+        if (!_program.link(LINK_MESSAGES)) {
             std::string infoLog(_program.getInfoLog());
             std::string infoDebugLog(_program.getInfoDebugLog());
             return {infoLog + "\n" + infoDebugLog};
@@ -7,6 +7,7 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <optional>
 
 #include <vulkan/vulkan.h>
@@ -19,6 +20,13 @@
 
 namespace neon::vulkan
 {
+    /**
+     * Resolves the include directives of the shaders compiled by a SPIRVCompiler.
+     * <p>
+     * Includers are not thread-safe: each compiler owns its own includer.
+     * Several includers may share the same file system,
+     * as long as it supports concurrent reads.
+     */
     class SPIRVIncluder : public glslang::TShader::Includer
     {
         FileSystem* _fileSystem;
@@ -26,13 +34,30 @@ namespace neon::vulkan
 
         std::unordered_map<std::filesystem::path, std::string> _cache;
 
-        std::string* fetch(std::filesystem::path path);
-
       public:
         explicit SPIRVIncluder(IncluderCreateInfo includerCreateInfo);
 
         ~SPIRVIncluder() override = default;
 
+        /**
+         * Returns the contents of the given file.
+         * Files are read once and kept in memory.
+         *
+         * @param path the path of the file.
+         * @return the contents, or null if the file is not present.
+         */
+        std::string* fetch(std::filesystem::path path);
+
+        /**
+         * @return the path of a file included using quotes by the given includer.
+         */
+        [[nodiscard]] std::filesystem::path resolveLocal(const char* headerName, const char* includerName) const;
+
+        /**
+         * @return the path of a file included using angle brackets.
+         */
+        [[nodiscard]] static std::filesystem::path resolveSystem(const char* headerName);
+
         IncludeResult* includeSystem(const char*, const char*, size_t) override;
 
         IncludeResult* includeLocal(const char*, const char*, size_t) override;
@@ -40,12 +65,19 @@ namespace neon::vulkan
         void releaseInclude(IncludeResult*) override;
     };
 
+    /**
+     * Compiles GLSL shaders into SPIR-V.
+     * <p>
+     * A compiler must only be used by one thread,
+     * but several compilers may be used concurrently.
+     */
     class SPIRVCompiler
     {
         static TBuiltInResource generateDefaultResources(const VKPhysicalDevice& device);
 
         static EShLanguage getLanguage(const VkShaderStageFlagBits& shaderType);
 
+        const VKPhysicalDevice* _device;
         bool _compiled;
         std::vector<glslang::TShader*> _shaders;
         glslang::TProgram _program;
@@ -59,6 +91,19 @@ namespace neon::vulkan
 
         std::optional<std::string> addShader(const VkShaderStageFlagBits& shaderType, const std::string& source);
 
+        /**
+         * Computes the key identifying the compiled code of the given sources in a SPIRVCache.
+         * <p>
+         * The key covers the sources, their stages, the contents of all the files they include,
+         * the compiler settings and the device. Any change on them results in a different key.
+         * The included files are fetched through this compiler's includer,
+         * so they are not read again if the sources are compiled afterward.
+         *
+         * @param sources the sources and their stages, in the order they will be added to this compiler.
+         * @return the key, as a hexadecimal string.
+         */
+        std::string computeCacheKey(const std::vector<std::pair<VkShaderStageFlagBits, std::string_view>>& sources);
+
         std::optional<std::string> compile();
 
         Result<std::vector<uint32_t>, std::string> getStage(const VkShaderStageFlagBits& shaderType);
@@ -5,9 +5,14 @@
 #include "VKSimpleTexture.h"
 #include "VKTextureView.h"
 
+#include <numeric>
+
 #include <neon/render/buffer/CommandBuffer.h>
+#include <neon/util/task/Coroutine.h>
 #include <vulkan/AbstractVKApplication.h>
 #include <vulkan/render/buffer/SimpleBuffer.h>
+#include <vulkan/render/buffer/StagingAllocator.h>
+#include <vulkan/render/buffer/StreamingUploader.h>
 #include <vulkan/util/VKUtil.h>
 #include <vulkan/util/VulkanConversions.h>
 
@@ -15,6 +20,29 @@ namespace neon::vulkan
 {
     namespace vc = conversions;
 
+    namespace
+    {
+        using ReadResult = Result<std::vector<std::byte>, std::string>;
+
+        Coroutine<ReadResult> finishReadback(std::shared_ptr<CommandBufferRun> run,
+                                             std::shared_ptr<SimpleBuffer> buffer, size_t bytes)
+        {
+            // The run is kept alive by the coroutine's frame.
+            // Capturing the shared pointer inside the yielded temporary breaks on some compilers.
+            co_yield WaitUntil([raw = run.get()] { return raw->hasFinished(); });
+
+            buffer->invalidate();
+            auto map = buffer->map<std::byte>();
+            if (!map.has_value()) {
+                co_return ReadResult(std::string("Couldn't map readback buffer."));
+            }
+
+            std::vector<std::byte> data(bytes);
+            memcpy(data.data(), map.value()->raw(), bytes);
+            co_return ReadResult(std::move(data));
+        }
+    } // namespace
+
     void VKSimpleTexture::transitionLayout(VkImageLayout layout, VkCommandBuffer commandBuffer) const
     {
         vulkan_util::transitionImageLayout(_image, vc::vkFormat(_info.format), _currentLayout, layout, _info.mipmaps,
@@ -22,6 +50,11 @@ namespace neon::vulkan
         _currentLayout = layout;
     }
 
+    bool VKSimpleTexture::hasPendingUpload() const
+    {
+        return _pendingUpload != nullptr && !_pendingUpload->hasFinished();
+    }
+
     void VKSimpleTexture::uploadData(const std::byte* data, CommandBuffer* commandBuffer)
     {
         size_t size = _info.width * _info.height * _info.depth * _info.layers * vc::pixelSize(_info.format);
@@ -58,7 +91,8 @@ namespace neon::vulkan
         VKResource(application),
         Texture(std::move(name)),
         _info(info),
-        _currentLayout(VK_IMAGE_LAYOUT_UNDEFINED)
+        _currentLayout(VK_IMAGE_LAYOUT_UNDEFINED),
+        _readbackRing(std::make_unique<ReadbackRing>(getApplication(), getApplication()->getMaxFramesInFlight() + 1))
     {
         VkImageUsageFlags usages = 0;
         for (const auto& usage : info.usages) {
@@ -194,6 +228,9 @@ namespace neon::vulkan
             offset.z() + size.z() > _info.depth || layerOffset + layers > _info.layers) {
             return {"Texture update region is out of bounds."};
         }
+        if (hasPendingUpload()) {
+            return {"Texture has a pending asynchronous upload."};
+        }
 
         CommandPoolHolder holder = getApplication()->getApplication()->getCommandManager().fetchCommandPool();
         CommandBuffer* cmd = holder.getPool().beginCommandBuffer(true);
@@ -213,6 +250,7 @@ namespace neon::vulkan
         cmd->submit();
         cmd->wait();
 
+        buffer.invalidate();
         auto map = buffer.map<uint8_t>();
         if (!map.has_value()) {
             return {"Couldn't map destination buffer."};
@@ -224,13 +262,135 @@ namespace neon::vulkan
         return {};
     }
 
-    Result<void, std::string> VKSimpleTexture::updateData(const void* data, rush::Vec3ui offset, rush::Vec3ui size,
-                                                          uint32_t layerOffset, uint32_t layers,
-                                                          CommandBuffer* commandBuffer)
+    std::shared_ptr<Task<ReadResult>> VKSimpleTexture::readDataAsync(rush::Vec3ui offset, rush::Vec3ui size,
+                                                                     uint32_t layerOffset, uint32_t layers) const
     {
         if (offset.x() + size.x() > _info.width || offset.y() + size.y() > _info.height ||
             offset.z() + size.z() > _info.depth || layerOffset + layers > _info.layers) {
-            return {"Texture update region is out of bounds."};
+            auto task = std::make_shared<Task<ReadResult>>(nullptr);
+            task->setResult(ReadResult(std::string("Texture read region is out of bounds.")));
+            return task;
+        }
+        if (hasPendingUpload()) {
+            auto task = std::make_shared<Task<ReadResult>>(nullptr);
+            task->setResult(ReadResult(std::string("Texture has a pending asynchronous upload.")));
+            return task;
+        }
+
+        size_t bytesSize = size.x() * size.y() * size.z() * layers * vc::pixelSize(_info.format);
+        auto buffer = _readbackRing->acquire(bytesSize);
+
+        CommandPoolHolder holder = getApplication()->getApplication()->getCommandManager().fetchCommandPool();
+        CommandBuffer* cmd = holder.getPool().beginCommandBuffer(true);
+        VkCommandBuffer rawCmd = cmd->getImplementation().getCommandBuffer();
+
+        auto layout = _currentLayout;
+
+        transitionLayout(VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, rawCmd);
+        vulkan_util::copyImageToBuffer(buffer->getRaw(cmd->getCurrentRun()), _image, offset.cast<int32_t>(), size,
+                                       layerOffset, layers, rawCmd);
+        transitionLayout(layout, rawCmd);
+
+        cmd->end();
+        cmd->submit();
+
+        // The buffer returns to the ring once the coroutine has copied its data.
+        auto coroutine = finishReadback(cmd->getCurrentRun(), std::move(buffer), bytesSize);
+        auto task = coroutine.asTask();
+        getApplication()->getApplication()->getTaskRunner().launchCoroutine(std::move(coroutine));
+        return task;
+    }
+
+    Result<VKSimpleTexture::StagedRegions, std::string> VKSimpleTexture::stageRegions(
+        const std::byte* data, rush::Vec3ui dataOrigin, rush::Vec3ui dataSize, uint32_t dataLayerOrigin,
+        const std::vector<TextureUpdateRegion>& regions) const
+    {
+        uint32_t pixelSize = vc::pixelSize(_info.format);
+        // Buffer offsets of image copies must be multiples of the texel size and of 4.
+        uint32_t alignment = std::lcm(pixelSize, 4u);
+        auto align = [alignment](size_t value) { return (value + alignment - 1) / alignment * alignment; };
+
+        size_t total = 0;
+        for (const auto& region : regions) {
+            auto end = region.offset + region.size;
+            if (end.x() > _info.width || end.y() > _info.height || end.z() > _info.depth ||
+                region.layerOffset + region.layers > _info.layers) {
+                return std::string("Texture update region is out of bounds.");
+            }
+            if (region.offset.x() < dataOrigin.x() || region.offset.y() < dataOrigin.y() ||
+                region.offset.z() < dataOrigin.z() || region.layerOffset < dataLayerOrigin ||
+                end.x() - dataOrigin.x() > dataSize.x() || end.y() - dataOrigin.y() > dataSize.y() ||
+                end.z() - dataOrigin.z() > dataSize.z()) {
+                return std::string("Texture update region is outside the source data.");
+            }
+            total = align(total) + region.size.x() * region.size.y() * region.size.z() * region.layers * pixelSize;
+        }
+
+        StagedRegions staged;
+        if (total == 0) {
+            return std::move(staged);
+        }
+
+        // The allocation is aligned for buffers, not for texels. Reserve room to align the first region.
+        staged.allocation = getApplication()->getStagingAllocator()->allocate(static_cast<uint32_t>(total + alignment));
+        size_t base = align(staged.allocation.offset);
+        std::byte* staging = reinterpret_cast<std::byte*>(staged.allocation.data) + (base - staged.allocation.offset);
+
+        size_t rowStride = dataSize.x() * pixelSize;
+        size_t sliceStride = rowStride * dataSize.y();
+        size_t layerStride = sliceStride * dataSize.z();
+
+        staged.copies.reserve(regions.size());
+
+        size_t cursor = 0;
+        for (const auto& region : regions) {
+            cursor = align(cursor);
+
+            VkBufferImageCopy copy{};
+            copy.bufferOffset = base + cursor;
+            copy.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            copy.imageSubresource.mipLevel = 0;
+            copy.imageSubresource.baseArrayLayer = region.layerOffset;
+            copy.imageSubresource.layerCount = region.layers;
+            copy.imageOffset = {static_cast<int32_t>(region.offset.x()), static_cast<int32_t>(region.offset.y()),
+                                static_cast<int32_t>(region.offset.z())};
+            copy.imageExtent = {region.size.x(), region.size.y(), region.size.z()};
+            staged.copies.push_back(copy);
+
+            // Pack the rows of the region tightly.
+            auto origin = region.offset - dataOrigin;
+            size_t rowBytes = region.size.x() * pixelSize;
+            for (uint32_t layer = 0; layer < region.layers; ++layer) {
+                for (uint32_t z = 0; z < region.size.z(); ++z) {
+                    const std::byte* source = data + (region.layerOffset - dataLayerOrigin + layer) * layerStride +
+                                              (origin.z() + z) * sliceStride + origin.x() * pixelSize;
+                    for (uint32_t y = 0; y < region.size.y(); ++y) {
+                        memcpy(staging + cursor, source + (origin.y() + y) * rowStride, rowBytes);
+                        cursor += rowBytes;
+                    }
+                }
+            }
+        }
+
+        return std::move(staged);
+    }
+
+    Result<void, std::string> VKSimpleTexture::uploadRegions(const std::byte* data, rush::Vec3ui dataOrigin,
+                                                             rush::Vec3ui dataSize, uint32_t dataLayerOrigin,
+                                                             const std::vector<TextureUpdateRegion>& regions,
+                                                             MipmapRegeneration mipmaps, CommandBuffer* commandBuffer)
+    {
+        if (hasPendingUpload()) {
+            return {"Texture has a pending asynchronous upload."};
+        }
+
+        auto result = stageRegions(data, dataOrigin, dataSize, dataLayerOrigin, regions);
+        if (!result.isOk()) {
+            return {result.getError()};
+        }
+        auto& staged = result.getResult();
+        if (staged.copies.empty()) {
+            return {};
         }
 
         CommandPoolHolder holder;
@@ -239,21 +399,26 @@ namespace neon::vulkan
             commandBuffer = holder.getPool().beginCommandBuffer(true);
         }
 
-        size_t bytesSize = size.x() * size.y() * size.z() * layers * vc::pixelSize(_info.format);
-        SimpleBuffer buffer(getApplication(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, 0, bytesSize);
-        {
-            auto map = buffer.map<std::byte>(commandBuffer);
-            if (!map.has_value()) {
-                return {"Error mapping buffer."};
-            }
-            memcpy(map.value()->raw(), data, bytesSize);
-        }
-
         VkCommandBuffer rawBuffer = commandBuffer->getImplementation().getCommandBuffer();
+        auto run = commandBuffer->getCurrentRun();
+
         transitionLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, rawBuffer);
-        vulkan_util::copyBufferToImage(buffer.getRaw(commandBuffer->getCurrentRun()), _image, offset.cast<int32_t>(),
-                                       size, layerOffset, layers, rawBuffer);
-        generateMipmaps(rawBuffer);
+        vulkan_util::copyBufferToImage(staged.allocation.getBuffer()->getRaw(run), _image, staged.copies, rawBuffer);
+        getApplication()->getStagingAllocator()->release(staged.allocation, run);
+
+        switch (mipmaps) {
+            case MipmapRegeneration::NONE:
+                transitionLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, rawBuffer);
+                break;
+            case MipmapRegeneration::REGIONS:
+                vulkan_util::generateMipmapRegions(_image, {_info.width, _info.height, _info.depth}, _info.mipmaps,
+                                                   _info.layers, regions, rawBuffer);
+                _currentLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+                break;
+            case MipmapRegeneration::FULL:
+                generateMipmaps(rawBuffer);
+                break;
+        }
 
         if (holder.isValid()) {
             commandBuffer->end();
@@ -263,6 +428,63 @@ namespace neon::vulkan
         return {};
     }
 
+    Result<void, std::string> VKSimpleTexture::updateData(const void* data, rush::Vec3ui offset, rush::Vec3ui size,
+                                                          uint32_t layerOffset, uint32_t layers,
+                                                          CommandBuffer* commandBuffer)
+    {
+        // The data only contains the updated region.
+        std::vector<TextureUpdateRegion> regions = {{offset, size, layerOffset, layers}};
+        return uploadRegions(static_cast<const std::byte*>(data), offset, size, layerOffset, regions,
+                             MipmapRegeneration::FULL, commandBuffer);
+    }
+
+    Result<void, std::string> VKSimpleTexture::updateRegions(const void* data, rush::Vec3ui dataSize,
+                                                             const std::vector<TextureUpdateRegion>& regions,
+                                                             MipmapRegeneration mipmaps, CommandBuffer* commandBuffer)
+    {
+        return uploadRegions(static_cast<const std::byte*>(data), rush::Vec3ui(0), dataSize, 0, regions, mipmaps,
+                             commandBuffer);
+    }
+
+    Result<std::shared_ptr<Task<void>>, std::string> VKSimpleTexture::updateDataAsync(const void* data,
+                                                                                     rush::Vec3ui offset,
+                                                                                     rush::Vec3ui size,
+                                                                                     uint32_t layerOffset,
+                                                                                     uint32_t layers)
+    {
+        std::vector<TextureUpdateRegion> regions = {{offset, size, layerOffset, layers}};
+        auto result = stageRegions(static_cast<const std::byte*>(data), offset, size, layerOffset, regions);
+        if (!result.isOk()) {
+            return {result.getError()};
+        }
+        auto& staged = result.getResult();
+
+        StreamingUploader::ImageUpload upload;
+        upload.image = _image;
+        upload.range = {VK_IMAGE_ASPECT_COLOR_BIT, 0, _info.mipmaps, 0, _info.layers};
+        upload.oldLayout = _currentLayout;
+        upload.copies = std::move(staged.copies);
+
+        if (_info.mipmaps > 1) {
+            // Blits are not supported by transfer-only queues: mipmaps are generated by the graphics family.
+            upload.finalLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            upload.graphicsWork = [application = getApplication(), image = _image, extent = getDimensions(),
+                                   levels = _info.mipmaps, layers = _info.layers](VkCommandBuffer cmd) {
+                vulkan_util::generateMipmaps(application, image, extent.x(), extent.y(), extent.z(), levels, layers,
+                                             cmd);
+            };
+        } else {
+            upload.finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        }
+        // The batch is submitted later. Synchronous operations are refused until the upload finishes,
+        // so they never record commands assuming this layout before the upload is executed.
+        _currentLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+        _pendingUpload =
+            getApplication()->getStreamingUploader()->uploadImage(*this, std::move(upload), staged.allocation);
+        return _pendingUpload;
+    }
+
     VkImage VKSimpleTexture::vk() const
     {
         return _image;
@@ -9,6 +9,8 @@
 #include <neon/render/texture/TextureCreateInfo.h>
 #include <vma/vk_mem_alloc.h>
 #include <vulkan/VKResource.h>
+#include <vulkan/render/buffer/ReadbackRing.h>
+#include <vulkan/render/buffer/StagingAllocator.h>
 
 namespace neon::vulkan
 {
@@ -18,18 +20,42 @@ namespace neon::vulkan
         public TextureCapabilityRead,
         public TextureCapabilityModifiable
     {
+        struct StagedRegions
+        {
+            StagingAllocator::Allocation allocation;
+            std::vector<VkBufferImageCopy> copies;
+        };
+
         VkImage _image;
         VmaAllocation _allocation;
         TextureCreateInfo _info;
 
+        // The layout the image has once all recorded commands have been executed,
+        // including the pending asynchronous upload.
         mutable VkImageLayout _currentLayout;
 
+        std::unique_ptr<ReadbackRing> _readbackRing;
+
+        // The task of the last asynchronous upload.
+        std::shared_ptr<Task<void>> _pendingUpload;
+
+        [[nodiscard]] bool hasPendingUpload() const;
+
         void transitionLayout(VkImageLayout layout, VkCommandBuffer commandBuffer) const;
 
         void uploadData(const std::byte* data, CommandBuffer* commandBuffer);
 
         void generateMipmaps(VkCommandBuffer buffer);
 
+        Result<StagedRegions, std::string> stageRegions(const std::byte* data, rush::Vec3ui dataOrigin,
+                                                        rush::Vec3ui dataSize, uint32_t dataLayerOrigin,
+                                                        const std::vector<TextureUpdateRegion>& regions) const;
+
+        Result<void, std::string> uploadRegions(const std::byte* data, rush::Vec3ui dataOrigin, rush::Vec3ui dataSize,
+                                                uint32_t dataLayerOrigin,
+                                                const std::vector<TextureUpdateRegion>& regions,
+                                                MipmapRegeneration mipmaps, CommandBuffer* commandBuffer);
+
       public:
         VKSimpleTexture(Application* application, std::string name, const TextureCreateInfo& info,
                         const std::byte* data, CommandBuffer* commandBuffer = nullptr);
@@ -61,12 +87,28 @@ namespace neon::vulkan
         Result<void, std::string> readData(void* data, rush::Vec3ui offset, rush::Vec3ui size,
                                            uint32_t layerOffset, uint32_t layers) const override;
 
+        [[nodiscard]] std::shared_ptr<Task<Result<std::vector<std::byte>, std::string>>> readDataAsync(
+            rush::Vec3ui offset, rush::Vec3ui size, uint32_t layerOffset, uint32_t layers) const override;
+
         Result<void, std::string> updateData(const void* data, rush::Vec3ui offset, rush::Vec3ui size,
                                              uint32_t layerOffset, uint32_t layers,
                                              CommandBuffer* commandBuffer) override;
 
+        Result<void, std::string> updateRegions(const void* data, rush::Vec3ui dataSize,
+                                                const std::vector<TextureUpdateRegion>& regions,
+                                                MipmapRegeneration mipmaps, CommandBuffer* commandBuffer) override;
+
+        Result<std::shared_ptr<Task<void>>, std::string> updateDataAsync(const void* data, rush::Vec3ui offset,
+                                                                        rush::Vec3ui size, uint32_t layerOffset,
+                                                                        uint32_t layers) override;
+
         [[nodiscard]] VkImage vk() const;
 
+        /**
+         * Returns the layout of the image.
+         * If an asynchronous upload is pending, this is the layout the image will have once it finishes.
+         * @return the layout.
+         */
         [[nodiscard]] VkImageLayout vkLayout() const;
     };
 } // namespace neon::vulkan
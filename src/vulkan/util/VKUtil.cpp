@@ -4,10 +4,13 @@
 
 #include "VKUtil.h"
 
+#include <algorithm>
 #include <stdexcept>
 
 #include <neon/render/model/InputDescription.h>
 #include <neon/render/buffer/FrameBuffer.h>
+#include <neon/render/texture/Texture.h>
+#include <neon/render/texture/MipmapBlit.h>
 #include <vulkan/AbstractVKApplication.h>
 #include <vulkan/util/VulkanConversions.h>
 #include <vulkan/render/VKRenderPass.h>
@@ -93,6 +96,36 @@ namespace neon::vulkan::vulkan_util
                              VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr, 1, &memoryBarrier, 0, nullptr);
     }
 
+    void copyBuffer(VkCommandBuffer commandBuffer, VkBuffer source, VkBuffer destiny,
+                    const std::vector<VkBufferCopy>& regions)
+    {
+        if (regions.empty()) {
+            return;
+        }
+
+        vkCmdCopyBuffer(commandBuffer, source, destiny, static_cast<uint32_t>(regions.size()), regions.data());
+
+        VkDeviceSize from = regions.front().dstOffset;
+        VkDeviceSize to = regions.front().dstOffset + regions.front().size;
+        for (auto& region : regions) {
+            from = std::min(from, region.dstOffset);
+            to = std::max(to, region.dstOffset + region.size);
+        }
+
+        VkBufferMemoryBarrier memoryBarrier = {.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+                                               .pNext = nullptr,
+                                               .srcAccessMask = VK_ACCESS_HOST_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT,
+                                               .dstAccessMask = VK_ACCESS_SHADER_READ_BIT,
+                                               .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                               .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                               .buffer = destiny,
+                                               .offset = from,
+                                               .size = to - from};
+
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_HOST_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr, 1, &memoryBarrier, 0, nullptr);
+    }
+
     std::pair<VkImage, VkDeviceMemory> createImage(VkDevice device, VkPhysicalDevice physicalDevice,
                                                    const TextureCreateInfo& info, TextureViewType viewType,
                                                    VkFormat override)
@@ -250,6 +283,16 @@ namespace neon::vulkan::vulkan_util
         vkCmdCopyBufferToImage(commandBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
     }
 
+    void copyBufferToImage(VkBuffer buffer, VkImage image, const std::vector<VkBufferImageCopy>& regions,
+                           VkCommandBuffer commandBuffer)
+    {
+        if (regions.empty()) {
+            return;
+        }
+        vkCmdCopyBufferToImage(commandBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                               static_cast<uint32_t>(regions.size()), regions.data());
+    }
+
     void copyImageToBuffer(VkBuffer buffer, VkImage image, rush::Vec3i offset, rush::Vec3ui size,
                            uint32_t layerOffset, uint32_t layers, VkCommandBuffer commandBuffer)
     {
@@ -271,6 +314,19 @@ namespace neon::vulkan::vulkan_util
         };
 
         vkCmdCopyImageToBuffer(commandBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, buffer, 1, &region);
+
+        VkBufferMemoryBarrier memoryBarrier = {.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+                                               .pNext = nullptr,
+                                               .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+                                               .dstAccessMask = VK_ACCESS_HOST_READ_BIT,
+                                               .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                               .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                               .buffer = buffer,
+                                               .offset = 0,
+                                               .size = VK_WHOLE_SIZE};
+
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr,
+                             1, &memoryBarrier, 0, nullptr);
     }
 
     void generateMipmaps(AbstractVKApplication* application, VkImage image, uint32_t width, uint32_t height,
@@ -344,6 +400,90 @@ namespace neon::vulkan::vulkan_util
                              nullptr, 0, nullptr, 1, &barrier);
     }
 
+    void generateMipmapRegions(VkImage image, rush::Vec3ui dimensions, uint32_t levels, uint32_t layers,
+                               std::vector<TextureUpdateRegion> regions, VkCommandBuffer commandBuffer)
+    {
+        VkImageMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.image = image;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount = layers;
+        barrier.subresourceRange.levelCount = 1;
+
+        std::vector<VkImageBlit> blits;
+        blits.reserve(regions.size());
+
+        rush::Vec3ui source = dimensions;
+        for (uint32_t i = 1; i < levels; i++) {
+            rush::Vec3ui destination = nextMipmapSize(source);
+
+            barrier.subresourceRange.baseMipLevel = i - 1;
+            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                                 nullptr, 0, nullptr, 1, &barrier);
+
+            blits.clear();
+            for (auto& region : regions) {
+                VkImageBlit blit{};
+                blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+                blit.srcSubresource.mipLevel = i - 1;
+                blit.srcSubresource.baseArrayLayer = region.layerOffset;
+                blit.srcSubresource.layerCount = region.layers;
+                blit.dstSubresource = blit.srcSubresource;
+                blit.dstSubresource.mipLevel = i;
+
+                auto box = computeMipmapBlitBox(source, destination, region.offset, region.size);
+
+                auto offset = [](const rush::Vec3ui& v) {
+                    return VkOffset3D{static_cast<int32_t>(v.x()), static_cast<int32_t>(v.y()),
+                                      static_cast<int32_t>(v.z())};
+                };
+
+                blit.srcOffsets[0] = offset(box.sourceFrom);
+                blit.srcOffsets[1] = offset(box.sourceTo);
+                blit.dstOffsets[0] = offset(box.destinationFrom);
+                blit.dstOffsets[1] = offset(box.destinationTo);
+
+                region.offset = box.destinationFrom;
+                region.size = rush::Vec3ui(box.destinationTo.x() - box.destinationFrom.x(),
+                                           box.destinationTo.y() - box.destinationFrom.y(),
+                                           box.destinationTo.z() - box.destinationFrom.z());
+
+                blits.push_back(blit);
+            }
+
+            vkCmdBlitImage(commandBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, image,
+                           VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32_t>(blits.size()), blits.data(),
+                           VK_FILTER_LINEAR);
+
+            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                                 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+            source = destination;
+        }
+
+        barrier.subresourceRange.baseMipLevel = levels - 1;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0,
+                             nullptr, 0, nullptr, 1, &barrier);
+    }
+
     std::optional<size_t> findSupportedFormat(VkPhysicalDevice physicalDevice, const std::vector<VkFormat>& candidates,
                                               VkImageTiling tiling, VkFormatFeatureFlags features)
     {
@@ -18,6 +18,8 @@ namespace neon
 {
     struct InputDescription;
 
+    struct TextureUpdateRegion;
+
     class FrameBuffer;
 } // namespace neon
 
@@ -35,6 +37,13 @@ namespace neon::vulkan::vulkan_util
     void copyBuffer(VkCommandBuffer commandBuffer, VkBuffer source, VkBuffer destiny, VkDeviceSize sourceOffset,
                     VkDeviceSize destinyOffset, VkDeviceSize size);
 
+    /**
+     * Copies several regions between two buffers using a single copy command.
+     * A single barrier covering all regions is recorded after the copy.
+     */
+    void copyBuffer(VkCommandBuffer commandBuffer, VkBuffer source, VkBuffer destiny,
+                    const std::vector<VkBufferCopy>& regions);
+
     std::pair<VkImage, VkDeviceMemory> createImage(VkDevice device, VkPhysicalDevice physicalDevice,
                                                    const TextureCreateInfo& info, TextureViewType viewType,
                                                    VkFormat override = VK_FORMAT_UNDEFINED);
@@ -45,12 +54,33 @@ namespace neon::vulkan::vulkan_util
     void copyBufferToImage(VkBuffer buffer, VkImage image, rush::Vec3i offset, rush::Vec3ui size, uint32_t baseLayer,
                            uint32_t layers, VkCommandBuffer commandBuffer);
 
+    /**
+     * Copies several regions from a buffer to the first level of an image using a single copy command.
+     * The image must be in the VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL layout.
+     */
+    void copyBufferToImage(VkBuffer buffer, VkImage image, const std::vector<VkBufferImageCopy>& regions,
+                           VkCommandBuffer commandBuffer);
+
+    /**
+     * Copies a region of the first level of an image to the start of a buffer.
+     * The image must be in the VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL layout.
+     * A barrier making the copied data available to the host is recorded after the copy.
+     */
     void copyImageToBuffer(VkBuffer buffer, VkImage image, rush::Vec3i offset, rush::Vec3ui size,
                            uint32_t layerOffset, uint32_t layers, VkCommandBuffer commandBuffer);
 
     void generateMipmaps(AbstractVKApplication* application, VkImage image, uint32_t width, uint32_t height,
                          uint32_t depth, uint32_t levels, uint32_t layers, VkCommandBuffer commandBuffer);
 
+    /**
+     * Regenerates only the texels of each mipmap level derived from the given regions of the first level.
+     * <p>
+     * Like generateMipmaps(), all levels must be in the VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL layout,
+     * and they are transitioned to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL.
+     */
+    void generateMipmapRegions(VkImage image, rush::Vec3ui dimensions, uint32_t levels, uint32_t layers,
+                               std::vector<TextureUpdateRegion> regions, VkCommandBuffer commandBuffer);
+
     std::optional<size_t> findSupportedFormat(VkPhysicalDevice physicalDevice, const std::vector<VkFormat>& candidates,
                                               VkImageTiling tiling, VkFormatFeatureFlags features);
 
@@ -0,0 +1,126 @@
+#include <array>
+#include <cstdint>
+
+#include <catch2/catch_all.hpp>
+
+#include <vulkan/render/VKBindStateTracker.h>
+
+using neon::vulkan::VKBindStateTracker;
+using neon::vulkan::VKBindType;
+
+namespace
+{
+    // Fake handles. The tracker only compares them.
+    template<typename Handle>
+    Handle handle(uintptr_t value)
+    {
+        return reinterpret_cast<Handle>(value);
+    }
+} // namespace
+
+TEST_CASE("Bind state tracker elides repeated pipelines")
+{
+    VKBindStateTracker tracker;
+    auto a = handle<VkPipeline>(1);
+    auto b = handle<VkPipeline>(2);
+
+    REQUIRE(tracker.trackPipeline(a));
+    REQUIRE_FALSE(tracker.trackPipeline(a));
+    REQUIRE(tracker.trackPipeline(b));
+    REQUIRE(tracker.trackPipeline(a));
+
+    REQUIRE(tracker.getIssuedBinds(VKBindType::PIPELINE) == 3);
+    REQUIRE(tracker.getElidedBinds(VKBindType::PIPELINE) == 1);
+
+    // Invalidating forgets the state, but not the statistics.
+    tracker.invalidate();
+    REQUIRE(tracker.trackPipeline(a));
+    REQUIRE(tracker.getIssuedBinds() == 4);
+    REQUIRE(tracker.getElidedBinds() == 1);
+
+    tracker.resetStatistics();
+    REQUIRE(tracker.getIssuedBinds() == 0);
+    REQUIRE(tracker.getElidedBinds() == 0);
+    REQUIRE_FALSE(tracker.trackPipeline(a));
+}
+
+TEST_CASE("Bind state tracker compares vertex buffers and offsets")
+{
+    VKBindStateTracker tracker;
+    std::array buffers = {handle<VkBuffer>(1), handle<VkBuffer>(2)};
+    std::array<VkDeviceSize, 2> offsets = {0, 64};
+
+    REQUIRE(tracker.trackVertexBuffers(2, buffers.data(), offsets.data()));
+    REQUIRE_FALSE(tracker.trackVertexBuffers(2, buffers.data(), offsets.data()));
+
+    // Binding a prefix of the current bindings is redundant.
+    REQUIRE_FALSE(tracker.trackVertexBuffers(1, buffers.data(), offsets.data()));
+
+    offsets[1] = 128;
+    REQUIRE(tracker.trackVertexBuffers(2, buffers.data(), offsets.data()));
+
+    buffers[0] = handle<VkBuffer>(3);
+    REQUIRE(tracker.trackVertexBuffers(1, buffers.data(), offsets.data()));
+    REQUIRE_FALSE(tracker.trackVertexBuffers(2, buffers.data(), offsets.data()));
+
+    REQUIRE(tracker.getIssuedBinds(VKBindType::VERTEX_BUFFERS) == 3);
+    REQUIRE(tracker.getElidedBinds(VKBindType::VERTEX_BUFFERS) == 3);
+}
+
+TEST_CASE("Bind state tracker compares index buffers")
+{
+    VKBindStateTracker tracker;
+    auto buffer = handle<VkBuffer>(1);
+
+    REQUIRE(tracker.trackIndexBuffer(buffer, 0, VK_INDEX_TYPE_UINT32));
+    REQUIRE_FALSE(tracker.trackIndexBuffer(buffer, 0, VK_INDEX_TYPE_UINT32));
+    REQUIRE(tracker.trackIndexBuffer(buffer, 16, VK_INDEX_TYPE_UINT32));
+    REQUIRE(tracker.trackIndexBuffer(buffer, 16, VK_INDEX_TYPE_UINT16));
+
+    REQUIRE(tracker.getIssuedBinds(VKBindType::INDEX_BUFFER) == 3);
+    REQUIRE(tracker.getElidedBinds(VKBindType::INDEX_BUFFER) == 1);
+}
+
+TEST_CASE("Bind state tracker compares push constant contents")
+{
+    VKBindStateTracker tracker;
+    auto layout = handle<VkPipelineLayout>(1);
+    std::array<uint32_t, 4> data = {1, 2, 3, 4};
+
+    REQUIRE(tracker.trackPushConstants(layout, VK_SHADER_STAGE_VERTEX_BIT, data.data(), sizeof(data)));
+
+    // The same contents in a different memory location are redundant.
+    auto copy = data;
+    REQUIRE_FALSE(tracker.trackPushConstants(layout, VK_SHADER_STAGE_VERTEX_BIT, copy.data(), sizeof(copy)));
+
+    copy[3] = 5;
+    REQUIRE(tracker.trackPushConstants(layout, VK_SHADER_STAGE_VERTEX_BIT, copy.data(), sizeof(copy)));
+    REQUIRE(tracker.trackPushConstants(layout, VK_SHADER_STAGE_FRAGMENT_BIT, copy.data(), sizeof(copy)));
+    REQUIRE(tracker.trackPushConstants(layout, VK_SHADER_STAGE_FRAGMENT_BIT, copy.data(), sizeof(uint32_t)));
+
+    REQUIRE(tracker.getIssuedBinds(VKBindType::PUSH_CONSTANTS) == 4);
+    REQUIRE(tracker.getElidedBinds(VKBindType::PUSH_CONSTANTS) == 1);
+}
+
+TEST_CASE("Bind state tracker resets descriptor sets when the layout changes")
+{
+    VKBindStateTracker tracker;
+    auto layout = handle<VkPipelineLayout>(1);
+    auto other = handle<VkPipelineLayout>(2);
+    auto set = handle<VkDescriptorSet>(10);
+
+    REQUIRE(tracker.trackDescriptorSet(layout, 0, set));
+    REQUIRE_FALSE(tracker.trackDescriptorSet(layout, 0, set));
+    REQUIRE(tracker.trackDescriptorSet(layout, 1, set));
+
+    // Sets bound using another layout are disturbed.
+    REQUIRE(tracker.trackDescriptorSet(other, 0, set));
+    REQUIRE(tracker.trackDescriptorSet(other, 1, set));
+
+    // Sets outside the tracked range are always recorded.
+    REQUIRE(tracker.trackDescriptorSet(other, 100, set));
+    REQUIRE(tracker.trackDescriptorSet(other, 100, set));
+
+    REQUIRE(tracker.getIssuedBinds(VKBindType::DESCRIPTOR_SET) == 6);
+    REQUIRE(tracker.getElidedBinds(VKBindType::DESCRIPTOR_SET) == 1);
+}
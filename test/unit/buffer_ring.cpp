@@ -0,0 +1,88 @@
+#include <memory>
+
+#include <catch2/catch_all.hpp>
+
+#include <neon/util/BufferRing.h>
+
+namespace
+{
+    struct TestBuffer
+    {
+        size_t bytes;
+
+        [[nodiscard]] size_t size() const
+        {
+            return bytes;
+        }
+    };
+
+    using Ring = neon::BufferRing<TestBuffer>;
+
+    Ring::Factory factory(size_t* created)
+    {
+        return [created](size_t size) {
+            ++*created;
+            return std::make_shared<TestBuffer>(size);
+        };
+    }
+} // namespace
+
+TEST_CASE("Buffer ring reuses free buffers")
+{
+    size_t created = 0;
+    Ring ring(factory(&created), 2);
+
+    auto first = ring.acquire(100);
+    REQUIRE(first->size() == 100);
+    first.reset();
+
+    // Smaller requests reuse the free buffer.
+    auto second = ring.acquire(50);
+    REQUIRE(second->size() == 100);
+    REQUIRE(created == 1);
+    REQUIRE(ring.getBufferAmount() == 1);
+}
+
+TEST_CASE("Buffer ring never shares buffers in use")
+{
+    size_t created = 0;
+    Ring ring(factory(&created), 2);
+
+    auto first = ring.acquire(100);
+    auto second = ring.acquire(100);
+    REQUIRE(first != second);
+    REQUIRE(ring.getBufferAmount() == 2);
+
+    // The ring is full: a temporary buffer is returned.
+    auto third = ring.acquire(100);
+    REQUIRE(third != first);
+    REQUIRE(third != second);
+    REQUIRE(ring.getBufferAmount() == 2);
+    REQUIRE(ring.getAllocatedMemory() == 200);
+
+    // Temporary buffers are not pooled.
+    third.reset();
+    second.reset();
+    auto fourth = ring.acquire(100);
+    REQUIRE(created == 3);
+    REQUIRE(ring.getBufferAmount() == 2);
+}
+
+TEST_CASE("Buffer ring replaces free buffers that are too small")
+{
+    size_t created = 0;
+    Ring ring(factory(&created), 1);
+
+    ring.acquire(100).reset();
+    REQUIRE(ring.getAllocatedMemory() == 100);
+
+    auto big = ring.acquire(400);
+    REQUIRE(big->size() == 400);
+    REQUIRE(ring.getBufferAmount() == 1);
+    REQUIRE(ring.getAllocatedMemory() == 400);
+
+    // The replaced buffer is pooled.
+    auto* pooled = big.get();
+    big.reset();
+    REQUIRE(ring.acquire(200).get() == pooled);
+}
@@ -3,10 +3,12 @@
 //
 
 #include <iostream>
+#include <numeric>
 #include <random>
 #include <catch2/catch_all.hpp>
 #include <glm/detail/type_vec2.hpp>
 #include <neon/util/ClusteredLinkedCollection.h>
+#include <neon/util/ClusteredHandle.h>
 
 TEST_CASE("Clustered linked collection init", "[clustered_linked_collection]")
 {
@@ -197,3 +199,175 @@ TEST_CASE("Clustered linked collection move 2", "[clustered_linked_collection]")
     REQUIRE(copy.size() == 100);
     REQUIRE(collection.empty());
 }
+
+TEST_CASE("Clustered linked collection clusters", "[clustered_linked_collection]")
+{
+    neon::ClusteredLinkedCollection<int, 10> collection;
+    REQUIRE(collection.getClusterAmount() == 1);
+
+    for (int i = 0; i < 35; i++) {
+        collection.push(i);
+    }
+
+    REQUIRE(collection.getClusterAmount() == 4);
+
+    size_t amount = 0;
+    int sum = 0;
+    for (size_t cluster = 0; cluster < collection.getClusterAmount(); ++cluster) {
+        collection.forEachRawInCluster(cluster, [&](void* ptr) {
+            ++amount;
+            sum += *static_cast<int*>(ptr);
+        });
+    }
+
+    REQUIRE(amount == 35);
+    REQUIRE(sum == 34 * 35 / 2);
+}
+
+TEST_CASE("Clustered linked collection reuses free slots", "[clustered_linked_collection]")
+{
+    neon::ClusteredLinkedCollection<int, 100> collection;
+    std::vector<int*> pointers;
+
+    for (int i = 0; i < 1000; i++) {
+        pointers.push_back(collection.push(i));
+    }
+    REQUIRE(collection.getClusterAmount() == 10);
+
+    for (size_t i = 0; i < pointers.size(); i += 3) {
+        REQUIRE(collection.erase(pointers[i]));
+    }
+    REQUIRE_FALSE(collection.erase(pointers[0]));
+
+    size_t erased = (pointers.size() + 2) / 3;
+    for (size_t i = 0; i < erased; i++) {
+        collection.push(-1);
+    }
+
+    REQUIRE(collection.size() == 1000);
+    REQUIRE(collection.getClusterAmount() == 10);
+    REQUIRE(std::distance(collection.begin(), collection.end()) == 1000);
+}
+
+TEST_CASE("Clustered linked collection destroys before releasing slots", "[clustered_linked_collection]")
+{
+    struct Spawner
+    {
+        neon::ClusteredLinkedCollection<Spawner, 4>* collection;
+        int value;
+        Spawner** spawned;
+
+        ~Spawner()
+        {
+            if (spawned != nullptr) {
+                *spawned = collection->emplace(collection, value + 1, nullptr);
+            }
+        }
+    };
+
+    neon::ClusteredLinkedCollection<Spawner, 4> collection;
+    Spawner* spawned = nullptr;
+    auto* element = collection.emplace(&collection, 1, &spawned);
+
+    // The element's slot is still in use while its destructor runs.
+    REQUIRE(collection.erase(element));
+    REQUIRE(spawned != nullptr);
+    REQUIRE(spawned != element);
+    REQUIRE(spawned->value == 2);
+    REQUIRE(collection.size() == 1);
+}
+
+TEST_CASE("Clustered handle", "[clustered_linked_collection]")
+{
+    struct Base
+    {
+        virtual ~Base() = default;
+        int base = 1;
+    };
+
+    struct Other
+    {
+        int other = 2;
+    };
+
+    struct Derived : Other, Base
+    {
+    };
+
+    neon::ClusteredLinkedCollection<Derived, 4> collection;
+    std::vector<Derived*> elements;
+    for (int i = 0; i < 10; i++) {
+        elements.push_back(collection.emplace());
+    }
+
+    neon::ClusteredHandle<Derived> handle(collection, elements[5]);
+    neon::ClusteredHandle<Base> baseHandle = handle;
+    REQUIRE(handle.get() == elements[5]);
+    REQUIRE(baseHandle.get() == static_cast<Base*>(elements[5]));
+    REQUIRE(baseHandle->base == 1);
+
+    collection.erase(elements[5]);
+    REQUIRE_FALSE(handle.isValid());
+    REQUIRE(baseHandle.get() == nullptr);
+
+    // The slot is reused, but the old handles must stay invalid.
+    auto* reused = collection.emplace();
+    REQUIRE(reused == elements[5]);
+    REQUIRE_FALSE(handle.isValid());
+
+    neon::ClusteredHandle<Derived> newHandle(collection, reused);
+    REQUIRE(newHandle.isValid());
+    REQUIRE(newHandle != handle);
+
+    collection.clear();
+    REQUIRE_FALSE(newHandle.isValid());
+    REQUIRE_FALSE(neon::ClusteredHandle<Base>().isValid());
+}
+
+TEST_CASE("Clustered linked collection benchmark", "[clustered_linked_collection][benchmark]")
+{
+    auto amount = GENERATE(10000, 100000, 1000000);
+
+    std::vector<size_t> churnIndices(amount / 2);
+    std::iota(churnIndices.begin(), churnIndices.end(), 0);
+    std::ranges::shuffle(churnIndices, std::mt19937());
+    for (auto& index : churnIndices) {
+        index *= 2;
+    }
+
+    neon::ClusteredLinkedCollection<int> collection;
+    std::vector<int*> pointers;
+    pointers.reserve(amount);
+    for (int i = 0; i < amount; i++) {
+        pointers.push_back(collection.push(i));
+    }
+
+    BENCHMARK("Insert " + std::to_string(amount))
+    {
+        neon::ClusteredLinkedCollection<int> inserted;
+        for (int i = 0; i < amount; i++) {
+            inserted.push(i);
+        }
+        return inserted.size();
+    };
+
+    BENCHMARK("Erase and insert churn " + std::to_string(amount))
+    {
+        for (size_t index : churnIndices) {
+            collection.erase(pointers[index]);
+        }
+        for (size_t index : churnIndices) {
+            pointers[index] = collection.push(static_cast<int>(index));
+        }
+        return collection.size();
+    };
+
+    BENCHMARK("Iterate " + std::to_string(amount))
+    {
+        int64_t sum = 0;
+        for (int value : collection) {
+            sum += value;
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,109 @@
+#include <catch2/catch_all.hpp>
+
+#include <neon/structure/Component.h>
+#include <neon/structure/collection/ComponentCollection.h>
+#include <neon/util/profile/Profiler.h>
+#include <neon/util/task/TaskRunner.h>
+
+namespace
+{
+    class CounterComponent : public neon::Component
+    {
+      public:
+        size_t updates = 0;
+        size_t lateUpdates = 0;
+
+        void onUpdate(float deltaTime) override
+        {
+            ++updates;
+        }
+
+        void onLateUpdate(float deltaTime) override
+        {
+            ++lateUpdates;
+        }
+    };
+
+    class ParallelCounterComponent : public CounterComponent
+    {
+      public:
+        static constexpr bool PARALLEL_UPDATE = true;
+        static constexpr bool PARALLEL_LATE_UPDATE = true;
+    };
+} // namespace
+
+TEST_CASE("Component collection update", "[component_collection]")
+{
+    constexpr size_t COMPONENTS = 2000;
+    constexpr size_t FRAMES = 3;
+
+    neon::Profiler profiler;
+    neon::TaskRunner runner;
+    neon::ComponentCollection collection;
+
+    std::vector<neon::IdentifiableWrapper<CounterComponent>> serial;
+    std::vector<neon::IdentifiableWrapper<ParallelCounterComponent>> parallel;
+    for (size_t i = 0; i < COMPONENTS; ++i) {
+        serial.push_back(collection.newComponent<CounterComponent>());
+        parallel.push_back(collection.newComponent<ParallelCounterComponent>());
+    }
+
+    serial.front()->setEnabled(false);
+    parallel.front()->setEnabled(false);
+
+    for (size_t i = 0; i < FRAMES; ++i) {
+        collection.updateComponents(profiler, runner, 0.0f);
+        collection.lateUpdateComponents(profiler, runner, 0.0f);
+    }
+
+    REQUIRE(serial.front()->updates == 0);
+    REQUIRE(parallel.front()->updates == 0);
+
+    bool allUpdated = true;
+    for (size_t i = 1; i < COMPONENTS; ++i) {
+        allUpdated &= serial[i]->updates == FRAMES && serial[i]->lateUpdates == FRAMES;
+        allUpdated &= parallel[i]->updates == FRAMES && parallel[i]->lateUpdates == FRAMES;
+    }
+    REQUIRE(allUpdated);
+}
+
+TEST_CASE("Component collection update benchmark", "[component_collection][benchmark]")
+{
+    constexpr size_t COMPONENTS = 100000;
+
+    neon::Profiler profiler;
+    neon::TaskRunner runner;
+    neon::ComponentCollection serial;
+    neon::ComponentCollection parallel;
+
+    for (size_t i = 0; i < COMPONENTS; ++i) {
+        serial.newComponent<CounterComponent>();
+        parallel.newComponent<ParallelCounterComponent>();
+    }
+
+    // Starts the components.
+    serial.updateComponents(profiler, runner, 0.0f);
+    parallel.updateComponents(profiler, runner, 0.0f);
+
+    auto components = serial.getComponentsOfType<CounterComponent>();
+
+    BENCHMARK("Type-erased virtual update")
+    {
+        components->forEachRaw([](void* ptr) {
+            auto* component = static_cast<neon::Component*>(static_cast<CounterComponent*>(ptr));
+            if (component->isEnabled() && component->hasStarted()) {
+                component->onUpdate(0.0f);
+            }
+        });
+    };
+
+    BENCHMARK("Typed update")
+    {
+        serial.updateComponents(profiler, runner, 0.0f);
+    };
+
+    BENCHMARK("Parallel typed update")
+    {
+        parallel.updateComponents(profiler, runner, 0.0f);
+    };
+}
@@ -117,3 +117,164 @@ TEST_CASE("Coroutine cancel", "[coroutine]")
     REQUIRE(task->isCancelled());
     REQUIRE(!task->getResult().has_value());
 }
+
+neon::Coroutine<int> awaitTask(std::shared_ptr<neon::Task<int>> task)
+{
+    std::optional<int> value = co_await task;
+    co_return value.value_or(0) + 1;
+}
+
+neon::Coroutine<> awaitForever(std::shared_ptr<neon::Task<void>> task)
+{
+    co_await task;
+}
+
+neon::Coroutine<> pollForever()
+{
+    while (true) {
+        co_yield neon::WaitUntil([] { return false; });
+    }
+}
+
+neon::Coroutine<> sleep(float seconds)
+{
+    co_yield neon::WaitForSeconds(seconds);
+}
+
+neon::Coroutine<std::thread::id> awaitOnWorker(neon::TaskRunner* runner)
+{
+    auto task = runner->executeAsync([] { return std::this_thread::get_id(); });
+    co_await task;
+    co_return std::this_thread::get_id();
+}
+
+TEST_CASE("Coroutine await task", "[coroutine]")
+{
+    neon::TaskRunner runner;
+
+    auto gate = std::make_shared<neon::Task<int>>(&runner);
+
+    neon::Coroutine<int> coroutine = awaitTask(gate);
+    auto task = coroutine.asTask();
+    runner.launchCoroutine(std::move(coroutine));
+
+    runner.flushMainThreadTasks(); // co_await
+    runner.flushMainThreadTasks(); // Awaiting coroutines are not resumed.
+    REQUIRE(!task->hasFinished());
+
+    gate->setResult(41);
+    REQUIRE(!task->hasFinished()); // Main thread coroutines are resumed by flushMainThreadTasks.
+
+    runner.flushMainThreadTasks(); // co_return
+    REQUIRE(task->hasFinished());
+    REQUIRE(task->getResult() == 42);
+}
+
+TEST_CASE("Coroutine await on worker", "[coroutine]")
+{
+    neon::TaskRunner runner;
+
+    neon::Coroutine<std::thread::id> coroutine = awaitOnWorker(&runner);
+    auto task = coroutine.asTask();
+    runner.launchCoroutineAsync(std::move(coroutine));
+
+    // No flush is required: the coroutine is resumed by the workers.
+    task->wait();
+    REQUIRE(task->hasFinished());
+    REQUIRE(task->getResult().value() != std::this_thread::get_id());
+}
+
+TEST_CASE("Coroutine wait for seconds", "[coroutine]")
+{
+    neon::TaskRunner runner;
+
+    neon::Coroutine<> coroutine = sleep(0.05f);
+    auto task = coroutine.asTask();
+    runner.launchCoroutine(std::move(coroutine));
+
+    auto start = std::chrono::steady_clock::now();
+    runner.flushMainThreadTasks(); // co_yield
+    runner.flushMainThreadTasks();
+    REQUIRE(!task->hasFinished());
+
+    while (!task->hasFinished()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        runner.flushMainThreadTasks();
+    }
+
+    REQUIRE(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(50));
+}
+
+TEST_CASE("Main thread continuations", "[coroutine]")
+{
+    neon::TaskRunner runner;
+
+    std::atomic_int value = 0;
+    auto task = runner.executeOnMainThread([&value] { value = 1; });
+    auto next = task->then(false, true, [&value] { value = value + 1; });
+
+    runner.flushMainThreadTasks();
+    REQUIRE(next->hasFinished());
+    REQUIRE(value == 2);
+}
+
+TEST_CASE("Coroutine resume benchmark", "[coroutine][benchmark]")
+{
+    constexpr size_t COROUTINES = 10000;
+
+    neon::TaskRunner runner;
+    auto gate = std::make_shared<neon::Task<void>>(&runner);
+
+    SECTION("Awaiting coroutines")
+    {
+        for (size_t i = 0; i < COROUTINES; ++i) {
+            runner.launchCoroutine(awaitForever(gate));
+        }
+        runner.flushMainThreadTasks(); // co_await
+
+        BENCHMARK("Flush with 10k coroutines awaiting a task")
+        {
+            runner.flushMainThreadTasks();
+        };
+    }
+
+    SECTION("Polled coroutines")
+    {
+        for (size_t i = 0; i < COROUTINES; ++i) {
+            runner.launchCoroutine(pollForever());
+        }
+        runner.flushMainThreadTasks(); // co_yield
+
+        BENCHMARK("Flush with 10k coroutines polling a predicate")
+        {
+            runner.flushMainThreadTasks();
+        };
+    }
+
+    SECTION("Sleeping coroutines")
+    {
+        for (size_t i = 0; i < COROUTINES; ++i) {
+            runner.launchCoroutine(sleep(3600.0f));
+        }
+        runner.flushMainThreadTasks(); // co_yield
+
+        BENCHMARK("Flush with 10k coroutines waiting for seconds")
+        {
+            runner.flushMainThreadTasks();
+        };
+    }
+
+    SECTION("Resume latency")
+    {
+        BENCHMARK("Resume an async coroutine after its awaited task finishes")
+        {
+            auto task = std::make_shared<neon::Task<int>>(&runner);
+            neon::Coroutine<int> coroutine = awaitTask(task);
+            auto result = coroutine.asTask();
+            runner.launchCoroutineAsync(std::move(coroutine));
+            task->setResult(1);
+            result->wait();
+            return result->getResult().value();
+        };
+    }
+}
@@ -0,0 +1,124 @@
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <neon/util/DirtyRanges.h>
+#include <neon/util/Range.h>
+
+TEST_CASE("Dirty ranges runs")
+{
+    neon::DirtyRanges ranges(200);
+    REQUIRE(ranges.empty());
+
+    ranges.mark(3);
+    ranges.mark(4);
+    ranges.mark(10);
+    ranges.mark(neon::Range<uint32_t>(60, 130));
+    ranges.mark(199);
+    ranges.mark(500); // Ignored
+
+    std::vector<neon::Range<uint32_t>> runs;
+    ranges.collectRuns(0, runs);
+    REQUIRE(runs.size() == 4);
+    REQUIRE(runs[0].getFrom() == 3);
+    REQUIRE(runs[0].getTo() == 5);
+    REQUIRE(runs[1].getFrom() == 10);
+    REQUIRE(runs[1].getTo() == 11);
+    REQUIRE(runs[2].getFrom() == 60);
+    REQUIRE(runs[2].getTo() == 130);
+    REQUIRE(runs[3].getFrom() == 199);
+    REQUIRE(runs[3].getTo() == 200);
+
+    // The gap between 5 and 10 is 5 indices.
+    ranges.collectRuns(5, runs);
+    REQUIRE(runs.size() == 3);
+    REQUIRE(runs[0].getFrom() == 3);
+    REQUIRE(runs[0].getTo() == 11);
+
+    ranges.collectRuns(1000, runs);
+    REQUIRE(runs.size() == 1);
+    REQUIRE(runs[0].getFrom() == 3);
+    REQUIRE(runs[0].getTo() == 200);
+
+    ranges.clear();
+    REQUIRE(ranges.empty());
+    ranges.collectRuns(0, runs);
+    REQUIRE(runs.empty());
+}
+
+TEST_CASE("Dirty ranges match marked indices")
+{
+    std::mt19937 random(42);
+    neon::DirtyRanges ranges(16384);
+    std::vector<bool> expected(16384, false);
+
+    for (size_t i = 0; i < 2000; ++i) {
+        uint32_t index = random() % 16384;
+        ranges.mark(index);
+        expected[index] = true;
+    }
+
+    std::vector<bool> result(16384, false);
+    uint32_t previousEnd = 0;
+    ranges.forEachRun(0, [&](neon::Range<uint32_t> run) {
+        REQUIRE(run.getFrom() >= previousEnd);
+        previousEnd = run.getTo();
+        for (uint32_t i = run.getFrom(); i < run.getTo(); ++i) {
+            result[i] = true;
+        }
+    });
+
+    REQUIRE(result == expected);
+
+    for (uint32_t i = 0; i < 16384; ++i) {
+        REQUIRE(ranges.isMarked(i) == expected[i]);
+    }
+    REQUIRE_FALSE(ranges.isMarked(20000));
+}
+
+TEST_CASE("Dirty ranges benchmark", "[!benchmark]")
+{
+    constexpr uint32_t INSTANCES = 16384;
+    constexpr size_t INSTANCE_SIZE = 128;
+    auto updates = GENERATE(16, 256, 2048);
+
+    std::vector<char> source(INSTANCES * INSTANCE_SIZE, 1);
+    std::vector<char> destination(INSTANCES * INSTANCE_SIZE, 0);
+
+    std::mt19937 random(42);
+    std::vector<uint32_t> indices(updates);
+    for (auto& index : indices) {
+        index = random() % INSTANCES;
+    }
+
+    // Simulates the upload of the changed instances to a mapped buffer.
+    BENCHMARK("Single range, " + std::to_string(updates) + " scattered updates")
+    {
+        neon::Range<uint32_t> range(0, 0);
+        for (uint32_t index : indices) {
+            range += neon::Range(index, index + 1);
+        }
+        std::memcpy(destination.data() + range.getFrom() * INSTANCE_SIZE,
+                    source.data() + range.getFrom() * INSTANCE_SIZE, range.size() * INSTANCE_SIZE);
+        return range.size();
+    };
+
+    neon::DirtyRanges ranges(INSTANCES);
+    std::vector<neon::Range<uint32_t>> runs;
+
+    BENCHMARK("Dirty runs, " + std::to_string(updates) + " scattered updates")
+    {
+        for (uint32_t index : indices) {
+            ranges.mark(index);
+        }
+        ranges.collectRuns(16, runs);
+        for (auto run : runs) {
+            std::memcpy(destination.data() + run.getFrom() * INSTANCE_SIZE,
+                        source.data() + run.getFrom() * INSTANCE_SIZE, run.size() * INSTANCE_SIZE);
+        }
+        ranges.clear();
+        return runs.size();
+    };
+}
@@ -0,0 +1,96 @@
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <neon/render/DrawList.h>
+
+namespace
+{
+    // The list never dereferences its pointers: fake addresses are enough.
+    template<typename T>
+    T* fake(uintptr_t address)
+    {
+        return reinterpret_cast<T*>(address * 16);
+    }
+
+    std::vector<uintptr_t> materialsOf(const neon::DrawList& list)
+    {
+        std::vector<uintptr_t> result;
+        for (const auto& item : list.getItems()) {
+            result.push_back(reinterpret_cast<uintptr_t>(item.material) / 16);
+        }
+        return result;
+    }
+} // namespace
+
+TEST_CASE("Draw list sorts by priority and groups by material")
+{
+    auto* modelA = fake<neon::Model>(100);
+    auto* modelB = fake<neon::Model>(101);
+    auto* drawable = fake<neon::Drawable>(200);
+
+    neon::DrawList list;
+    list.insert({fake<neon::Material>(2), modelA, drawable, 0});
+    list.insert({fake<neon::Material>(1), modelA, drawable, 0});
+    list.insert({fake<neon::Material>(3), modelA, drawable, 10});
+    list.insert({fake<neon::Material>(2), modelB, drawable, 0});
+    list.insert({fake<neon::Material>(4), modelB, drawable, -5});
+
+    REQUIRE(materialsOf(list) == std::vector<uintptr_t>{3, 1, 2, 2, 4});
+
+    // Items of the same material keep their insertion order.
+    REQUIRE(list.getItems()[2].model == modelA);
+    REQUIRE(list.getItems()[3].model == modelB);
+}
+
+TEST_CASE("Draw list removes the items of a model")
+{
+    auto* modelA = fake<neon::Model>(100);
+    auto* modelB = fake<neon::Model>(101);
+    auto* drawable = fake<neon::Drawable>(200);
+
+    neon::DrawList list;
+    list.insert({fake<neon::Material>(1), modelA, drawable, 0});
+    list.insert({fake<neon::Material>(1), modelB, drawable, 0});
+    list.insert({fake<neon::Material>(2), modelA, drawable, 5});
+
+    size_t removed = 0;
+    list.removeModel(modelA, [&](const neon::DrawList::Item& item) {
+        REQUIRE(item.model == modelA);
+        ++removed;
+    });
+
+    REQUIRE(removed == 2);
+    REQUIRE(list.getItems().size() == 1);
+    REQUIRE(list.getItems()[0].model == modelB);
+
+    list.removeModel(modelB, [](const neon::DrawList::Item&) {});
+    REQUIRE(list.empty());
+}
+
+TEST_CASE("Draw list moves items when a priority changes")
+{
+    auto* modelA = fake<neon::Model>(100);
+    auto* modelB = fake<neon::Model>(101);
+    auto* drawable = fake<neon::Drawable>(200);
+
+    neon::DrawList list;
+    list.insert({fake<neon::Material>(1), modelA, drawable, 10});
+    list.insert({fake<neon::Material>(2), modelA, drawable, 5});
+    list.insert({fake<neon::Material>(2), modelB, drawable, 5});
+    list.insert({fake<neon::Material>(3), modelA, drawable, 0});
+
+    list.setPriority(fake<neon::Material>(2), 20);
+    REQUIRE(materialsOf(list) == std::vector<uintptr_t>{2, 2, 1, 3});
+    REQUIRE(list.getItems()[0].model == modelA);
+    REQUIRE(list.getItems()[1].model == modelB);
+    REQUIRE(list.getItems()[0].priority == 20);
+
+    list.setPriority(fake<neon::Material>(1), -1);
+    REQUIRE(materialsOf(list) == std::vector<uintptr_t>{2, 2, 3, 1});
+
+    // New items are inserted using the updated priorities.
+    list.insert({fake<neon::Material>(4), modelB, drawable, 1});
+    REQUIRE(materialsOf(list) == std::vector<uintptr_t>{2, 2, 4, 3, 1});
+}
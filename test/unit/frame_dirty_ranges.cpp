@@ -0,0 +1,65 @@
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <neon/util/FrameDirtyRanges.h>
+
+TEST_CASE("Frame dirty ranges mark the other frames")
+{
+    neon::FrameDirtyRanges ranges(3, 100, 0);
+    ranges.mark(neon::Range<uint32_t>(10, 20));
+
+    REQUIRE(ranges.getStale(0).empty());
+    REQUIRE(ranges.getStale(1).isMarked(15));
+    REQUIRE(ranges.getStale(2).isMarked(15));
+
+    std::vector<neon::Range<uint32_t>> copied;
+    ranges.advance(1, 0, [&](neon::Range<uint32_t> run) { copied.push_back(run); });
+    REQUIRE(ranges.getCurrentFrame() == 1);
+    REQUIRE(copied.size() == 1);
+    REQUIRE(copied[0].getFrom() == 10);
+    REQUIRE(copied[0].getTo() == 20);
+    REQUIRE(ranges.getStale(1).empty());
+    REQUIRE(ranges.getStale(2).isMarked(15));
+
+    // Advancing to the current frame does nothing.
+    copied.clear();
+    ranges.advance(1, 0, [&](neon::Range<uint32_t> run) { copied.push_back(run); });
+    REQUIRE(copied.empty());
+}
+
+TEST_CASE("Frame dirty ranges resynchronize frame buffers")
+{
+    constexpr uint32_t FRAMES = 3;
+    constexpr uint32_t CAPACITY = 1000;
+
+    std::mt19937 random(7);
+    std::vector<int> expected(CAPACITY, 0);
+    std::vector<std::vector<int>> buffers(FRAMES, std::vector<int>(CAPACITY, 0));
+    neon::FrameDirtyRanges ranges(FRAMES, CAPACITY, 0);
+
+    for (uint32_t frame = 1; frame < 300; ++frame) {
+        uint32_t previous = ranges.getCurrentFrame();
+        uint32_t current = frame % FRAMES;
+        ranges.advance(current, 4, [&](neon::Range<uint32_t> run) {
+            memcpy(buffers[current].data() + run.getFrom(), buffers[previous].data() + run.getFrom(),
+                   run.size() * sizeof(int));
+        });
+
+        // The buffer of the new frame holds the latest version of every index.
+        REQUIRE(buffers[current] == expected);
+
+        for (size_t i = 0; i < 20; ++i) {
+            uint32_t from = random() % CAPACITY;
+            uint32_t to = std::min(CAPACITY, from + static_cast<uint32_t>(random() % 8) + 1);
+            for (uint32_t index = from; index < to; ++index) {
+                int value = static_cast<int>(random());
+                buffers[current][index] = value;
+                expected[index] = value;
+            }
+            ranges.mark(neon::Range<uint32_t>(from, to));
+        }
+    }
+}
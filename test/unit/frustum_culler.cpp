@@ -0,0 +1,76 @@
+#include <array>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <neon/geometry/BoundingSphere.h>
+#include <neon/geometry/Camera.h>
+#include <neon/geometry/Frustum.h>
+#include <neon/render/FrustumCuller.h>
+
+namespace
+{
+    // Column-major model matrix with the given translation and uniform scale.
+    std::array<float, 16> transform(float x, float y, float z, float scale = 1.0f)
+    {
+        return {scale, 0.0f, 0.0f, 0.0f, 0.0f, scale, 0.0f, 0.0f, 0.0f, 0.0f, scale, 0.0f, x, y, z, 1.0f};
+    }
+} // namespace
+
+TEST_CASE("Bounding sphere")
+{
+    std::vector<rush::Vec3f> points = {rush::Vec3f(-1.0f, 0.0f, 0.0f), rush::Vec3f(1.0f, 0.0f, 0.0f),
+                                       rush::Vec3f(0.0f, 2.0f, 0.0f)};
+    auto sphere = neon::BoundingSphere::fromPoints(points);
+
+    for (auto& point : points) {
+        float x = point[0] - sphere.center[0];
+        float y = point[1] - sphere.center[1];
+        float z = point[2] - sphere.center[2];
+        REQUIRE(x * x + y * y + z * z <= sphere.radius * sphere.radius + 0.0001f);
+    }
+
+    auto empty = neon::BoundingSphere::fromPoints({});
+    REQUIRE(empty.radius == 0.0f);
+}
+
+TEST_CASE("Frustum culler")
+{
+    // The camera is at the origin, looking at -Z.
+    neon::Camera camera(neon::Frustum(0.1f, 100.0f, 1.0f, 1.5f));
+    neon::FrustumCuller culler(camera.getPlanes());
+    neon::BoundingSphere bounds = {rush::Vec3f(0.0f, 0.0f, 0.0f), 1.0f};
+
+    REQUIRE(culler.isVisible({rush::Vec3f(0.0f, 0.0f, -10.0f), 1.0f}));
+    REQUIRE_FALSE(culler.isVisible({rush::Vec3f(0.0f, 0.0f, 10.0f), 1.0f}));
+
+    // Vulkan's depth starts at 0: points between the camera and the near plane are outside.
+    REQUIRE_FALSE(culler.isVisible({rush::Vec3f(0.0f, 0.0f, -0.05f), 0.01f}));
+
+    std::vector<std::array<float, 16>> instances = {
+        transform(0.0f, 0.0f, -10.0f),       // Visible
+        transform(0.0f, 0.0f, 10.0f),        // Behind the camera
+        transform(100.0f, 0.0f, -10.0f),     // Right
+        transform(0.0f, -100.0f, -10.0f),    // Bottom
+        transform(0.0f, 0.0f, -200.0f),      // Beyond the far plane
+        transform(0.0f, 0.0f, 0.5f, 2.0f),   // Scaled sphere crossing the near plane
+        transform(12.0f, 0.0f, -10.0f, 4.0f) // Scaled sphere crossing the right plane
+    };
+
+    // Repeat the instances to test several batches.
+    std::vector<std::array<float, 16>> all;
+    for (size_t i = 0; i < 5; ++i) {
+        all.insert(all.end(), instances.begin(), instances.end());
+    }
+
+    std::vector<uint32_t> visible;
+    size_t amount = culler.cull(bounds, all.data(), sizeof(std::array<float, 16>), all.size(), visible);
+
+    REQUIRE(amount == 15);
+    REQUIRE(visible.size() == amount);
+    for (size_t i = 0; i < 5; ++i) {
+        REQUIRE(visible[i * 3] == i * instances.size());
+        REQUIRE(visible[i * 3 + 1] == i * instances.size() + 5);
+        REQUIRE(visible[i * 3 + 2] == i * instances.size() + 6);
+    }
+}
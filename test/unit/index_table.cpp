@@ -0,0 +1,91 @@
+#include <random>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <neon/util/IndexTable.h>
+
+TEST_CASE("Index table swap-remove")
+{
+    neon::IndexTable table;
+    auto a = table.create();
+    auto b = table.create();
+    auto c = table.create();
+
+    REQUIRE(table.size() == 3);
+    REQUIRE(table.getIndex(a) == 0);
+    REQUIRE(table.getIndex(b) == 1);
+    REQUIRE(table.getIndex(c) == 2);
+
+    // The last element is moved to the removed index.
+    REQUIRE(table.remove(a) == 0);
+    REQUIRE(table.size() == 2);
+    REQUIRE(table.getIndex(c) == 0);
+    REQUIRE(table.getIndex(b) == 1);
+
+    // Removed handles are no longer valid.
+    REQUIRE_FALSE(table.isValid(a));
+    REQUIRE(table.remove(a) == neon::IndexTable::INVALID_INDEX);
+
+    // Recycled handles have a different generation.
+    auto d = table.create();
+    REQUIRE(d.id == a.id);
+    REQUIRE(d != a);
+    REQUIRE(table.getIndex(d) == 2);
+    REQUIRE_FALSE(table.isValid(a));
+}
+
+TEST_CASE("Index table matches dense array")
+{
+    neon::IndexTable table;
+    std::vector<int> dense;
+    std::vector<std::pair<neon::IndexTable::Handle, int>> alive;
+
+    std::mt19937 random(42);
+    int next = 0;
+
+    for (int i = 0; i < 20000; ++i) {
+        if (alive.empty() || random() % 3 != 0) {
+            auto handle = table.create();
+            dense.push_back(next);
+            alive.emplace_back(handle, next++);
+            continue;
+        }
+
+        size_t victim = random() % alive.size();
+        uint32_t index = table.remove(alive[victim].first);
+        REQUIRE(index != neon::IndexTable::INVALID_INDEX);
+        dense[index] = dense.back();
+        dense.pop_back();
+        alive[victim] = alive.back();
+        alive.pop_back();
+    }
+
+    REQUIRE(table.size() == dense.size());
+    for (auto& [handle, value] : alive) {
+        uint32_t index = table.getIndex(handle);
+        REQUIRE(index < dense.size());
+        REQUIRE(dense[index] == value);
+    }
+}
+
+TEST_CASE("Index table benchmark", "[!benchmark]")
+{
+    constexpr size_t INSTANCES = 100000;
+
+    neon::IndexTable table;
+    std::vector<neon::IndexTable::Handle> handles;
+    handles.reserve(INSTANCES);
+
+    BENCHMARK("Create and free 100k instances")
+    {
+        for (size_t i = 0; i < INSTANCES; ++i) {
+            handles.push_back(table.create());
+        }
+        for (auto handle : handles) {
+            table.remove(handle);
+        }
+        handles.clear();
+        return table.size();
+    };
+}
@@ -0,0 +1,74 @@
+#include <catch2/catch_all.hpp>
+
+#include <neon/render/model/InstanceCapacity.h>
+
+TEST_CASE("Instance capacity grows geometrically")
+{
+    neon::InstanceCapacity capacity(16, 100, 0);
+    REQUIRE(capacity.getCapacity() == 16);
+
+    REQUIRE(capacity.computeRequired(10) == 16u);
+    REQUIRE(capacity.computeRequired(16) == 16u);
+    REQUIRE(capacity.computeRequired(17) == 32u);
+    REQUIRE(capacity.computeRequired(50) == 64u);
+
+    // The growth is clamped to the maximum.
+    REQUIRE(capacity.computeRequired(65) == 100u);
+    REQUIRE(capacity.computeRequired(100) == 100u);
+    REQUIRE_FALSE(capacity.computeRequired(101).has_value());
+
+    capacity.setCapacity(32);
+    REQUIRE(capacity.computeRequired(33) == 64u);
+}
+
+TEST_CASE("Instance capacity starts from empty storages")
+{
+    neon::InstanceCapacity capacity(0, 10, 0);
+    REQUIRE(capacity.getCapacity() == 0);
+    REQUIRE(capacity.computeRequired(1) == 1u);
+    REQUIRE(capacity.computeRequired(3) == 4u);
+
+    // The initial capacity is clamped to the maximum.
+    neon::InstanceCapacity clamped(64, 10, 0);
+    REQUIRE(clamped.getCapacity() == 10);
+}
+
+TEST_CASE("Instance capacity shrinks after idle flushes")
+{
+    neon::InstanceCapacity capacity(8, 1000, 3);
+    capacity.setCapacity(256);
+
+    // Using more than a quarter of the capacity keeps the storage.
+    for (size_t i = 0; i < 10; ++i) {
+        REQUIRE_FALSE(capacity.onFlush(65).has_value());
+    }
+
+    // Using a quarter or less shrinks it after three flushes.
+    REQUIRE_FALSE(capacity.onFlush(20).has_value());
+    REQUIRE_FALSE(capacity.onFlush(20).has_value());
+    REQUIRE(capacity.onFlush(20) == 40u);
+
+    // A busy flush resets the count.
+    capacity.setCapacity(256);
+    REQUIRE_FALSE(capacity.onFlush(3).has_value());
+    REQUIRE_FALSE(capacity.onFlush(3).has_value());
+    REQUIRE_FALSE(capacity.onFlush(100).has_value());
+    REQUIRE_FALSE(capacity.onFlush(3).has_value());
+    REQUIRE_FALSE(capacity.onFlush(3).has_value());
+
+    // Storages never shrink below the initial capacity.
+    REQUIRE(capacity.onFlush(3) == 8u);
+    capacity.setCapacity(8);
+    for (size_t i = 0; i < 10; ++i) {
+        REQUIRE_FALSE(capacity.onFlush(0).has_value());
+    }
+}
+
+TEST_CASE("Instance capacity never shrinks when the delay is 0")
+{
+    neon::InstanceCapacity capacity(8, 1000, 0);
+    capacity.setCapacity(512);
+    for (size_t i = 0; i < 100; ++i) {
+        REQUIRE_FALSE(capacity.onFlush(0).has_value());
+    }
+}
@@ -0,0 +1,184 @@
+#include <memory>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <neon/util/LinearPageAllocator.h>
+
+namespace
+{
+    struct TestMemory
+    {
+        std::vector<char> bytes;
+        size_t* alive;
+
+        TestMemory(uint32_t size, size_t* aliveCounter) :
+            bytes(size),
+            alive(aliveCounter)
+        {
+            ++*alive;
+        }
+
+        ~TestMemory()
+        {
+            --*alive;
+        }
+
+        char* data()
+        {
+            return bytes.data();
+        }
+
+        [[nodiscard]] size_t size() const
+        {
+            return bytes.size();
+        }
+    };
+
+    class TestRun : public neon::CommandBufferRun
+    {
+      public:
+        bool finished = false;
+
+        bool hasFinished() override
+        {
+            return finished;
+        }
+
+        void wait() override
+        {
+            finished = true;
+        }
+    };
+
+    using Allocator = neon::LinearPageAllocator<TestMemory>;
+
+    Allocator::Factory factory(size_t* alive)
+    {
+        return [alive](uint32_t size) { return std::make_unique<TestMemory>(size, alive); };
+    }
+} // namespace
+
+TEST_CASE("Linear page allocator sub-allocates aligned regions")
+{
+    size_t alive = 0;
+    Allocator allocator(factory(&alive), 256, 4);
+
+    REQUIRE(allocator.allocate(0).page == nullptr);
+    REQUIRE(alive == 0);
+
+    auto a = allocator.allocate(10);
+    auto b = allocator.allocate(20);
+    auto c = allocator.allocate(1);
+    REQUIRE(alive == 1);
+    REQUIRE(a.page == b.page);
+    REQUIRE(a.offset == 0);
+    REQUIRE(b.offset == 16);
+    REQUIRE(c.offset == 48);
+    REQUIRE(b.data == a.data + 16);
+
+    allocator.release(a, nullptr);
+    allocator.release(b, nullptr);
+    allocator.release(c, nullptr);
+}
+
+TEST_CASE("Linear page allocator recycles pages once their runs finish")
+{
+    size_t alive = 0;
+    Allocator allocator(factory(&alive), 256, 4);
+    auto run = std::make_shared<TestRun>();
+
+    auto first = allocator.allocate(200);
+    allocator.release(first, run);
+
+    // The first page is full: a second page is created and the first one is retired.
+    auto second = allocator.allocate(200);
+    REQUIRE(second.page != first.page);
+    REQUIRE(alive == 2);
+
+    // The run reading the first page has not finished: it cannot be reused.
+    auto third = allocator.allocate(200);
+    REQUIRE(third.page != first.page);
+    REQUIRE(third.page != second.page);
+    REQUIRE(alive == 3);
+
+    // Once the run finishes, the first page is recycled instead of creating a new one.
+    run->finished = true;
+    auto fourth = allocator.allocate(200);
+    REQUIRE(alive == 3);
+    REQUIRE(fourth.page == first.page);
+    REQUIRE(fourth.offset == 0);
+
+    allocator.release(second, nullptr);
+    allocator.release(third, nullptr);
+    allocator.release(fourth, nullptr);
+}
+
+TEST_CASE("Linear page allocator keeps pages with pending allocations")
+{
+    size_t alive = 0;
+    Allocator allocator(factory(&alive), 256, 4);
+
+    auto first = allocator.allocate(200);
+    auto second = allocator.allocate(200);
+    auto third = allocator.allocate(200);
+    REQUIRE(alive == 3);
+
+    // The first page has not been released yet.
+    allocator.release(second, nullptr);
+    auto fourth = allocator.allocate(200);
+    REQUIRE(fourth.page != first.page);
+    REQUIRE(fourth.page == second.page);
+
+    allocator.release(first, nullptr);
+    allocator.release(third, nullptr);
+    allocator.release(fourth, nullptr);
+}
+
+TEST_CASE("Linear page allocator uses dedicated pages for big allocations")
+{
+    size_t alive = 0;
+    Allocator allocator(factory(&alive), 256, 4);
+
+    auto small = allocator.allocate(16);
+    auto big = allocator.allocate(1000);
+    REQUIRE(big.page != small.page);
+    REQUIRE(big.page->memory->size() == 1000);
+    REQUIRE(allocator.getAllocatedMemory() == 1256);
+
+    // Big allocations keep the current page.
+    auto next = allocator.allocate(16);
+    REQUIRE(next.page == small.page);
+
+    // Dedicated pages are destroyed once recycled.
+    allocator.release(big, nullptr);
+    auto other = allocator.allocate(1000);
+    REQUIRE(alive == 2);
+    REQUIRE(allocator.getPageAmount() == 2);
+    allocator.release(other, nullptr);
+
+    allocator.release(small, nullptr);
+    allocator.release(next, nullptr);
+}
+
+TEST_CASE("Linear page allocator limits the amount of free pages")
+{
+    size_t alive = 0;
+    Allocator allocator(factory(&alive), 256, 1);
+
+    std::vector<Allocator::Allocation> allocations;
+    for (size_t i = 0; i < 5; ++i) {
+        allocations.push_back(allocator.allocate(200));
+    }
+    REQUIRE(alive == 5);
+
+    for (auto& allocation : allocations) {
+        allocator.release(allocation, nullptr);
+    }
+
+    // Recycling the five pages keeps only one of them.
+    auto next = allocator.allocate(200);
+    REQUIRE(alive == 1);
+    REQUIRE(next.page == allocations.front().page);
+    allocator.release(next, nullptr);
+}
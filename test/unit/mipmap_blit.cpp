@@ -0,0 +1,60 @@
+#include <catch2/catch_all.hpp>
+
+#include <neon/render/texture/MipmapBlit.h>
+
+using rush::Vec3ui;
+
+TEST_CASE("Mipmap sizes halve down to one texel")
+{
+    REQUIRE(neon::nextMipmapSize(Vec3ui(256, 64, 1)) == Vec3ui(128, 32, 1));
+    REQUIRE(neon::nextMipmapSize(Vec3ui(5, 3, 2)) == Vec3ui(2, 1, 1));
+    REQUIRE(neon::nextMipmapSize(Vec3ui(1, 1, 1)) == Vec3ui(1, 1, 1));
+}
+
+TEST_CASE("Mipmap blit boxes match a full blit for whole levels")
+{
+    Vec3ui source(256, 128, 1);
+    auto destination = neon::nextMipmapSize(source);
+    auto box = neon::computeMipmapBlitBox(source, destination, Vec3ui(0, 0, 0), source);
+
+    REQUIRE(box.sourceFrom == Vec3ui(0, 0, 0));
+    REQUIRE(box.sourceTo == source);
+    REQUIRE(box.destinationFrom == Vec3ui(0, 0, 0));
+    REQUIRE(box.destinationTo == destination);
+}
+
+TEST_CASE("Mipmap blit boxes round regions outwards")
+{
+    Vec3ui source(256, 256, 1);
+    auto destination = neon::nextMipmapSize(source);
+
+    // Aligned regions map exactly.
+    auto aligned = neon::computeMipmapBlitBox(source, destination, Vec3ui(64, 32, 0), Vec3ui(16, 8, 1));
+    REQUIRE(aligned.destinationFrom == Vec3ui(32, 16, 0));
+    REQUIRE(aligned.destinationTo == Vec3ui(40, 20, 1));
+    REQUIRE(aligned.sourceFrom == Vec3ui(64, 32, 0));
+    REQUIRE(aligned.sourceTo == Vec3ui(80, 40, 1));
+
+    // Unaligned regions grow to cover every texel sampling them.
+    auto unaligned = neon::computeMipmapBlitBox(source, destination, Vec3ui(3, 5, 0), Vec3ui(1, 2, 1));
+    REQUIRE(unaligned.destinationFrom == Vec3ui(1, 2, 0));
+    REQUIRE(unaligned.destinationTo == Vec3ui(2, 4, 1));
+    REQUIRE(unaligned.sourceFrom == Vec3ui(2, 4, 0));
+    REQUIRE(unaligned.sourceTo == Vec3ui(4, 8, 1));
+}
+
+TEST_CASE("Mipmap blit boxes stay inside odd-sized levels")
+{
+    Vec3ui source(5, 3, 1);
+    auto destination = neon::nextMipmapSize(source);
+    auto box = neon::computeMipmapBlitBox(source, destination, Vec3ui(4, 2, 0), Vec3ui(1, 1, 1));
+
+    REQUIRE(box.destinationTo.x() <= destination.x());
+    REQUIRE(box.destinationTo.y() <= destination.y());
+    REQUIRE(box.sourceTo.x() <= source.x());
+    REQUIRE(box.sourceTo.y() <= source.y());
+    REQUIRE(box.destinationFrom == Vec3ui(1, 0, 0));
+    REQUIRE(box.destinationTo == Vec3ui(2, 1, 1));
+    REQUIRE(box.sourceFrom == Vec3ui(2, 0, 0));
+    REQUIRE(box.sourceTo == Vec3ui(5, 3, 1));
+}
@@ -0,0 +1,105 @@
+#include <cstring>
+#include <filesystem>
+
+#include <catch2/catch_all.hpp>
+
+#include <neon/filesystem/DirectoryFileSystem.h>
+#include <vulkan/render/spirv/SPIRVCache.h>
+
+namespace
+{
+    neon::vulkan::SPIRVCache::Entry createEntry()
+    {
+        neon::vulkan::SPIRVCache::Entry entry;
+        entry.stages.push_back({VK_SHADER_STAGE_VERTEX_BIT, {0x07230203, 1, 2, 3}});
+        entry.stages.push_back({VK_SHADER_STAGE_FRAGMENT_BIT, {0x07230203, 4, 5}});
+
+        neon::ShaderUniformBlock block;
+        block.name = "Matrices";
+        block.set = 0;
+        block.binding = 1;
+        block.stages = VK_SHADER_STAGE_VERTEX_BIT;
+        block.sizeInBytes = 128;
+        block.offset = {};
+        block.memberNames = {"view", "projection"};
+        entry.uniformBlocks.push_back(block);
+
+        neon::ShaderUniformSampler sampler;
+        sampler.name = "diffuse";
+        sampler.binding = 2;
+        sampler.stages = VK_SHADER_STAGE_FRAGMENT_BIT;
+        sampler.type = neon::TextureViewType::CUBE;
+        entry.samplers.push_back(sampler);
+
+        return entry;
+    }
+} // namespace
+
+TEST_CASE("SPIR-V cache serialization", "[spirv_cache]")
+{
+    auto entry = createEntry();
+    auto data = neon::vulkan::SPIRVCache::serialize("key", entry);
+
+    auto result = neon::vulkan::SPIRVCache::deserialize("key", data.data(), data.size());
+    REQUIRE(result.has_value());
+    REQUIRE(result->stages.size() == 2);
+    REQUIRE(result->stages[0].stage == VK_SHADER_STAGE_VERTEX_BIT);
+    REQUIRE(result->stages[0].code == entry.stages[0].code);
+    REQUIRE(result->stages[1].stage == VK_SHADER_STAGE_FRAGMENT_BIT);
+    REQUIRE(result->stages[1].code == entry.stages[1].code);
+
+    REQUIRE(result->uniformBlocks.size() == 1);
+    auto& block = result->uniformBlocks[0];
+    REQUIRE(block.name == "Matrices");
+    REQUIRE(block.set == 0);
+    REQUIRE(block.binding == 1);
+    REQUIRE(block.stages == VK_SHADER_STAGE_VERTEX_BIT);
+    REQUIRE(block.sizeInBytes == 128);
+    REQUIRE_FALSE(block.offset.has_value());
+    REQUIRE(block.memberNames == entry.uniformBlocks[0].memberNames);
+
+    REQUIRE(result->samplers.size() == 1);
+    auto& sampler = result->samplers[0];
+    REQUIRE(sampler.name == "diffuse");
+    REQUIRE_FALSE(sampler.set.has_value());
+    REQUIRE(sampler.binding == 2);
+    REQUIRE(sampler.type == neon::TextureViewType::CUBE);
+}
+
+TEST_CASE("SPIR-V cache rejects invalid entries", "[spirv_cache]")
+{
+    auto data = neon::vulkan::SPIRVCache::serialize("key", createEntry());
+
+    // Different key.
+    REQUIRE_FALSE(neon::vulkan::SPIRVCache::deserialize("other", data.data(), data.size()).has_value());
+
+    // Truncated data.
+    for (size_t size = 0; size < data.size(); size += 7) {
+        REQUIRE_FALSE(neon::vulkan::SPIRVCache::deserialize("key", data.data(), size).has_value());
+    }
+
+    // Trailing data.
+    data.push_back(std::byte{0});
+    REQUIRE_FALSE(neon::vulkan::SPIRVCache::deserialize("key", data.data(), data.size()).has_value());
+}
+
+TEST_CASE("SPIR-V cache directory storage", "[spirv_cache]")
+{
+    auto directory = std::filesystem::temp_directory_path() / "neon_spirv_cache_test";
+    std::filesystem::remove_all(directory);
+
+    {
+        neon::DirectoryFileSystem fileSystem(directory);
+        neon::vulkan::SPIRVCache cache(&fileSystem);
+
+        REQUIRE_FALSE(cache.load("key").has_value());
+        REQUIRE(cache.store("key", createEntry()));
+
+        auto result = cache.load("key");
+        REQUIRE(result.has_value());
+        REQUIRE(result->stages.size() == 2);
+        REQUIRE(result->stages[1].code == createEntry().stages[1].code);
+    }
+
+    std::filesystem::remove_all(directory);
+}
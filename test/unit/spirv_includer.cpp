@@ -0,0 +1,62 @@
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <neon/filesystem/DirectoryFileSystem.h>
+#include <vulkan/render/spirv/SPIRVCompiler.h>
+
+TEST_CASE("SPIR-V includer resolves local includes", "[spirv_includer]")
+{
+    neon::IncluderCreateInfo info;
+    info.rootPath = "shaders";
+    neon::vulkan::SPIRVIncluder includer(info);
+
+    // glslang names the root snippets using an empty string.
+    REQUIRE(includer.resolveLocal("common.glsl", "") == std::filesystem::path("shaders") / "common.glsl");
+    REQUIRE(includer.resolveLocal("common.glsl", nullptr) == std::filesystem::path("shaders") / "common.glsl");
+
+    // Nested includes are resolved against the including file.
+    REQUIRE(includer.resolveLocal("light.glsl", "lib/common.glsl") == std::filesystem::path("lib") / "light.glsl");
+}
+
+TEST_CASE("SPIR-V includers share a file system across threads", "[spirv_includer]")
+{
+    auto directory = std::filesystem::temp_directory_path() / "neon_spirv_includer_test";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory / "shaders");
+    std::ofstream(directory / "shaders" / "common.glsl") << "#define COMMON 1\n";
+
+    neon::DirectoryFileSystem fileSystem(directory);
+
+    constexpr size_t THREADS = 8;
+    std::vector<std::string> contents(THREADS);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < THREADS; ++i) {
+        threads.emplace_back([&fileSystem, &contents, i] {
+            // Each compiler owns its includer.
+            neon::IncluderCreateInfo info;
+            info.fileSystem = &fileSystem;
+            info.rootPath = "shaders";
+            neon::vulkan::SPIRVIncluder includer(info);
+
+            auto* result = includer.includeLocal("common.glsl", "", 0);
+            if (result != nullptr) {
+                contents[i] = std::string(result->headerData, result->headerLength);
+                includer.releaseInclude(result);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto& content : contents) {
+        REQUIRE(content == "#define COMMON 1\n");
+    }
+
+    std::filesystem::remove_all(directory);
+}
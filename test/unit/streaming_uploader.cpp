@@ -0,0 +1,44 @@
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <vulkan/render/buffer/StreamingUploader.h>
+
+using neon::vulkan::StreamingUploader;
+using neon::vulkan::VKQueueFamily;
+
+namespace
+{
+    VKQueueFamily family(uint32_t index, VkQueueFlags flags, uint32_t count = 1)
+    {
+        VkQueueFamilyProperties properties{};
+        properties.queueFlags = flags;
+        properties.queueCount = count;
+        // Without a surface, the device is not queried.
+        return {VK_NULL_HANDLE, VK_NULL_HANDLE, index, properties};
+    }
+
+    constexpr VkQueueFlags GRAPHICS = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+    constexpr VkQueueFlags COMPUTE = VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+    constexpr VkQueueFlags TRANSFER = VK_QUEUE_TRANSFER_BIT;
+} // namespace
+
+TEST_CASE("Streaming uploader falls back to the graphics family")
+{
+    REQUIRE_FALSE(StreamingUploader::findTransferFamily({}).has_value());
+    REQUIRE_FALSE(StreamingUploader::findTransferFamily({family(0, GRAPHICS)}).has_value());
+
+    // Families without queues or without transfer capabilities cannot be used.
+    std::vector families = {family(0, GRAPHICS), family(1, TRANSFER, 0), family(2, VK_QUEUE_COMPUTE_BIT)};
+    REQUIRE_FALSE(StreamingUploader::findTransferFamily(families).has_value());
+}
+
+TEST_CASE("Streaming uploader prefers transfer-only families")
+{
+    std::vector families = {family(0, GRAPHICS), family(1, COMPUTE), family(2, TRANSFER), family(3, TRANSFER)};
+    REQUIRE(StreamingUploader::findTransferFamily(families) == 2u);
+
+    // Async compute families are used when there is no transfer-only family.
+    std::vector computeOnly = {family(0, GRAPHICS), family(1, COMPUTE), family(2, COMPUTE)};
+    REQUIRE(StreamingUploader::findTransferFamily(computeOnly) == 1u);
+}
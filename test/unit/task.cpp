@@ -7,6 +7,36 @@
 
 #include <neon/util/task/TaskRunner.h>
 
+namespace
+{
+    // Only the thread that enables the counter counts its allocations:
+    // allocations made by the workers don't depend on the timing of the test.
+    thread_local bool countAllocations = false;
+    thread_local size_t allocations = 0;
+} // namespace
+
+// Counts the heap allocations made by the current thread while countAllocations is enabled.
+void* operator new(std::size_t size)
+{
+    if (countAllocations) {
+        ++allocations;
+    }
+    if (void* pointer = std::malloc(size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
 TEST_CASE("Task wait", "[task]")
 {
     neon::TaskRunner runner;
@@ -229,3 +259,364 @@ TEST_CASE("Multiple dependencies", "[task]")
 
     runner.shutdown();
 }
+
+TEST_CASE("Dependency graph stress", "[task]")
+{
+    constexpr size_t DEPTH = 2000;
+    constexpr size_t WIDTH = 2000;
+
+    auto mode = GENERATE(neon::TaskRunnerMode::SHARED_QUEUE, neon::TaskRunnerMode::WORK_STEALING);
+    neon::TaskRunner runner(mode);
+
+    SECTION("Deep chain")
+    {
+        std::atomic_size_t order = 0;
+        std::atomic_bool ordered = true;
+
+        auto task = runner.executeAsync([&order] { ++order; });
+        for (size_t i = 1; i < DEPTH; ++i) {
+            task = task->then([&order, &ordered, i] {
+                if (order.load() != i) {
+                    ordered = false;
+                }
+                ++order;
+            });
+        }
+
+        task->wait();
+        REQUIRE(task->hasFinished());
+        REQUIRE(ordered);
+        REQUIRE(order == DEPTH);
+    }
+
+    SECTION("Wide fan-out and fan-in")
+    {
+        std::atomic_bool rootFinished = false;
+        std::atomic_size_t counter = 0;
+        std::atomic_bool ordered = true;
+
+        auto root = runner.executeAsync([&rootFinished] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            rootFinished = true;
+        });
+
+        auto join = std::make_shared<neon::Task<size_t>>(&runner);
+        for (size_t i = 0; i < WIDTH; ++i) {
+            auto child = root->then([&rootFinished, &counter, &ordered] {
+                if (!rootFinished) {
+                    ordered = false;
+                }
+                ++counter;
+            });
+            join->addDependency(false, child.get());
+        }
+        runner.executeAsync(join, [&counter] { return counter.load(); });
+
+        join->wait();
+        REQUIRE(join->hasFinished());
+        REQUIRE(ordered);
+        REQUIRE(join->getResult() == WIDTH);
+    }
+
+    SECTION("Cancellation propagation")
+    {
+        std::atomic_bool executed = false;
+        std::atomic_bool ignoringExecuted = false;
+
+        // The root is never launched: it will only be cancelled.
+        auto root = std::make_shared<neon::Task<void>>(&runner);
+
+        std::vector<std::shared_ptr<neon::Task<void>>> dependents;
+        auto task = root->then([&executed] { executed = true; });
+        dependents.push_back(task);
+        for (size_t i = 1; i < DEPTH; ++i) {
+            task = task->then([&executed] { executed = true; });
+            dependents.push_back(task);
+        }
+        for (size_t i = 0; i < WIDTH; ++i) {
+            dependents.push_back(root->then([&executed] { executed = true; }));
+        }
+
+        auto ignoring = root->then(true, false, [&ignoringExecuted] { ignoringExecuted = true; });
+
+        REQUIRE(std::ranges::none_of(dependents, [](auto& it) { return it->isCancelled(); }));
+
+        root->cancel();
+
+        // Cancellations are propagated synchronously through the continuations.
+        REQUIRE(std::ranges::all_of(dependents, [](auto& it) { return it->isCancelled(); }));
+
+        ignoring->wait();
+        runner.shutdown();
+
+        REQUIRE(!executed);
+        REQUIRE(ignoringExecuted);
+        REQUIRE(ignoring->hasFinished());
+    }
+}
+
+TEST_CASE("Long cancellation chain", "[task]")
+{
+    // Cancellations are propagated iteratively: a long chain doesn't overflow the stack.
+    constexpr size_t DEPTH = 200000;
+
+    neon::TaskRunner runner;
+    auto root = std::make_shared<neon::Task<void>>(&runner);
+
+    std::shared_ptr<neon::Task<void>> task = root;
+    for (size_t i = 0; i < DEPTH; ++i) {
+        task = task->then([] {});
+    }
+
+    root->cancel();
+    REQUIRE(task->isCancelled());
+}
+
+TEST_CASE("Unresolved dependencies release their dependents", "[task]")
+{
+    neon::TaskRunner runner;
+
+    auto captured = std::make_shared<int>(0);
+    std::weak_ptr<int> weak = captured;
+    {
+        // The root is never resolved, and nothing else keeps its dependent alive.
+        auto root = std::make_shared<neon::Task<void>>(&runner);
+        root->then([captured] {})->then([captured] {});
+        captured.reset();
+        REQUIRE_FALSE(weak.expired());
+    }
+
+    REQUIRE(weak.expired());
+}
+
+TEST_CASE("TaskRunner shutdown abandons blocked tasks", "[task]")
+{
+    auto runner = std::make_unique<neon::TaskRunner>();
+    auto root = std::make_shared<neon::Task<void>>(runner.get());
+    auto dependent = root->then([] {});
+    auto mainThread = runner->executeOnMainThread([] {});
+
+    runner.reset();
+    REQUIRE(dependent->isCancelled());
+    REQUIRE(mainThread->isCancelled());
+
+    // The continuation registered by the destroyed runner must not access it.
+    root->setResult(std::monostate());
+    REQUIRE(root->hasFinished());
+}
+
+TEST_CASE("Work stealing consecutive tasks", "[task]")
+{
+    neon::TaskRunner runner(neon::TaskRunnerMode::WORK_STEALING);
+
+    std::atomic_bool finished = false;
+    std::atomic_size_t spawned = 0;
+
+    std::function func = [&runner, &spawned] {
+        // Tasks launched from a worker are pushed into its own deque.
+        for (size_t i = 0; i < 100; ++i) {
+            runner.executeAsync([&spawned] { ++spawned; });
+        }
+    };
+
+    std::function func2 = [&finished] { finished = true; };
+
+    auto task = runner.executeAsync(func);
+    auto task2 = task->then(func2);
+
+    task2->wait();
+    runner.shutdown();
+
+    REQUIRE(finished);
+    REQUIRE(spawned == 100);
+}
+
+TEST_CASE("Parallel for", "[task]")
+{
+    constexpr size_t SIZE = 100000;
+
+    auto mode = GENERATE(neon::TaskRunnerMode::SHARED_QUEUE, neon::TaskRunnerMode::WORK_STEALING);
+    neon::TaskRunner runner(mode);
+
+    std::vector<int> values(SIZE, 0);
+    runner.parallelFor(0, SIZE, 1000, [&values](size_t i) { values[i] += static_cast<int>(i % 7); });
+
+    bool valid = true;
+    for (size_t i = 0; i < SIZE; ++i) {
+        valid &= values[i] == static_cast<int>(i % 7);
+    }
+    REQUIRE(valid);
+
+    // Empty ranges and grain sizes bigger than the range.
+    runner.parallelFor(10, 10, 1, [](size_t) { FAIL("Empty range invoked the function"); });
+    std::atomic_size_t count = 0;
+    runner.parallelFor(0, 10, 100, [&count](size_t) { ++count; });
+    REQUIRE(count == 10);
+}
+
+TEST_CASE("Parallel for nested", "[task]")
+{
+    constexpr size_t OUTER = 64;
+    constexpr size_t INNER = 1000;
+
+    auto mode = GENERATE(neon::TaskRunnerMode::SHARED_QUEUE, neon::TaskRunnerMode::WORK_STEALING);
+    neon::TaskRunner runner(mode);
+
+    // Workers joining the inner loops execute other pending work instead of blocking.
+    std::atomic_size_t count = 0;
+    runner.parallelFor(0, OUTER, 1, [&runner, &count](size_t) {
+        runner.parallelFor(0, INNER, 16, [&count](size_t) { count.fetch_add(1, std::memory_order_relaxed); });
+    });
+
+    REQUIRE(count == OUTER * INNER);
+}
+
+TEST_CASE("Parallel reduce", "[task]")
+{
+    constexpr size_t SIZE = 100000;
+
+    auto mode = GENERATE(neon::TaskRunnerMode::SHARED_QUEUE, neon::TaskRunnerMode::WORK_STEALING);
+    neon::TaskRunner runner(mode);
+
+    uint64_t sum = runner.parallelReduce(
+        0, SIZE, 512, uint64_t(0), [](size_t i) { return static_cast<uint64_t>(i); },
+        [](uint64_t a, uint64_t b) { return a + b; });
+    REQUIRE(sum == SIZE * (SIZE - 1) / 2);
+
+    std::string concatenated = runner.parallelReduce(
+        0, 26, 2, std::string(), [](size_t i) { return std::string(1, static_cast<char>('a' + i)); },
+        [](std::string a, const std::string& b) { return std::move(a) + b; });
+    REQUIRE(concatenated == "abcdefghijklmnopqrstuvwxyz");
+
+    REQUIRE(runner.parallelReduce(5, 5, 1, 42, [](size_t) { return 0; }, std::plus()) == 42);
+}
+
+TEST_CASE("TaskRunner throughput", "[task][benchmark]")
+{
+    constexpr size_t TASKS = 10000;
+    constexpr size_t SPAWNERS = 100;
+
+    auto launchFromMainThread = [](neon::TaskRunner& runner) {
+        std::atomic_size_t counter = 0;
+        std::vector<std::shared_ptr<neon::Task<void>>> tasks;
+        tasks.reserve(TASKS);
+        for (size_t i = 0; i < TASKS; ++i) {
+            tasks.push_back(runner.executeAsync([&counter] { counter.fetch_add(1, std::memory_order_relaxed); }));
+        }
+        for (auto& task : tasks) {
+            task->wait();
+        }
+        return counter.load();
+    };
+
+    auto launchFromWorkers = [](neon::TaskRunner& runner) {
+        using Spawned = std::vector<std::shared_ptr<neon::Task<void>>>;
+        std::atomic_size_t counter = 0;
+        std::vector<std::shared_ptr<neon::Task<Spawned>>> spawners;
+        spawners.reserve(SPAWNERS);
+        for (size_t i = 0; i < SPAWNERS; ++i) {
+            spawners.push_back(runner.executeAsync([&runner, &counter] {
+                Spawned tasks;
+                tasks.reserve(TASKS / SPAWNERS);
+                for (size_t j = 0; j < TASKS / SPAWNERS; ++j) {
+                    tasks.push_back(
+                        runner.executeAsync([&counter] { counter.fetch_add(1, std::memory_order_relaxed); }));
+                }
+                return tasks;
+            }));
+        }
+        // Waiting on every task orders their increments before the load below.
+        for (auto& spawner : spawners) {
+            spawner->wait();
+            for (auto& task : spawner->getResult().value()) {
+                task->wait();
+            }
+        }
+        return counter.load();
+    };
+
+    neon::TaskRunner shared(neon::TaskRunnerMode::SHARED_QUEUE);
+    neon::TaskRunner stealing(neon::TaskRunnerMode::WORK_STEALING);
+
+    BENCHMARK("Shared queue, main thread launches")
+    {
+        return launchFromMainThread(shared);
+    };
+
+    BENCHMARK("Work stealing, main thread launches")
+    {
+        return launchFromMainThread(stealing);
+    };
+
+    BENCHMARK("Shared queue, worker launches")
+    {
+        return launchFromWorkers(shared);
+    };
+
+    BENCHMARK("Work stealing, worker launches")
+    {
+        return launchFromWorkers(stealing);
+    };
+}
+
+TEST_CASE("Task submission allocations", "[task][benchmark]")
+{
+    constexpr size_t TASKS = 1000;
+
+    auto mode = GENERATE(neon::TaskRunnerMode::SHARED_QUEUE, neon::TaskRunnerMode::WORK_STEALING);
+    neon::TaskRunner runner(mode);
+
+    std::vector<std::shared_ptr<neon::Task<int>>> tasks;
+    tasks.reserve(TASKS * 2);
+
+    auto launch = [&runner, &tasks](size_t amount) {
+        for (size_t i = 0; i < amount; ++i) {
+            tasks.push_back(runner.executeAsync([](int a, int b) { return a + b; }, static_cast<int>(i), 1));
+        }
+    };
+
+    auto wait = [&tasks] {
+        int sum = 0;
+        for (auto& task : tasks) {
+            task->wait();
+            sum += task->getResult().value();
+        }
+        tasks.clear();
+        return sum;
+    };
+
+    // Warm up the frame pool and the queues.
+    // All workers are kept busy, so every warm-up task is queued at the same time.
+    size_t workers = std::max(std::thread::hardware_concurrency(), 2u) - 1u;
+    std::atomic_size_t busyWorkers = 0;
+    std::atomic_bool release = false;
+    for (size_t i = 0; i < workers; ++i) {
+        runner.executeAsync([&busyWorkers, &release] {
+            ++busyWorkers;
+            while (!release) {
+                std::this_thread::yield();
+            }
+        });
+    }
+    while (busyWorkers < workers) {
+        std::this_thread::yield();
+    }
+    launch(TASKS * 2);
+    release = true;
+    wait();
+
+    allocations = 0;
+    countAllocations = true;
+    launch(TASKS);
+    int sum = wait();
+    countAllocations = false;
+
+    REQUIRE(sum == TASKS * (TASKS + 1) / 2);
+    REQUIRE(allocations == 0);
+
+    BENCHMARK("Submit and wait 1000 pooled tasks")
+    {
+        launch(TASKS);
+        return wait();
+    };
+}
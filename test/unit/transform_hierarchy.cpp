@@ -0,0 +1,233 @@
+#include <atomic>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <neon/structure/GameObject.h>
+#include <neon/structure/Room.h>
+#include <neon/util/task/TaskRunner.h>
+
+namespace
+{
+    float translationX(const neon::Transform& transform)
+    {
+        return transform.getModel()(3, 0);
+    }
+} // namespace
+
+TEST_CASE("Transform hierarchy")
+{
+    neon::TaskRunner runner;
+    neon::Room room(nullptr);
+    auto& hierarchy = room.getTransformHierarchy();
+
+    auto a = room.newGameObject();
+    auto b = room.newGameObject();
+    auto c = room.newGameObject();
+    b->setParent(a);
+    c->setParent(b);
+
+    a->getTransform().setPosition(rush::Vec3f(1.0f, 0.0f, 0.0f));
+    b->getTransform().setPosition(rush::Vec3f(2.0f, 0.0f, 0.0f));
+    c->getTransform().setPosition(rush::Vec3f(4.0f, 0.0f, 0.0f));
+
+    // Reads return the matrices of the last update.
+    REQUIRE(translationX(c->getTransform()) == 0.0f);
+
+    // Refreshing a tree recalculates its matrices immediately.
+    c->getTransform().refresh();
+    REQUIRE(translationX(a->getTransform()) == 1.0f);
+    REQUIRE(translationX(c->getTransform()) == 7.0f);
+
+    hierarchy.update(runner);
+    REQUIRE_FALSE(hierarchy.hasPendingChanges());
+    REQUIRE(hierarchy.size() == 3);
+
+    uint64_t version = c->getTransform().getVersion();
+    a->getTransform().setPosition(rush::Vec3f(10.0f, 0.0f, 0.0f));
+    hierarchy.update(runner);
+
+    REQUIRE(translationX(b->getTransform()) == 12.0f);
+    REQUIRE(translationX(c->getTransform()) == 16.0f);
+    REQUIRE(c->getTransform().getVersion() != version);
+
+    version = c->getTransform().getVersion();
+    hierarchy.update(runner);
+    REQUIRE(c->getTransform().getVersion() == version);
+
+    // Destroying the parent turns its children into roots.
+    b->destroy();
+    hierarchy.update(runner);
+    REQUIRE(hierarchy.size() == 2);
+    REQUIRE(translationX(c->getTransform()) == 4.0f);
+}
+
+TEST_CASE("Transform hierarchy concurrent refreshes")
+{
+    neon::TaskRunner runner;
+    neon::Room room(nullptr);
+    auto& hierarchy = room.getTransformHierarchy();
+
+    // 64 chains of 16 nodes.
+    std::vector<neon::IdentifiableWrapper<neon::GameObject>> leaves;
+    for (size_t i = 0; i < 64; ++i) {
+        auto parent = room.newGameObject();
+        for (size_t j = 0; j < 16; ++j) {
+            auto child = room.newGameObject();
+            child->setParent(parent);
+            child->getTransform().setPosition(rush::Vec3f(1.0f, 0.0f, 0.0f));
+            parent = child;
+        }
+        leaves.push_back(parent);
+    }
+    hierarchy.update(runner);
+
+    // Matrices are returned by value: they survive the creation of new game objects.
+    rush::Mat4f model = leaves.front()->getTransform().getModel();
+    for (size_t i = 0; i < 100; ++i) {
+        room.newGameObject();
+    }
+    REQUIRE(model(3, 0) == 16.0f);
+
+    for (auto& leaf : leaves) {
+        leaf->getParent()->getTransform().setPosition(rush::Vec3f(2.0f, 0.0f, 0.0f));
+    }
+
+    // Different trees can be refreshed at the same time.
+    runner.parallelFor(0, leaves.size(), 1, [&](size_t i) { leaves[i]->getTransform().refresh(); });
+
+    std::atomic_size_t wrong = 0;
+    runner.parallelFor(0, leaves.size() * 8, 1, [&](size_t i) {
+        if (translationX(leaves[i % leaves.size()]->getTransform()) != 17.0f) {
+            ++wrong;
+        }
+    });
+    REQUIRE(wrong == 0);
+}
+
+TEST_CASE("Transform hierarchy structural changes")
+{
+    neon::TaskRunner runner;
+    neon::Room room(nullptr);
+    auto& hierarchy = room.getTransformHierarchy();
+
+    // Each node is one unit away from its parent.
+    std::vector<neon::IdentifiableWrapper<neon::GameObject>> roots;
+    std::vector<neon::IdentifiableWrapper<neon::GameObject>> middles;
+    std::vector<neon::IdentifiableWrapper<neon::GameObject>> leaves;
+    for (size_t i = 0; i < 600; ++i) {
+        auto root = room.newGameObject();
+        auto middle = room.newGameObject();
+        auto leaf = room.newGameObject();
+        middle->setParent(root);
+        leaf->setParent(middle);
+        root->getTransform().setPosition(rush::Vec3f(1.0f, 0.0f, 0.0f));
+        middle->getTransform().setPosition(rush::Vec3f(1.0f, 0.0f, 0.0f));
+        leaf->getTransform().setPosition(rush::Vec3f(1.0f, 0.0f, 0.0f));
+        roots.push_back(root);
+        middles.push_back(middle);
+        leaves.push_back(leaf);
+    }
+    hierarchy.update(runner);
+    REQUIRE(translationX(leaves.back()->getTransform()) == 3.0f);
+
+    // Move the leaves to the root of the next tree, and the last one to the first tree.
+    // Each move leaves tombstones behind, compacted by the update.
+    for (size_t i = 0; i < leaves.size(); ++i) {
+        leaves[i]->setParent(roots[(i + 1) % roots.size()]);
+    }
+    hierarchy.update(runner);
+    for (auto& leaf : leaves) {
+        REQUIRE(translationX(leaf->getTransform()) == 2.0f);
+    }
+
+    // Destroying the roots turns the middle nodes and the leaves into roots.
+    for (auto& root : roots) {
+        root->destroy();
+    }
+    hierarchy.update(runner);
+    REQUIRE(hierarchy.size() == 1200);
+    for (size_t i = 0; i < leaves.size(); ++i) {
+        REQUIRE(translationX(middles[i]->getTransform()) == 1.0f);
+        REQUIRE(translationX(leaves[i]->getTransform()) == 1.0f);
+    }
+
+    // Chains built on top of roots that stay inside the ranges of other nodes.
+    for (size_t i = 1; i < leaves.size(); ++i) {
+        leaves[i]->setParent(leaves[i - 1]);
+    }
+    middles.front()->setParent(leaves.back());
+    hierarchy.update(runner);
+    REQUIRE(translationX(leaves.back()->getTransform()) == 600.0f);
+    REQUIRE(translationX(middles.front()->getTransform()) == 601.0f);
+}
+
+TEST_CASE("Transform versions only change with the matrices")
+{
+    neon::TaskRunner runner;
+    neon::Room room(nullptr);
+    auto& hierarchy = room.getTransformHierarchy();
+
+    auto parent = room.newGameObject();
+    auto moving = room.newGameObject();
+    auto still = room.newGameObject();
+    moving->getTransform().setPosition(rush::Vec3f(1.0f, 0.0f, 0.0f));
+    hierarchy.update(runner);
+
+    // Graphic components upload the matrices when the version differs from the uploaded one, starting at 0.
+    uint64_t stillVersion = still->getTransform().getVersion();
+    uint64_t movingVersion = moving->getTransform().getVersion();
+    REQUIRE(stillVersion != 0);
+    REQUIRE(movingVersion != 0);
+
+    for (size_t frame = 0; frame < 10; ++frame) {
+        moving->getTransform().move(rush::Vec3f(1.0f, 0.0f, 0.0f));
+        hierarchy.update(runner);
+
+        REQUIRE(still->getTransform().getVersion() == stillVersion);
+        REQUIRE(moving->getTransform().getVersion() != movingVersion);
+        movingVersion = moving->getTransform().getVersion();
+    }
+
+    // Changing the parent changes the matrices.
+    parent->getTransform().setPosition(rush::Vec3f(0.0f, 5.0f, 0.0f));
+    still->setParent(parent);
+    hierarchy.update(runner);
+    REQUIRE(still->getTransform().getVersion() != stillVersion);
+    stillVersion = still->getTransform().getVersion();
+
+    // And so does moving the parent.
+    parent->getTransform().move(rush::Vec3f(0.0f, 1.0f, 0.0f));
+    hierarchy.update(runner);
+    REQUIRE(still->getTransform().getVersion() != stillVersion);
+}
+
+TEST_CASE("Transform hierarchy benchmark", "[!benchmark]")
+{
+    neon::TaskRunner runner;
+    neon::Room room(nullptr);
+    auto& hierarchy = room.getTransformHierarchy();
+
+    // 1000 roots with 200 descendants each.
+    std::vector<neon::IdentifiableWrapper<neon::GameObject>> roots;
+    for (size_t i = 0; i < 1000; ++i) {
+        auto parent = room.newGameObject();
+        roots.push_back(parent);
+        for (size_t j = 0; j < 200; ++j) {
+            auto child = room.newGameObject();
+            child->setParent(parent);
+            child->getTransform().setPosition(rush::Vec3f(1.0f, 0.0f, 0.0f));
+            parent = child;
+        }
+    }
+    hierarchy.update(runner);
+
+    BENCHMARK("Update 200k nodes")
+    {
+        for (auto& root : roots) {
+            root->getTransform().move(rush::Vec3f(1.0f, 0.0f, 0.0f));
+        }
+        hierarchy.update(runner);
+        return hierarchy.size();
+    };
+}